@@ -4,6 +4,18 @@
 #include "patterns.hpp"
 #include "gpio_manager_stm32.hpp"
 #include "adc_manager_stm32.hpp"
+#include "pil_timebase.hpp"
+#include "event_loop.hpp"
+#include "soft_irq.hpp"
+#if defined(APP_RTOS)
+#include "idle_os.hpp"
+#include "soft_irq_os.hpp"
+#else
+#include "idle_stm32.hpp"
+#include "soft_irq_stm32.hpp"
+#endif
+#include "timer_wheel.hpp"
+#include "coro_task.hpp"
 
 extern GpioManager gpio;
 extern AdcManager  adc;
@@ -17,22 +29,79 @@ struct FirmwareVersion
 __attribute__((section(".firmware_version"), used)) constexpr FirmwareVersion FIRMWARE_VERSION = {
     .major = 0, .minor = 4};
 
+// Event ids stored by eventLog, names are listed in Tools/decode_error_log.py
+enum class AppEvent : std::uint16_t
+{
+    Boot          = 1, // data: RCC->CSR reset flags
+    CrashRecorded = 2, // data: faulting PC
+    ButtonPressed = 3, // data: press counter
+};
+
+// Main loop events; the order is the dispatch priority, first runs first
+enum class LoopEvent : std::uint8_t
+{
+    Coroutines, // Coro::Executor: a flow is ready to resume
+    ConsoleRx,  // USART2 RX bytes queued
+    Timers,     // TIM2 alarm: software timers are due
+    Supervise,  // Periodic from TIM3: event log flush, watchdog
+    Count
+};
+
+#if defined(APP_RTOS)
+using AppEventLoop = EventLoop<LoopEvent, IdleBlock_Os>; // The loop is one PilOs task
+#else
+using AppEventLoop = EventLoop<LoopEvent, IdleSleep_STM32>;
+#endif
+extern AppEventLoop eventLoop;
+
+// Bottom halves of the interrupt handlers, see app_it.cpp; the urgency is the level given
+// at subscribe (0 first), the ids are only names
+enum class SoftIrqId : std::uint8_t
+{
+    Button,    // EXTI0 edge: debounce, notify the observers
+    ConsoleRx, // USART2 byte: queue it for the console
+    Count
+};
+
+#if defined(APP_RTOS)
+using AppSoftIrq = SoftIrq<SoftIrqId, SoftIrqPend_Os>; // Drained by the "softirq" task
+#else
+using AppSoftIrq = SoftIrq<SoftIrqId, SoftIrqPendSV_STM32>; // Drained by PendSV_Handler
+#endif
+extern AppSoftIrq softIrq;
+
+void ButtonSoftIrq(void* t_context, uint32_t t_pin);
+void ConsoleRxSoftIrq(void* t_context, uint32_t t_data);
+
+// Software timers, 1 tick = 1 ms; callbacks run in the event loop (LoopEvent::Timers)
+using SoftTimerWheel = TimerWheel<4>;
+extern SoftTimerWheel softTimers;
+
+void StartSoftTimer(SoftTimer& t_timer, uint32_t t_delayMs, SoftTimerCallback t_callback,
+                    void* t_context, uint32_t t_periodMs = 0);
+
+// Application flows as coroutines, resumed by the event loop (LoopEvent::Coroutines);
+// co_await Coro::Delay(StartSoftTimer, ms) sleeps on the software timers
+extern Coro::Executor coroutines;
+
 class Debouncer
 {
   public:
-    explicit Debouncer(uint32_t debounceMs);
+    Debouncer(const ITimebase& t_timebase, uint32_t debounceMs);
     bool shouldTrigger();
 
   private:
-    uint32_t debounceTime;
-    uint32_t lastTick;
-    bool     locked;
+    Deadline quiet; // Events before it are bounces of the last accepted one
+    uint64_t debounceUs;
 };
 
 class SubjectWithDebouce : public Subject
 {
   public:
-    explicit SubjectWithDebouce(uint32_t t_debounce_ms) : m_debouncer(t_debounce_ms) {}
+    SubjectWithDebouce(const ITimebase& t_timebase, uint32_t t_debounce_ms)
+        : m_debouncer(t_timebase, t_debounce_ms)
+    {
+    }
 
     void notifyObserversWhenStable(uint32_t mask)
     {
@@ -48,39 +117,8 @@ class SubjectWithDebouce : public Subject
 
 extern SubjectWithDebouce exti0_Subject;
 
-class UserButtonManager : public Observer
-{
-  public:
-    UserButtonManager(Subject& t_subject, uint32_t t_pin_mask);
-    void notify(uint32_t mask) const override;
-    void process();
-
-  private:
-    Subject&              m_subject;
-    uint32_t              m_pin_mask = -1;
-    mutable volatile bool m_pending  = false;
-    uint32_t              m_press_counter{0};
-};
-
-class LedManager : public Observer
-{
-  public:
-    LedManager(Subject& t_subject, uint32_t t_ledMask, IGPIOPin* t_led);
-    void notify(uint32_t mask) const override;
-    void process();
-
-  private:
-    Subject&              m_subject;
-    uint32_t              m_pin_mask = -1;
-    IGPIOPin*             m_ledPtr{nullptr};
-    mutable volatile bool m_pending{false};
-};
-
 void ConsoleNotify(uint8_t t_item);
 
-inline constexpr StaticObserver<uint8_t> staticObservers[] = {{ConsoleNotify}};
-
-inline constexpr StaticObserverList<uint8_t>
-    uart2_Observers(staticObservers, sizeof(staticObservers) / sizeof(staticObservers[0]));
+using Uart2Observers = StaticObservers<ConsoleNotify>;
 
 #endif // APP_HPP
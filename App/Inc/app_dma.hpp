@@ -0,0 +1,23 @@
+/**
+ * @file      App/Inc/app_dma.hpp
+ * @author    it32bit
+ * @brief     DMA requests of the application, one stream each.
+ *
+ * @details   Add a request here before using it; DmaAllocation assigns the streams at
+ *            compile time and fails the build when two requests would share one.
+ *            Timer capture binds its stream at run time: list the capture requests
+ *            here too, so that a fixed user cannot take their stream.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef APP_DMA_HPP
+#define APP_DMA_HPP
+
+#include "dma_stm32.hpp"
+
+using AppDma = DmaAllocation<DmaRequest::Usart2Tx>;
+
+#endif // APP_DMA_HPP
@@ -1,110 +1,174 @@
+/**
+ * @file      App/Inc/circular_buffer.hpp
+ * @author    it32bit
+ * @brief     Lock-free single-producer / single-consumer ring buffer.
+ *
+ * @details   One context (e.g. an ISR or a DMA completion) produces, one context (e.g. the
+ *            main loop) consumes. Head and tail are free-running indices, masked on access,
+ *            so all TSize slots are usable and size() is simply head - tail.
+ *
+ *            The producer owns m_head and the consumer owns m_tail. Each side publishes
+ *            its index with a release store after touching the slots and reads the other
+ *            side's index with an acquire load. On Cortex-M4 std::atomic<size_t> is
+ *            lock-free and these orders compile to plain LDR/STR with a DMB, on the host
+ *            they give the same guarantees between threads.
+ *
+ *            peekContiguous()/commit() expose the readable region without a copy (e.g. as
+ *            a UART TX DMA source), prepareContiguous()/publish() do the same for the
+ *            producer (e.g. as a UART RX DMA destination). Both return at most the part
+ *            up to the physical end of the array; call again after the commit for the rest.
+ *
+ *            TObservers (a StaticObservers<...> list) are called by push() for every item
+ *            after it is published, in the producer's context. The fan-out is resolved at
+ *            compile time and inlines into the producer; the default has no observers.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
 #ifndef CIRCULAR_BUFFER_HPP
 #define CIRCULAR_BUFFER_HPP
 
-#include <string>
+#include <algorithm>
 #include <array>
-#include <functional>
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include "patterns.hpp"
 
-template <class T, size_t TSize, size_t TObserverCount>
+template <class T, std::size_t TSize, class TObservers = NoObservers>
 class CircularBuffer
 {
+    static_assert((TSize >= 2) && ((TSize & (TSize - 1)) == 0), "TSize must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "Slots are copied without construction");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "Indices must be lock-free");
+
   public:
-    static CircularBuffer& instance()
-    {
-        static CircularBuffer circularBuffer;
-        return circularBuffer;
-    }
+    /* Producer side */
 
-    bool push(const T t_item)
+    bool push(const T& t_item)
     {
-        auto next = (m_head + 1) % TSize;
-        if (next == m_tail)
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == TSize)
         {
-            m_full = true;
             return false; // buffer full
         }
-        m_buff[m_head] = t_item;
-        m_head         = next;
-        notifyObservers(t_item);
+        m_buff[head & MASK] = t_item;
+        m_head.store(head + 1, std::memory_order_release);
+
+        TObservers::notifyAll(t_item);
         return true;
     }
 
-    bool pop(T& t_item)
+    /** @brief Push as many items as fit; returns the number pushed. */
+    std::size_t push(std::span<const T> t_items)
     {
-        if (m_head == m_tail)
+        const std::size_t head  = m_head.load(std::memory_order_relaxed);
+        const std::size_t space = TSize - (head - m_tail.load(std::memory_order_acquire));
+        const std::size_t count = std::min(space, t_items.size());
+
+        const std::size_t first = std::min(count, TSize - (head & MASK));
+        std::copy_n(t_items.begin(), first, m_buff.begin() + (head & MASK));
+        std::copy_n(t_items.begin() + first, count - first, m_buff.begin());
+
+        m_head.store(head + count, std::memory_order_release);
+
+        if constexpr (TObservers::count != 0)
         {
-            return false; // buffer empty
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                TObservers::notifyAll(t_items[i]);
+            }
         }
-        t_item = m_buff[m_tail];
-        m_tail = (m_tail + 1) % TSize;
-        return true;
+        return count;
     }
 
-    void reset() noexcept
+    /** @brief Free slots up to the end of the array, to be filled in place. */
+    std::span<T> prepareContiguous()
     {
-        m_head = m_tail;
-        m_full = false;
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        const std::size_t space = TSize - (head - m_tail.load(std::memory_order_acquire));
+        return {m_buff.data() + (head & MASK), std::min(space, TSize - (head & MASK))};
     }
 
-    size_t size() const noexcept
+    /** @brief Make t_count items written through prepareContiguous() visible. */
+    void publish(std::size_t t_count)
     {
-        size_t size = TSize;
+        m_head.store(m_head.load(std::memory_order_relaxed) + t_count, std::memory_order_release);
+    }
 
-        if (m_head >= m_tail)
-        {
-            size = m_head - m_tail;
-        }
-        else
+    /* Consumer side */
+
+    bool pop(T& t_item)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (m_head.load(std::memory_order_acquire) == tail)
         {
-            size = TSize + m_head - m_tail;
+            return false; // buffer empty
         }
-        return size;
+        t_item = m_buff[tail & MASK];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
     }
 
-    bool empty() const noexcept
+    /** @brief Pop up to t_items.size() items; returns the number popped. */
+    std::size_t pop(std::span<T> t_items)
     {
-        return (m_head == m_tail); // if head and tail are equal, we are empty
+        const std::size_t tail  = m_tail.load(std::memory_order_relaxed);
+        const std::size_t used  = m_head.load(std::memory_order_acquire) - tail;
+        const std::size_t count = std::min(used, t_items.size());
+
+        const std::size_t first = std::min(count, TSize - (tail & MASK));
+        std::copy_n(m_buff.begin() + (tail & MASK), first, t_items.begin());
+        std::copy_n(m_buff.begin(), count - first, t_items.begin() + first);
+
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
     }
 
-    bool full() const noexcept
+    /** @brief Readable items up to the end of the array, valid until commit(). */
+    std::span<const T> peekContiguous() const
     {
-        return m_full; // If tail is ahead the head by 1, we are full
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        const std::size_t used = m_head.load(std::memory_order_acquire) - tail;
+        return {m_buff.data() + (tail & MASK), std::min(used, TSize - (tail & MASK))};
     }
 
-    size_t capacity() const noexcept
+    /** @brief Release t_count items read through peekContiguous(). */
+    void commit(std::size_t t_count)
     {
-        return TSize; // Return array size
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + t_count, std::memory_order_release);
     }
 
-    void registerObserver(std::function<void(T)> callback)
+    /** @brief Drop everything currently stored (consumer side). */
+    void reset() noexcept
     {
-        observers[m_observer_count++] = callback; // Add new observer
+        m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
     }
 
-    auto getData() { return m_buff.data(); }
+    /* Either side; exact only for the calling side's own view */
 
-  private:
-    CircularBuffer() = default;
+    std::size_t size() const noexcept
+    {
+        // Tail first: the head read afterwards can only be further ahead
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+        return m_head.load(std::memory_order_acquire) - tail;
+    }
 
-    std::array<T, TSize> m_buff;
+    bool empty() const noexcept { return size() == 0; }
 
-    volatile size_t m_head = 0;
-    volatile size_t m_tail = 0;
-    mutable bool    m_full = false;
-    size_t          m_observer_count{};
-    size_t          m_observer_active = 0;
+    bool full() const noexcept { return size() == TSize; }
 
-    static constexpr size_t MaxObservers{TObserverCount};
+    static constexpr std::size_t capacity() noexcept { return TSize; }
 
-    // void (*observers[MaxObservers])(T) = {};
-    std::function<void(T)> observers[MaxObservers];
+  private:
+    static constexpr std::size_t MASK = TSize - 1;
 
-    void notifyObservers(T t_item)
-    {
-        for (size_t i = 0; i < m_observer_count; ++i)
-        {
-            observers[i](t_item);
-        }
-    }
+    std::array<T, TSize>     m_buff{};
+    std::atomic<std::size_t> m_head{0}; // Written by the producer only
+    std::atomic<std::size_t> m_tail{0}; // Written by the consumer only
 };
+
 #endif // CIRCULAR_BUFFER_HPP
@@ -3,18 +3,45 @@
 
 #include <stdint-gcc.h>
 #include <stddef.h>
+#include "circular_buffer.hpp"
 
 constexpr size_t CONSOLE_BUFFER_SIZE{128};
-constexpr size_t CONSOLE_COMMAND_SIZE{6};
+constexpr size_t CONSOLE_RX_QUEUE_SIZE{256};
 
-constexpr size_t MaxCommandNameLength = 16;
-constexpr size_t MaxCommandDescLength = 64;
+/**
+ * @brief RX path counters, written by the USART2 ISR and read by the "uart" command
+ */
+struct ConsoleStats
+{
+    volatile uint32_t rxBytes{0};
+    volatile uint32_t rxDropped{0};  // RX queue full
+    volatile uint32_t rxOverruns{0}; // USART ORE: a byte was lost before the ISR ran
+    volatile uint32_t isrCyclesLast{0};
+    volatile uint32_t isrCyclesMax{0};
+};
 
+/**
+ * @brief Line console on USART2
+ *
+ * @note  The ISR side only enqueues bytes (receivedData) and updates counters. Line
+ *        assembly and command dispatch run in poll(), called from the main loop, so
+ *        handlers may block on printf/send without stalling other interrupts.
+ *
+ *        Commands are registered with CONSOLE_COMMAND() (console_commands.hpp), from
+ *        this or any other translation unit.
+ */
 class Console
 {
   public:
     static void send(const char* param);
-    void        receivedData(uint8_t byte) noexcept;
+
+    /* USART2 ISR context */
+    void receivedData(uint8_t byte) noexcept;
+    void noteOverrun() noexcept;
+    void noteIsrCycles(uint32_t t_cycles) noexcept;
+
+    /* Main loop context */
+    void poll();
 
     static void help(const char* param);
     static void reset(const char* param);
@@ -22,13 +49,21 @@ class Console
     static void temperature(const char* msg);
     static void watchdogTest(const char* msg);
     static void firmwareUpdate(const char* msg);
+    static void errorLogDump(const char* msg);
+    static void uartStats(const char* msg);
 
   private:
     static constexpr size_t MaxLength = CONSOLE_BUFFER_SIZE;
 
+    CircularBuffer<uint8_t, CONSOLE_RX_QUEUE_SIZE> m_rxQueue; // ISR -> poll()
+    ConsoleStats                                   m_stats;
+
     char   buffer[MaxLength]{};
     size_t m_head = 0;
 
+    static void sendRaw(const uint8_t* data, size_t size);
+
+    void assemble(uint8_t byte);
     void process(const char* line);
     void cleanMessage() noexcept;
     void setMessageToProcess() noexcept;
@@ -38,42 +73,4 @@ class Console
     bool push(uint8_t byte) noexcept;
 };
 
-/**
- * @brief ConsoleCommand
- * @note If it is used std::function<void(std::string_view)> handler;
- *        Now as a handler it is able to use lambdas, member functions, or free functions.
- *
- * But: To create a constexpr-safe command table suitable for storing in flash memory
- * (especially in embedded systems like STM32), we need to avoid runtime-managed types
- * like std::function, std::vector, and even std::string_view
- * if it's not used carefully.
- *
- * 1. Use raw function pointers instead of std::function
- * 2. Use fixed-size C-style strings instead of std::string_view
- * 3. Define a literal-friendly struct
- * 4. Declare the command table as constexpr
- */
-
-using CommandHandler = void (*)(const char*);
-
-struct ConsoleCommand
-{
-    size_t         number;
-    char           name[MaxCommandNameLength];
-    CommandHandler handler;
-    char           description[MaxCommandDescLength];
-};
-
-/**
- * @note This is the modern C++20 way to share constexpr data across files.
- */
-inline constexpr ConsoleCommand cmdConfigArray[CONSOLE_COMMAND_SIZE] = {
-    {0, "help",     &Console::help,         "Show available commands"  },
-    {1, "reset",    &Console::reset,        "Reset the MCU"            },
-    {2, "echo",     &Console::echo,         "Echo a number back"       },
-    {3, "temp",     &Console::temperature,  "Get Temp from Tsensor"    },
-    {4, "watchdog", &Console::watchdogTest, "Watchdog Test: while(1){}"},
-    {5, "fw_update", &Console::firmwareUpdate, "Firmware Update"},
-};
-
 #endif // CONSOLE_HPP
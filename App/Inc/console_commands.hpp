@@ -0,0 +1,116 @@
+/**
+ * @file      App/Inc/console_commands.hpp
+ * @author    it32bit
+ * @brief     Link-time console command table with exact-match binary search.
+ *
+ * @details   Commands are registered with CONSOLE_COMMAND() in any translation unit. Every
+ *            entry lands in its own ".console_cmd.<name>" section; the App linker script
+ *            collects them with KEEP(SORT_BY_NAME(...)) between __console_commands_start
+ *            and __console_commands_end, so the table is sorted by name at link time and
+ *            lookup is a binary search over pre-computed name lengths.
+ *
+ *            Names must be valid identifiers (they become part of the section name).
+ *            Each entry is also an external symbol consoleCommand_<name>, so a name
+ *            registered twice fails the build: a redefinition within one unit, a multiple
+ *            definition at link time across units.
+ *            Matching is on the whole first token of a line: "temp" does not match
+ *            "temperature_x".
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef CONSOLE_COMMANDS_HPP
+#define CONSOLE_COMMANDS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+using CommandHandler = void (*)(const char*);
+
+struct ConsoleCommand
+{
+    const char*    name;
+    CommandHandler handler;
+    const char*    description;
+    std::size_t    length; // strlen(name)
+};
+
+#define CONSOLE_COMMAND(t_name, t_handler, t_description)                                          \
+    extern const ConsoleCommand consoleCommand_##t_name;                                           \
+    __attribute__((used, section(".console_cmd." #t_name),                                         \
+                   aligned(alignof(ConsoleCommand)))) constexpr ConsoleCommand                     \
+        consoleCommand_##t_name                                                                    \
+    {                                                                                              \
+        #t_name, t_handler, t_description, sizeof(#t_name) - 1                                     \
+    }
+
+namespace ConsoleCommands
+{
+
+/** @brief strcmp() order of t_command.name against the token t_name[0..t_length). */
+constexpr int compare(const ConsoleCommand& t_command, const char* t_name, std::size_t t_length)
+{
+    const std::size_t common = (t_command.length < t_length) ? t_command.length : t_length;
+    for (std::size_t i = 0; i < common; ++i)
+    {
+        if (t_command.name[i] != t_name[i])
+        {
+            return (static_cast<unsigned char>(t_command.name[i]) <
+                    static_cast<unsigned char>(t_name[i]))
+                       ? -1
+                       : 1;
+        }
+    }
+    return (t_command.length == t_length) ? 0 : ((t_command.length < t_length) ? -1 : 1);
+}
+
+/** @brief Exact match of the token in a table sorted by name; nullptr when unknown. */
+constexpr const ConsoleCommand* find(std::span<const ConsoleCommand> t_table, const char* t_name,
+                                     std::size_t t_length)
+{
+    std::size_t low  = 0;
+    std::size_t high = t_table.size();
+
+    while (low < high)
+    {
+        const std::size_t middle = low + (high - low) / 2;
+        const int         order  = compare(t_table[middle], t_name, t_length);
+
+        if (order == 0)
+        {
+            return &t_table[middle];
+        }
+        if (order < 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return nullptr;
+}
+
+/** @brief Sorted without duplicates, for constant tables: static_assert(isValid(TABLE)). */
+constexpr bool isValid(std::span<const ConsoleCommand> t_table)
+{
+    for (std::size_t i = 1; i < t_table.size(); ++i)
+    {
+        if (compare(t_table[i - 1], t_table[i].name, t_table[i].length) >= 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** @brief The linker-collected table (target only). */
+std::span<const ConsoleCommand> all();
+
+} // namespace ConsoleCommands
+
+#endif // CONSOLE_COMMANDS_HPP
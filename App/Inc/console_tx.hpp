@@ -0,0 +1,59 @@
+/**
+ * @file      App/Inc/console_tx.hpp
+ * @author    it32bit
+ * @brief     DMA-driven USART2 transmit path shared by Fmt logging, printf and Console.
+ *
+ * @details   Writers copy text into a lock-free ring; DMA1 stream 6 sends the readable
+ *            part of the ring straight from it, one interrupt per chunk instead of one
+ *            per byte, and its completion starts the next chunk. Writers run in thread
+ *            mode (main loop), which keeps the ring single producer; output attempted
+ *            from handler mode is dropped and counted. When the ring is full a writer
+ *            waits for the DMA, or polls its completion itself while interrupts are
+ *            masked (start-up, critical sections). A chunk the DMA refuses is dropped
+ *            and counted, see DmaTxQueue.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef CONSOLE_TX_HPP
+#define CONSOLE_TX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "app_dma.hpp"
+#include "dma_tx_queue.hpp"
+
+constexpr size_t CONSOLE_TX_QUEUE_SIZE{1024};
+
+struct Usart2TxPort
+{
+    static volatile void* dataRegister();
+};
+
+using ConsoleTxQueue = DmaTxQueue<DmaStream_STM32, Usart2TxPort, CONSOLE_TX_QUEUE_SIZE>;
+
+class ConsoleTx
+{
+  public:
+    /* Thread mode */
+    void write(const char* t_data, size_t t_size);
+    bool tryWrite(const char* t_data, size_t t_size) noexcept; // All or nothing, never waits
+    void flush(); // Wait until the last byte left the shift register, e.g. before a reset
+
+    uint32_t dropped() const { return m_dropped + m_tx.dropped(); }
+    uint32_t dmaErrors() const { return m_tx.dmaErrors(); }
+
+  private:
+    void startTransmit() noexcept; // Next chunk, if the DMA is idle
+    void pollIfMasked() noexcept;
+
+    DmaStream_STM32   m_dma{AppDma::route<DmaRequest::Usart2Tx>()};
+    ConsoleTxQueue    m_tx{m_dma};
+    volatile uint32_t m_dropped{0}; // Bytes written from handler mode
+};
+
+extern ConsoleTx consoleTx;
+
+#endif // CONSOLE_TX_HPP
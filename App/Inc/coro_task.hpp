@@ -0,0 +1,533 @@
+/**
+ * @file      App/Inc/coro_task.hpp
+ * @author    it32bit
+ * @brief     C++20 coroutine runtime: pooled frames, an executor resumed from the event
+ *            loop, and awaitables for delays, edges, byte streams and DMA completion.
+ *
+ * @details   A Coro::Task is a flow written as straight-line code:
+ *
+ *                Coro::Task blink(IGPIOPin* t_led)
+ *                {
+ *                    for (;;)
+ *                    {
+ *                        co_await buttonPressed;         // Coro::Event, set from an ISR
+ *                        t_led->toggle();
+ *                        co_await Coro::Delay(StartSoftTimer, 200);
+ *                    }
+ *                }
+ *                executor.spawn(blink(led));
+ *
+ *            Frames come from allocateFrame()/releaseFrame(), which the application
+ *            defines, normally over a FramePool: no heap. When the pool is out of blocks
+ *            the Task is empty and spawn() returns false.
+ *
+ *            Awaitables never resume a coroutine in their own context. They hand its
+ *            Waiter to the Executor (schedule() is lock-free, safe from any interrupt),
+ *            whose wake hook tells the event loop to call runReady() in thread mode.
+ *            A Task runs on its executor until it finishes; its frame is released then.
+ *            Tasks are top-level flows: a Task cannot co_await another Task.
+ *
+ * @note      One coroutine at a time may wait on an Event, Channel or DmaAwait.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef CORO_TASK_HPP
+#define CORO_TASK_HPP
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include "circular_buffer.hpp"
+#include "patterns.hpp"
+#include "pil_dma.hpp"
+#include "timer_wheel.hpp"
+
+namespace Coro
+{
+
+/** @brief Frame allocator, defined by the application; nullptr when exhausted. */
+void* allocateFrame(std::size_t t_size);
+void  releaseFrame(void* t_frame);
+
+/**
+ * @brief TBlocks frames of at most TBlockSize bytes on a free list. Thread mode only.
+ */
+template <std::size_t TBlocks, std::size_t TBlockSize>
+class FramePool
+{
+    static_assert(TBlockSize >= sizeof(void*), "A free block holds the free-list link");
+
+  public:
+    FramePool()
+    {
+        for (std::size_t i = TBlocks; i-- > 0;)
+        {
+            release(m_blocks[i].bytes);
+        }
+        m_used = 0;
+    }
+
+    void* allocate(std::size_t t_size)
+    {
+        if ((t_size > TBlockSize) || (m_free == nullptr))
+        {
+            m_failed++;
+            return nullptr;
+        }
+        void* block = m_free;
+        m_free      = *static_cast<void**>(block);
+        m_used++;
+        m_peak    = (m_used > m_peak) ? m_used : m_peak;
+        m_largest = (t_size > m_largest) ? t_size : m_largest;
+        return block;
+    }
+
+    void release(void* t_block)
+    {
+        *static_cast<void**>(t_block) = m_free;
+        m_free                        = t_block;
+        m_used--;
+    }
+
+    static constexpr std::size_t capacity() { return TBlocks; }
+    std::size_t                  used() const { return m_used; }
+    std::size_t                  peak() const { return m_peak; }
+    std::size_t                  failed() const { return m_failed; }
+    std::size_t                  largest() const { return m_largest; } // Biggest frame seen
+
+  private:
+    struct Block
+    {
+        alignas(std::max_align_t) unsigned char bytes[TBlockSize];
+    };
+
+    Block       m_blocks[TBlocks];
+    void*       m_free{nullptr};
+    std::size_t m_used{0};
+    std::size_t m_peak{0};
+    std::size_t m_failed{0};
+    std::size_t m_largest{0};
+};
+
+class Executor;
+
+/**
+ * @brief A suspended coroutine queued at most once for resumption by its executor.
+ */
+class Waiter
+{
+  public:
+    void bind(std::coroutine_handle<> t_handle, Executor* t_executor)
+    {
+        m_handle   = t_handle;
+        m_executor = t_executor;
+    }
+
+    /** @brief Queue the coroutine for runReady(). Any context. */
+    void wake();
+
+  private:
+    friend class Executor;
+
+    std::coroutine_handle<> m_handle;
+    Executor*               m_executor{nullptr};
+    Waiter*                 m_next{nullptr};
+    std::atomic<bool>       m_queued{false};
+};
+
+class Task
+{
+  public:
+    struct promise_type
+    {
+        static void* operator new(std::size_t t_size) noexcept { return allocateFrame(t_size); }
+        static void  operator delete(void* t_frame) { releaseFrame(t_frame); }
+
+        static Task get_return_object_on_allocation_failure() { return Task{}; }
+
+        Task get_return_object()
+        {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; } // spawn() starts it
+        std::suspend_never  final_suspend() noexcept { return {}; }   // Frame released here
+        void                return_void() {}
+        void                unhandled_exception() { std::terminate(); }
+
+        Executor* executor{nullptr};
+        Waiter    start;
+    };
+
+    Task() = default;
+    Task(Task&& t_other) noexcept : m_handle(t_other.m_handle) { t_other.m_handle = nullptr; }
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&&)      = delete;
+
+    ~Task()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy(); // Never spawned
+        }
+    }
+
+    bool isValid() const { return static_cast<bool>(m_handle); }
+
+  private:
+    friend class Executor;
+
+    explicit Task(std::coroutine_handle<promise_type> t_handle) : m_handle(t_handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+using TaskHandle = std::coroutine_handle<Task::promise_type>;
+
+using WakeHook = void (*)(void* t_context);
+
+class Executor
+{
+  public:
+    /** @param t_wake Called in the waking context after a Waiter is queued, e.g. to post
+     *                the event that makes the loop call runReady(). */
+    explicit Executor(WakeHook t_wake = nullptr, void* t_context = nullptr)
+        : m_wake(t_wake), m_context(t_context)
+    {
+    }
+
+    Executor(const Executor&)            = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    /** @brief Start t_task on the next runReady(); false if its frame was not allocated. */
+    bool spawn(Task&& t_task)
+    {
+        if (!t_task.isValid())
+        {
+            return false;
+        }
+        Task::promise_type& promise = t_task.m_handle.promise();
+        promise.executor            = this;
+        promise.start.bind(t_task.m_handle, this);
+        t_task.m_handle = nullptr; // Owned by itself from now on
+        schedule(promise.start);
+        return true;
+    }
+
+    /** @brief Queue t_waiter unless it is queued already. Lock-free, any context. */
+    void schedule(Waiter& t_waiter)
+    {
+        if (t_waiter.m_queued.exchange(true, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        Waiter* head = m_ready.load(std::memory_order_relaxed);
+        do
+        {
+            t_waiter.m_next = head;
+        } while (!m_ready.compare_exchange_weak(head, &t_waiter, std::memory_order_release,
+                                                std::memory_order_relaxed));
+
+        if (m_wake != nullptr)
+        {
+            m_wake(m_context);
+        }
+    }
+
+    /**
+     * @brief Resume every coroutine queued so far, oldest first; returns how many.
+     *        Coroutines queued meanwhile wait for the next call. Thread mode only.
+     */
+    std::size_t runReady()
+    {
+        // Taking the whole stack at once keeps the push side ABA-free
+        Waiter* stack = m_ready.exchange(nullptr, std::memory_order_acquire);
+
+        Waiter* queue = nullptr;
+        while (stack != nullptr)
+        {
+            Waiter* next  = stack->m_next;
+            stack->m_next = queue;
+            queue         = stack;
+            stack         = next;
+        }
+
+        std::size_t resumed = 0;
+        while (queue != nullptr)
+        {
+            Waiter* waiter = queue;
+            queue          = waiter->m_next;
+            waiter->m_queued.store(false, std::memory_order_release);
+            waiter->m_handle.resume(); // May finish and release the frame holding waiter
+            resumed++;
+        }
+        return resumed;
+    }
+
+    bool hasReady() const { return m_ready.load(std::memory_order_acquire) != nullptr; }
+
+  private:
+    std::atomic<Waiter*> m_ready{nullptr};
+    WakeHook             m_wake;
+    void*                m_context;
+};
+
+inline void Waiter::wake()
+{
+    m_executor->schedule(*this);
+}
+
+/**
+ * @brief Binary event with one waiting coroutine. set() from any context; a set() with
+ *        nobody waiting is latched and lets the next co_await through at once.
+ */
+class Event
+{
+  public:
+    Event()                        = default;
+    Event(const Event&)            = delete;
+    Event& operator=(const Event&) = delete;
+
+    void set()
+    {
+        void* state = m_state.load(std::memory_order_acquire);
+        for (;;)
+        {
+            if (state == latched())
+            {
+                return;
+            }
+            void* const next = (state == nullptr) ? latched() : nullptr;
+            if (m_state.compare_exchange_weak(state, next, std::memory_order_acq_rel,
+                                              std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+        if (state != nullptr)
+        {
+            static_cast<Waiter*>(state)->wake();
+        }
+    }
+
+    bool isSet() const { return m_state.load(std::memory_order_acquire) == latched(); }
+
+    void reset()
+    {
+        void* expected = latched();
+        m_state.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief Park t_waiter until set(); false (and the latch consumed) if already set.
+     */
+    bool park(Waiter& t_waiter)
+    {
+        void* state = nullptr;
+        if (m_state.compare_exchange_strong(state, &t_waiter, std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+        {
+            return true;
+        }
+        // Latched: consume it. Only one coroutine waits, so nobody else clears it.
+        m_state.store(nullptr, std::memory_order_release);
+        return false;
+    }
+
+    struct Awaiter
+    {
+        Event& event;
+        Waiter waiter;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(TaskHandle t_handle)
+        {
+            waiter.bind(t_handle, t_handle.promise().executor);
+            return event.park(waiter);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    Awaiter operator co_await() { return Awaiter{*this, {}}; }
+
+  private:
+    void* latched() const { return const_cast<Event*>(this); }
+
+    std::atomic<void*> m_state{nullptr}; // nullptr, latched() or the parked Waiter
+};
+
+/**
+ * @brief An Event set by Subject notifications matching t_mask, e.g. debounced GPIO edges
+ *        from an EXTI line: co_await edge.
+ */
+class SubjectEvent : public Observer, public Event
+{
+  public:
+    SubjectEvent(Subject& t_subject, std::uint32_t t_mask) : m_mask(t_mask)
+    {
+        t_subject.registerObserver(this, t_mask);
+    }
+
+    void notify(std::uint32_t t_mask) const override
+    {
+        if ((t_mask & m_mask) != 0)
+        {
+            const_cast<SubjectEvent*>(this)->set();
+        }
+    }
+
+  private:
+    std::uint32_t m_mask;
+};
+
+/**
+ * @brief Single-producer byte (or item) stream, e.g. UART RX: push() from the ISR,
+ *        co_await receive() in one coroutine.
+ */
+template <class T, std::size_t TSize>
+class Channel
+{
+  public:
+    /** @brief Producer side; false (item dropped) when full. */
+    bool push(const T& t_item)
+    {
+        if (!m_buffer.push(t_item))
+        {
+            return false;
+        }
+        m_ready.set();
+        return true;
+    }
+
+    struct Awaiter
+    {
+        Channel& channel;
+        Waiter   waiter;
+        T        item{};
+        bool     taken{false};
+
+        bool await_ready()
+        {
+            taken = channel.m_buffer.pop(item);
+            return taken;
+        }
+
+        bool await_suspend(TaskHandle t_handle)
+        {
+            waiter.bind(t_handle, t_handle.promise().executor);
+            for (;;)
+            {
+                if (channel.m_ready.park(waiter))
+                {
+                    return true;
+                }
+                // A latch left by an item taken earlier: look again before parking
+                taken = channel.m_buffer.pop(item);
+                if (taken)
+                {
+                    return false;
+                }
+            }
+        }
+
+        T await_resume()
+        {
+            if (!taken)
+            {
+                channel.m_buffer.pop(item); // set() follows the push that woke us
+            }
+            return item;
+        }
+    };
+
+    Awaiter receive() { return Awaiter{*this, {}, {}, false}; }
+
+    std::size_t size() const { return m_buffer.size(); }
+
+  private:
+    CircularBuffer<T, TSize> m_buffer;
+    Event                    m_ready;
+};
+
+/**
+ * @brief Delay of t_ticks through a timer wheel: co_await Delay(StartSoftTimer, 100).
+ */
+class Delay
+{
+  public:
+    using StartTimer = void (*)(SoftTimer& t_timer, std::uint32_t t_delay,
+                                SoftTimerCallback t_callback, void* t_context,
+                                std::uint32_t t_period);
+
+    Delay(StartTimer t_start, std::uint32_t t_ticks) : m_start(t_start), m_ticks(t_ticks) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(TaskHandle t_handle)
+    {
+        m_waiter.bind(t_handle, t_handle.promise().executor);
+        m_start(m_timer, m_ticks, &Delay::expired, this, 0);
+    }
+
+    void await_resume() const noexcept {}
+
+  private:
+    static void expired(void* t_delay) { static_cast<Delay*>(t_delay)->m_waiter.wake(); }
+
+    StartTimer    m_start;
+    std::uint32_t m_ticks;
+    SoftTimer     m_timer;
+    Waiter        m_waiter;
+};
+
+/**
+ * @brief Start a one-pass DMA transfer and suspend until it completes: the result is
+ *        DmaEvent::Complete or DmaEvent::Error (also when the channel refused to start).
+ */
+class DmaAwait
+{
+  public:
+    DmaAwait(IDmaChannel& t_channel, const DmaTransfer& t_transfer)
+        : m_channel(t_channel), m_transfer(t_transfer)
+    {
+        m_transfer.circular     = false;
+        m_transfer.halfComplete = false;
+        m_transfer.memory1      = nullptr;
+        m_transfer.callback     = &DmaAwait::onDma;
+        m_transfer.context      = this;
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(TaskHandle t_handle)
+    {
+        m_waiter.bind(t_handle, t_handle.promise().executor);
+        return m_channel.start(m_transfer); // Not started: resume at once with Error
+    }
+
+    DmaEvent await_resume() const noexcept { return m_result; }
+
+  private:
+    static void onDma(void* t_context, DmaEvent t_event)
+    {
+        auto& self    = *static_cast<DmaAwait*>(t_context);
+        self.m_result = t_event;
+        self.m_waiter.wake();
+    }
+
+    IDmaChannel& m_channel;
+    DmaTransfer  m_transfer;
+    Waiter       m_waiter;
+    DmaEvent     m_result{DmaEvent::Error};
+};
+
+} // namespace Coro
+
+#endif // CORO_TASK_HPP
@@ -0,0 +1,363 @@
+/**
+ * @file      App/Inc/defer_log.hpp
+ * @author    it32bit
+ * @brief     Deferred binary logging: format strings stay in the ELF, the wire carries ids.
+ *
+ * @details   DLOG_<LEVEL>(Module, "format {}", args...) uses the same format syntax and
+ *            compile-time check as fmt_log.hpp, but does not format anything. Each call
+ *            site owns a static entry "<signature>\0<format>\0" placed in the
+ *            "defer_log_strings" section, which the App linker script keeps in the ELF as
+ *            a non-loaded (INFO) section. The record id is the entry's offset in that
+ *            section plus one.
+ *
+ *            A record is: varint id, varint cycles since the previous record, then the
+ *            arguments as listed in the signature. The timestamp is 64 bits wide, so a gap
+ *            longer than a CYCCNT period (25.6 s at 168 MHz) still decodes to the right time:
+ *              'u' unsigned integer, varint     'i' signed integer, zigzag varint
+ *              'f' float, 4 bytes little endian 'c' char, 1 byte
+ *              's' string, varint length + bytes (at most MAX_STRING)
+ *            Records are COBS encoded and sent as 0x00 <frame> 0x00, so they can share the
+ *            console with plain text, which never contains 0x00. Id 0 is an overflow
+ *            record whose only argument is the number of records dropped before it.
+ *
+ *            Frames are written all-or-nothing through DeferLog::writeFrame() and dropped
+ *            (and counted) when the sink is full; a log call never waits for the UART.
+ *            Like ConsoleTx, logging is for thread mode (main loop).
+ *            Tools/defer_log_decode.cpp renders the text from the ELF's string table.
+ *
+ * @note      GCC ignores section attributes inside templates and inline functions, so
+ *            DLOG is meant for ordinary functions; elsewhere the entry would end up in
+ *            .rodata and cost flash (decoding still works).
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef DEFER_LOG_HPP
+#define DEFER_LOG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "fmt_log.hpp"
+
+namespace DeferLog
+{
+
+constexpr std::size_t MAX_RECORD = 72; // Raw record bytes, before COBS
+constexpr std::size_t MAX_STRING = 24;
+constexpr std::size_t MAX_FRAME  = MAX_RECORD + MAX_RECORD / 254 + 1 + 2; // COBS + delimiters
+
+constexpr std::uint32_t OVERFLOW_ID = 0;
+
+// Start of the entry section: defined by the App linker script, by GNU ld on the host
+extern "C" const char __start_defer_log_strings[];
+
+/**
+ * @brief Sink, defined by the application: queue the whole frame or nothing.
+ */
+bool writeFrame(const std::uint8_t* t_frame, std::size_t t_size);
+
+/**
+ * @brief Free-running 64-bit timestamp, defined by the application (core cycles of the
+ *        timebase on the target). A 32-bit counter would wrap between sparse records.
+ */
+std::uint64_t timestamp();
+
+template <typename... Args>
+struct TypeList
+{
+};
+
+/** @brief Only used in decltype(): names the argument types without evaluating them. */
+template <typename... Args>
+TypeList<std::decay_t<Args>...> typesOf(const Args&...);
+
+template <typename T>
+consteval char signatureOf()
+{
+    switch (Fmt::kindOf<T>())
+    {
+        case Fmt::Kind::Integer:
+            return std::is_signed_v<T> ? 'i' : 'u';
+        case Fmt::Kind::Float:
+            return 'f';
+        case Fmt::Kind::Char:
+            return 'c';
+        default:
+            return 's';
+    }
+}
+
+template <typename T>
+consteval std::size_t maxEncodedSize()
+{
+    switch (Fmt::kindOf<T>())
+    {
+        case Fmt::Kind::Integer:
+            return (sizeof(T) * 8 + 6) / 7;
+        case Fmt::Kind::Float:
+            return 4;
+        case Fmt::Kind::Char:
+            return 1;
+        default:
+            return 1 + MAX_STRING;
+    }
+}
+
+/** @brief "<signature>\0<format>\0", validated like Fmt::print. */
+template <typename... Args, std::size_t N>
+consteval std::array<char, sizeof...(Args) + 1 + N> makeEntry(TypeList<Args...>,
+                                                            const char (&t_format)[N])
+{
+    [[maybe_unused]] const Fmt::FormatString<Args...> check(t_format);
+
+    static_assert(5 + 10 + (maxEncodedSize<Args>() + ... + 0) <= MAX_RECORD,
+                  "Too many or too large arguments for one deferred record");
+
+    std::array<char, sizeof...(Args) + 1 + N> entry{};
+    std::size_t                               pos = 0;
+    ((entry[pos++] = signatureOf<Args>()), ...);
+    entry[pos++] = '\0';
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        entry[pos++] = t_format[i];
+    }
+    return entry;
+}
+
+class Encoder
+{
+  public:
+    explicit Encoder(std::uint8_t* t_buffer) : m_buffer(t_buffer) {}
+
+    void varint(std::uint64_t t_value)
+    {
+        while (t_value >= 0x80)
+        {
+            m_buffer[m_size++] = static_cast<std::uint8_t>(t_value | 0x80);
+            t_value >>= 7;
+        }
+        m_buffer[m_size++] = static_cast<std::uint8_t>(t_value);
+    }
+
+    // 32-bit arguments avoid 64-bit shifts on Cortex-M4
+    void varint(std::uint32_t t_value)
+    {
+        while (t_value >= 0x80)
+        {
+            m_buffer[m_size++] = static_cast<std::uint8_t>(t_value | 0x80);
+            t_value >>= 7;
+        }
+        m_buffer[m_size++] = static_cast<std::uint8_t>(t_value);
+    }
+
+    void bytes(const void* t_data, std::size_t t_size)
+    {
+        std::memcpy(m_buffer + m_size, t_data, t_size);
+        m_size += t_size;
+    }
+
+    std::size_t size() const { return m_size; }
+
+  private:
+    std::uint8_t* m_buffer;
+    std::size_t   m_size{0};
+};
+
+template <typename T>
+void encodeArgument(Encoder& t_out, const T& t_value)
+{
+    constexpr Fmt::Kind kind = Fmt::kindOf<T>();
+
+    if constexpr (kind == Fmt::Kind::Integer)
+    {
+        using Unsigned = std::conditional_t<(sizeof(T) <= 4), std::uint32_t, std::uint64_t>;
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            using Signed = std::make_signed_t<Unsigned>;
+
+            // zigzag: small magnitudes of either sign stay short
+            const Signed value = t_value;
+            const Unsigned sign = static_cast<Unsigned>(value >> (sizeof(Signed) * 8 - 1));
+            t_out.varint(static_cast<Unsigned>((static_cast<Unsigned>(value) << 1) ^ sign));
+        }
+        else
+        {
+            t_out.varint(static_cast<Unsigned>(t_value));
+        }
+    }
+    else if constexpr (kind == Fmt::Kind::Float)
+    {
+        const float value = static_cast<float>(t_value);
+        t_out.bytes(&value, sizeof(value)); // Little endian on both ends
+    }
+    else if constexpr (kind == Fmt::Kind::Char)
+    {
+        t_out.bytes(&t_value, 1);
+    }
+    else
+    {
+        const char* text   = (t_value != nullptr) ? static_cast<const char*>(t_value) : "";
+        std::size_t length = 0;
+        while ((length < MAX_STRING) && (text[length] != '\0'))
+        {
+            ++length;
+        }
+        t_out.varint(static_cast<std::uint32_t>(length));
+        t_out.bytes(text, length);
+    }
+}
+
+/** @brief COBS encode t_size bytes as 0x00 <frame> 0x00; returns the bytes written. */
+inline std::size_t cobsFrame(const std::uint8_t* t_data, std::size_t t_size, std::uint8_t* t_out)
+{
+    std::size_t out  = 0;
+    t_out[out++]     = 0x00;
+    std::size_t code = out++;
+    std::uint8_t run = 1;
+
+    for (std::size_t i = 0; i < t_size; ++i)
+    {
+        if (t_data[i] == 0)
+        {
+            t_out[code] = run;
+            code        = out++;
+            run         = 1;
+            continue;
+        }
+        t_out[out++] = t_data[i];
+        if (++run == 0xFF)
+        {
+            t_out[code] = run;
+            code        = out++;
+            run         = 1;
+        }
+    }
+    t_out[code]  = run;
+    t_out[out++] = 0x00;
+    return out;
+}
+
+/** @brief Decode one COBS frame (without delimiters); returns the size or 0 if malformed. */
+inline std::size_t cobsDecode(const std::uint8_t* t_data, std::size_t t_size, std::uint8_t* t_out)
+{
+    std::size_t out = 0;
+    std::size_t i   = 0;
+
+    while (i < t_size)
+    {
+        const std::uint8_t code = t_data[i++];
+        if ((code == 0) || (i + code - 1 > t_size))
+        {
+            return 0;
+        }
+        for (std::uint8_t k = 1; k < code; ++k)
+        {
+            t_out[out++] = t_data[i++];
+        }
+        if ((code != 0xFF) && (i < t_size))
+        {
+            t_out[out++] = 0x00;
+        }
+    }
+    return out;
+}
+
+namespace Detail
+{
+
+struct State
+{
+    std::uint64_t lastTimestamp{0};
+    std::uint32_t dropped{0}; // Records lost since the last overflow record went out
+};
+
+inline State state;
+
+// Deltas below 2^32 take the 32-bit varint, which avoids 64-bit shifts on Cortex-M4
+inline void delta(Encoder& t_out, std::uint64_t t_cycles)
+{
+    if (t_cycles <= UINT32_MAX)
+    {
+        t_out.varint(static_cast<std::uint32_t>(t_cycles));
+    }
+    else
+    {
+        t_out.varint(t_cycles);
+    }
+}
+
+inline bool send(const std::uint8_t* t_record, std::size_t t_size)
+{
+    std::uint8_t frame[MAX_FRAME];
+    return writeFrame(frame, cobsFrame(t_record, t_size, frame));
+}
+
+} // namespace Detail
+
+/** @brief Records lost because the sink was full, not yet reported by an overflow record. */
+inline std::uint32_t dropped()
+{
+    return Detail::state.dropped;
+}
+
+/** @brief Encode and queue one record; called by the DLOG macros. */
+template <typename... Args>
+void record(const char* t_entry, const Args&... t_args)
+{
+    Detail::State& state = Detail::state;
+    const std::uint64_t now   = timestamp();
+
+    std::uint8_t raw[MAX_RECORD];
+    if (state.dropped != 0)
+    {
+        Encoder overflow(raw);
+        overflow.varint(OVERFLOW_ID);
+        Detail::delta(overflow, now - state.lastTimestamp);
+        overflow.varint(state.dropped);
+        if (!Detail::send(raw, overflow.size()))
+        {
+            ++state.dropped;
+            return;
+        }
+        state.dropped       = 0;
+        state.lastTimestamp = now;
+    }
+
+    Encoder out(raw);
+    out.varint(static_cast<std::uint32_t>(t_entry - __start_defer_log_strings) + 1);
+    Detail::delta(out, now - state.lastTimestamp);
+    (encodeArgument(out, t_args), ...);
+
+    if (!Detail::send(raw, out.size()))
+    {
+        ++state.dropped;
+        return;
+    }
+    state.lastTimestamp = now;
+}
+
+} // namespace DeferLog
+
+#define DLOG_AT(t_module, t_level, t_format, ...)                                                  \
+    do                                                                                             \
+    {                                                                                              \
+        if constexpr (t_module::level >= ::Fmt::Level::t_level)                                    \
+        {                                                                                          \
+            __attribute__((section("defer_log_strings"), used)) static constexpr auto dlogEntry =  \
+                ::DeferLog::makeEntry(decltype(::DeferLog::typesOf(__VA_ARGS__)){}, t_format);     \
+            ::DeferLog::record(dlogEntry.data() __VA_OPT__(, ) __VA_ARGS__);                       \
+        }                                                                                          \
+    } while (0)
+
+#define DLOG_ERROR(t_module, ...) DLOG_AT(t_module, Error, __VA_ARGS__)
+#define DLOG_WARN(t_module, ...)  DLOG_AT(t_module, Warn, __VA_ARGS__)
+#define DLOG_INFO(t_module, ...)  DLOG_AT(t_module, Info, __VA_ARGS__)
+#define DLOG_DEBUG(t_module, ...) DLOG_AT(t_module, Debug, __VA_ARGS__)
+
+#endif // DEFER_LOG_HPP
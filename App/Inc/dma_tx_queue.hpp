@@ -0,0 +1,120 @@
+/**
+ * @file      App/Inc/dma_tx_queue.hpp
+ * @author    it32bit
+ * @brief     Transmit ring drained by a memory to peripheral DMA, one chunk at a time.
+ *
+ * @details   The producer pushes into a CircularBuffer; startTransmit() hands the readable
+ *            part of the ring straight to the DMA and its completion commits the chunk and
+ *            starts the next one. A chunk the DMA refuses (stream unbound or busy) or
+ *            reports as failed is dropped and counted, so a dead DMA never strands data in
+ *            the ring and writers waiting for space always make progress.
+ *
+ *            startTransmit() must not be preempted by the DMA interrupt: the owner masks
+ *            interrupts around it in thread mode. The completion calls it from the DMA
+ *            interrupt directly.
+ *
+ * @tparam TDma      DMA channel (an IDmaChannel), called without virtual dispatch.
+ * @tparam TPort     Peripheral: static volatile void* dataRegister().
+ * @tparam TCapacity Ring size in bytes, a power of two.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef DMA_TX_QUEUE_HPP
+#define DMA_TX_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "circular_buffer.hpp"
+#include "pil_dma.hpp"
+
+template <typename TDma, typename TPort, std::size_t TCapacity>
+class DmaTxQueue
+{
+  public:
+    explicit DmaTxQueue(TDma& t_dma) : m_dma(t_dma) {}
+
+    /* Producer */
+    std::size_t push(std::span<const char> t_data) { return m_queue.push(t_data); }
+    std::size_t space() const { return m_queue.capacity() - m_queue.size(); }
+    bool        empty() const { return m_queue.empty(); }
+
+    /** @brief Start the next chunk if the DMA is idle; refused chunks are dropped. */
+    void startTransmit() noexcept;
+
+    /* DMA stream interrupt */
+    void onDmaEvent(DmaEvent t_event) noexcept;
+
+    std::uint32_t dropped() const { return m_dropped; }  // Bytes lost to DMA failures
+    std::uint32_t dmaErrors() const { return m_errors; } // Refused starts and error events
+
+  private:
+    static void dmaEvent(void* t_queue, DmaEvent t_event)
+    {
+        static_cast<DmaTxQueue*>(t_queue)->onDmaEvent(t_event);
+    }
+
+    void drop(std::size_t t_count) noexcept;
+
+    CircularBuffer<char, TCapacity> m_queue;
+    TDma&                           m_dma;
+    volatile std::size_t            m_inFlight{0}; // Bytes handed to the DMA, not yet committed
+    volatile std::uint32_t          m_dropped{0};
+    volatile std::uint32_t          m_errors{0};
+};
+
+template <typename TDma, typename TPort, std::size_t TCapacity>
+void DmaTxQueue<TDma, TPort, TCapacity>::startTransmit() noexcept
+{
+    while (m_inFlight == 0)
+    {
+        const std::span<const char> chunk = m_queue.peekContiguous();
+        if (chunk.empty())
+        {
+            return;
+        }
+
+        // Claimed before start(): a DMA that completes at once calls back from inside it
+        m_inFlight = chunk.size();
+        if (m_dma.start(DmaTransfer::toPeripheral(TPort::dataRegister(), chunk.data(),
+                                                  static_cast<std::uint16_t>(chunk.size()),
+                                                  &dmaEvent, this)))
+        {
+            return;
+        }
+
+        // Nothing was started: no completion will commit the chunk
+        m_inFlight = 0;
+        drop(chunk.size());
+    }
+}
+
+template <typename TDma, typename TPort, std::size_t TCapacity>
+void DmaTxQueue<TDma, TPort, TCapacity>::onDmaEvent(DmaEvent t_event) noexcept
+{
+    const std::size_t sent = m_inFlight;
+    m_inFlight             = 0;
+
+    if (t_event == DmaEvent::Error)
+    {
+        drop(sent);
+    }
+    else
+    {
+        m_queue.commit(sent);
+    }
+    startTransmit();
+}
+
+template <typename TDma, typename TPort, std::size_t TCapacity>
+void DmaTxQueue<TDma, TPort, TCapacity>::drop(std::size_t t_count) noexcept
+{
+    m_queue.commit(t_count);
+    m_dropped = m_dropped + static_cast<std::uint32_t>(t_count);
+    m_errors  = m_errors + 1;
+}
+
+#endif // DMA_TX_QUEUE_HPP
@@ -0,0 +1,201 @@
+/**
+ * @file      App/Inc/event_loop.hpp
+ * @author    it32bit
+ * @brief     Event-driven main loop: pending-event bitmap, priority dispatch, sleep when idle.
+ *
+ * @details   TEvent is an enum whose values 0..TEvent::Count-1 are both the event ids and
+ *            their priorities: a lower value runs first. post() sets the event's bit with
+ *            one atomic OR (LDREX/STREX on Cortex-M4), so it is safe from any interrupt and
+ *            from thread mode; posting an event that is already pending coalesces with it.
+ *
+ *            runOnce() dispatches until no bit is set, re-reading the bitmap after every
+ *            handler so a higher-priority event posted meanwhile overtakes lower ones, runs
+ *            the idle hook (e.g. to program the next wake-up alarm), then calls
+ *            TIdle::sleep(). The idle policy must return at once when an event is
+ *            pending at the moment it masks interrupts, and otherwise sleep until the next
+ *            interrupt (e.g. IdleSleep_STM32: PRIMASK, WFI). A policy that also has a static
+ *            wake() is called by post() whenever the bitmap goes from empty to non-empty
+ *            (e.g. IdleBlock_Os, when the loop runs as an RTOS task).
+ *
+ *            Every dispatch records the latency from the first post() to the handler call
+ *            and the handler run time, in timebase cycles. Time spent in TIdle::sleep() is
+ *            summed in microseconds, which keep counting while the core sleeps.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef EVENT_LOOP_HPP
+#define EVENT_LOOP_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "pil_timebase.hpp"
+
+using EventHandler = void (*)(void* t_context);
+
+struct EventStats
+{
+    std::uint32_t dispatched{0};
+    std::uint32_t latencyMax{0};   // Cycles from the first post() to the handler call
+    std::uint64_t latencyTotal{0}; // Sum over all dispatches, for the average
+    std::uint32_t runMax{0};       // Cycles spent in the handler
+};
+
+template <class TEvent, class TIdle>
+class EventLoop
+{
+    static constexpr std::size_t EVENTS = static_cast<std::size_t>(TEvent::Count);
+
+    static_assert((EVENTS >= 1) && (EVENTS <= 32), "One bit per event in a 32-bit word");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "post() runs in interrupts");
+
+  public:
+    // Reads no clock: a global loop is constructed before the timebase is started
+    explicit EventLoop(const ITimebase& t_timebase) : m_timebase(t_timebase) {}
+
+    EventLoop(const EventLoop&)            = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    /** @brief Set the handler of t_event; replaces an earlier one. Thread mode only. */
+    void subscribe(TEvent t_event, EventHandler t_handler, void* t_context = nullptr)
+    {
+        m_slots[index(t_event)] = {t_handler, t_context};
+    }
+
+    /** @brief Run t_hook after the last dispatch, before every sleep. Thread mode only. */
+    void setIdleHook(EventHandler t_hook, void* t_context = nullptr)
+    {
+        m_idleHook = {t_hook, t_context};
+    }
+
+    /** @brief Mark t_event pending. Any context. */
+    void post(TEvent t_event)
+    {
+        const std::uint32_t bit = 1U << index(t_event);
+
+        // Only the first post of a burst stamps the time; the dispatcher reads the stamp
+        // before it clears the bit, so it never races with a later post.
+        if ((m_pending.load(std::memory_order_relaxed) & bit) == 0)
+        {
+            m_postedAt[index(t_event)] = m_timebase.nowCycles();
+        }
+        const std::uint32_t before = m_pending.fetch_or(bit, std::memory_order_release);
+
+        // Idle policies that block a task rather than the core need a kick
+        if constexpr (requires { TIdle::wake(); })
+        {
+            if (before == 0)
+            {
+                TIdle::wake();
+            }
+        }
+    }
+
+    bool isPending(TEvent t_event) const
+    {
+        return (m_pending.load(std::memory_order_acquire) & (1U << index(t_event))) != 0;
+    }
+
+    /** @brief Run the handler of the highest-priority pending event; false when none is. */
+    bool dispatchOne()
+    {
+        const std::uint32_t pending = m_pending.load(std::memory_order_acquire);
+        if (pending == 0)
+        {
+            return false;
+        }
+
+        const auto          event  = static_cast<std::size_t>(std::countr_zero(pending));
+        const std::uint64_t posted = m_postedAt[event];
+        m_pending.fetch_and(~(1U << event), std::memory_order_acq_rel);
+
+        const std::uint64_t start = m_timebase.nowCycles();
+        const Slot&         slot  = m_slots[event];
+        if (slot.handler != nullptr)
+        {
+            slot.handler(slot.context);
+        }
+        const std::uint32_t run     = saturate(m_timebase.nowCycles() - start);
+        const std::uint32_t latency = saturate(start - posted);
+
+        EventStats& stats = m_stats[event];
+        stats.dispatched++;
+        stats.latencyTotal += latency;
+        stats.latencyMax = (latency > stats.latencyMax) ? latency : stats.latencyMax;
+        stats.runMax     = (run > stats.runMax) ? run : stats.runMax;
+        return true;
+    }
+
+    /** @brief Dispatch everything pending, then sleep until an interrupt. */
+    void runOnce()
+    {
+        while (dispatchOne())
+        {
+        }
+
+        if (m_idleHook.handler != nullptr)
+        {
+            m_idleHook.handler(m_idleHook.context);
+        }
+
+        const std::uint64_t start = m_timebase.nowUs();
+        TIdle::sleep(m_pending);
+        m_sleptUs += m_timebase.nowUs() - start;
+        m_sleeps++;
+    }
+
+    [[noreturn]] void run()
+    {
+        for (;;)
+        {
+            runOnce();
+        }
+    }
+
+    const EventStats& stats(TEvent t_event) const { return m_stats[index(t_event)]; }
+
+    std::uint32_t sleeps() const { return m_sleeps; }
+    std::uint64_t sleptUs() const { return m_sleptUs; }
+
+    /** @brief Microseconds since timebase start or the last resetStats(). */
+    std::uint64_t statsPeriodUs() const { return m_timebase.nowUs() - m_statsStartUs; }
+
+    void resetStats()
+    {
+        m_stats        = {};
+        m_sleeps       = 0;
+        m_sleptUs      = 0;
+        m_statsStartUs = m_timebase.nowUs();
+    }
+
+  private:
+    struct Slot
+    {
+        EventHandler handler{nullptr};
+        void*        context{nullptr};
+    };
+
+    static constexpr std::size_t index(TEvent t_event) { return static_cast<std::size_t>(t_event); }
+
+    static std::uint32_t saturate(std::uint64_t t_cycles)
+    {
+        return (t_cycles > UINT32_MAX) ? UINT32_MAX : static_cast<std::uint32_t>(t_cycles);
+    }
+
+    const ITimebase&                  m_timebase;
+    std::atomic<std::uint32_t>        m_pending{0};
+    std::array<std::uint64_t, EVENTS> m_postedAt{};
+    std::array<Slot, EVENTS>          m_slots{};
+    Slot                              m_idleHook{};
+    std::array<EventStats, EVENTS>    m_stats{};
+    std::uint32_t                     m_sleeps{0};
+    std::uint64_t                     m_sleptUs{0};
+    std::uint64_t                     m_statsStartUs{0};
+};
+
+#endif // EVENT_LOOP_HPP
@@ -0,0 +1,532 @@
+/**
+ * @file      App/Inc/fmt_log.hpp
+ * @author    it32bit
+ * @brief     Type-safe text logging with format strings checked at compile time.
+ *
+ * @details   Replaces printf on the App's output paths. Placeholders are "{}" with an
+ *            optional spec "{[0][width][.precision][x|X|d]}", "{{" prints '{'. The format
+ *            string is validated by a consteval constructor against the argument types,
+ *            so a wrong count, a hex spec on a float or an unsupported type is a compile
+ *            error. Formatting is a fold over the arguments: no varargs, no heap, no float
+ *            formatter from newlib. Floats are printed as fixed point (default 2 decimals,
+ *            |value| < 2^31) using single-precision FPU arithmetic only.
+ *
+ *            Output is collected in a small stack buffer and handed to Fmt::write(), which
+ *            the App maps to the console TX ring. LOG_<LEVEL>(Module, ...) compiles to
+ *            nothing (arguments included) when Module::level is below the call's level.
+ *            Built with LOG_DEFERRED, the LOG_* macros emit binary records instead
+ *            (defer_log.hpp).
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef FMT_LOG_HPP
+#define FMT_LOG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Fmt
+{
+
+enum class Level : std::uint8_t
+{
+    Off = 0,
+    Error,
+    Warn,
+    Info,
+    Debug,
+};
+
+/** @brief Output of print(); defined by the application (console TX ring on target). */
+void write(const char* t_data, std::size_t t_size);
+
+struct Spec
+{
+    std::uint8_t width{0};
+    std::int8_t  precision{-1};
+    bool         zeroPad{false};
+    char         type{'\0'};
+};
+
+enum class Kind : std::uint8_t
+{
+    Integer,
+    Float,
+    Char,
+    String,
+    Unsupported,
+};
+
+template <typename T>
+consteval Kind kindOf()
+{
+    using U = std::remove_cvref_t<T>;
+
+    if constexpr (std::is_same_v<U, char>)
+    {
+        return Kind::Char;
+    }
+    else if constexpr (std::is_same_v<U, bool>)
+    {
+        return Kind::Unsupported;
+    }
+    else if constexpr (std::is_integral_v<U>)
+    {
+        return Kind::Integer;
+    }
+    else if constexpr (std::is_floating_point_v<U>)
+    {
+        return Kind::Float;
+    }
+    else if constexpr (std::is_convertible_v<U, const char*>)
+    {
+        return Kind::String;
+    }
+    else
+    {
+        return Kind::Unsupported;
+    }
+}
+
+inline constexpr std::size_t BAD_SPEC = static_cast<std::size_t>(-1);
+
+/** @brief Parse the placeholder starting at t_text[t_pos] == '{'; returns the index after '}'. */
+constexpr std::size_t parseSpec(const char* t_text, std::size_t t_pos, Spec& t_spec)
+{
+    std::size_t i = t_pos + 1;
+
+    if (t_text[i] == '0')
+    {
+        t_spec.zeroPad = true;
+        ++i;
+    }
+    while ((t_text[i] >= '0') && (t_text[i] <= '9'))
+    {
+        t_spec.width = static_cast<std::uint8_t>(t_spec.width * 10 + (t_text[i++] - '0'));
+    }
+    if (t_text[i] == '.')
+    {
+        if ((t_text[i + 1] < '0') || (t_text[i + 1] > '6'))
+        {
+            return BAD_SPEC;
+        }
+        t_spec.precision = static_cast<std::int8_t>(t_text[i + 1] - '0');
+        i += 2;
+    }
+    if ((t_text[i] == 'x') || (t_text[i] == 'X') || (t_text[i] == 'd'))
+    {
+        t_spec.type = t_text[i++];
+    }
+    return (t_text[i] == '}') ? (i + 1) : BAD_SPEC;
+}
+
+constexpr bool specFits(Kind t_kind, const Spec& t_spec)
+{
+    switch (t_kind)
+    {
+        case Kind::Integer:
+            return t_spec.precision < 0;
+        case Kind::Float:
+            return t_spec.type == '\0';
+        case Kind::Char:
+        case Kind::String:
+            return (t_spec.type == '\0') && (t_spec.precision < 0) && !t_spec.zeroPad;
+        default:
+            return false;
+    }
+}
+
+// Deliberately not constexpr: reaching it during constant evaluation is the compile error
+inline void formatStringError(const char*) {}
+
+template <typename... Args>
+struct FormatString
+{
+    const char* text;
+
+    template <std::size_t N>
+    consteval FormatString(const char (&t_text)[N]) : text(t_text)
+    {
+        constexpr Kind kinds[] = {kindOf<Args>()..., Kind::Unsupported};
+
+        std::size_t count = 0;
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            if (t_text[i] != '{')
+            {
+                continue;
+            }
+            if (t_text[i + 1] == '{')
+            {
+                ++i;
+                continue;
+            }
+
+            Spec              spec;
+            const std::size_t end = parseSpec(t_text, i, spec);
+            if (end == BAD_SPEC)
+            {
+                formatStringError("malformed placeholder");
+            }
+            if (count == sizeof...(Args))
+            {
+                formatStringError("more placeholders than arguments");
+            }
+            if (!specFits(kinds[count], spec))
+            {
+                formatStringError("placeholder spec does not fit the argument type");
+            }
+            ++count;
+            i = end - 1;
+        }
+
+        if (count != sizeof...(Args))
+        {
+            formatStringError("more arguments than placeholders");
+        }
+    }
+};
+
+/**
+ * @brief Bounded output buffer. With a flush function it is drained when full, otherwise
+ *        the text is truncated (snprintf replacement).
+ */
+class Writer
+{
+  public:
+    using Flush = void (*)(const char*, std::size_t);
+
+    Writer(char* t_buffer, std::size_t t_capacity, Flush t_flush = nullptr)
+        : m_buffer(t_buffer), m_capacity(t_capacity), m_flush(t_flush)
+    {
+    }
+
+    void put(char t_char)
+    {
+        if (m_length == m_capacity)
+        {
+            if (m_flush == nullptr)
+            {
+                return;
+            }
+            flush();
+        }
+        m_buffer[m_length++] = t_char;
+    }
+
+    void put(const char* t_text, std::size_t t_length)
+    {
+        while (t_length != 0)
+        {
+            if (m_length == m_capacity)
+            {
+                if (m_flush == nullptr)
+                {
+                    return;
+                }
+                flush();
+            }
+            const std::size_t room  = m_capacity - m_length;
+            const std::size_t chunk = (t_length < room) ? t_length : room;
+            std::memcpy(m_buffer + m_length, t_text, chunk);
+            m_length += chunk;
+            t_text += chunk;
+            t_length -= chunk;
+        }
+    }
+
+    void flush()
+    {
+        if ((m_flush != nullptr) && (m_length != 0))
+        {
+            m_flush(m_buffer, m_length);
+        }
+        m_total += m_length;
+        m_length = 0;
+    }
+
+    /** @brief Characters produced so far (excluding truncated ones). */
+    std::size_t size() const { return m_total + m_length; }
+
+  private:
+    char*       m_buffer;
+    std::size_t m_capacity;
+    Flush       m_flush;
+    std::size_t m_length{0};
+    std::size_t m_total{0};
+};
+
+namespace Detail
+{
+
+inline void putPadded(Writer& t_out, bool t_negative, const char* t_body, std::size_t t_length,
+                      const Spec& t_spec)
+{
+    std::size_t total = t_length + (t_negative ? 1 : 0);
+    std::size_t pad   = (t_spec.width > total) ? (t_spec.width - total) : 0;
+
+    if (t_spec.zeroPad)
+    {
+        if (t_negative)
+        {
+            t_out.put('-');
+        }
+        while (pad-- > 0)
+        {
+            t_out.put('0');
+        }
+    }
+    else
+    {
+        while (pad-- > 0)
+        {
+            t_out.put(' ');
+        }
+        if (t_negative)
+        {
+            t_out.put('-');
+        }
+    }
+    t_out.put(t_body, t_length);
+}
+
+// Digits of t_value into the end of t_buffer; returns the first used index. The bases are
+// constants so division by 10 becomes a multiply and hex a shift.
+template <typename U>
+std::size_t toDecimal(U t_value, char* t_buffer, std::size_t t_size)
+{
+    std::size_t pos = t_size;
+    do
+    {
+        t_buffer[--pos] = static_cast<char>('0' + (t_value % 10));
+        t_value /= 10;
+    } while (t_value != 0);
+    return pos;
+}
+
+template <typename U>
+std::size_t toHex(U t_value, bool t_upper, char* t_buffer, std::size_t t_size)
+{
+    const char* digits = t_upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    std::size_t pos = t_size;
+    do
+    {
+        t_buffer[--pos] = digits[t_value & 0xF];
+        t_value >>= 4;
+    } while (t_value != 0);
+    return pos;
+}
+
+template <typename T>
+void formatInteger(Writer& t_out, T t_value, const Spec& t_spec)
+{
+    // 32-bit division is a single UDIV on Cortex-M4; only 64-bit arguments pay for more
+    using Unsigned = std::conditional_t<(sizeof(T) <= 4), std::uint32_t, std::uint64_t>;
+
+    const bool hex      = (t_spec.type == 'x') || (t_spec.type == 'X');
+    bool       negative = false;
+    Unsigned   value    = static_cast<Unsigned>(t_value);
+
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (!hex && (t_value < 0))
+        {
+            negative = true;
+            value    = Unsigned{0} - static_cast<Unsigned>(t_value);
+        }
+        else if (hex)
+        {
+            value = static_cast<std::make_unsigned_t<T>>(t_value);
+        }
+    }
+
+    char              buffer[24];
+    const std::size_t first = hex ? toHex(value, t_spec.type == 'X', buffer, sizeof(buffer))
+                                  : toDecimal(value, buffer, sizeof(buffer));
+    putPadded(t_out, negative, buffer + first, sizeof(buffer) - first, t_spec);
+}
+
+inline void formatFloat(Writer& t_out, float t_value, const Spec& t_spec)
+{
+    static constexpr std::uint32_t POW10[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+
+    const unsigned precision = (t_spec.precision < 0) ? 2U : static_cast<unsigned>(t_spec.precision);
+    const bool     negative  = t_value < 0.0F;
+    const float    magnitude = negative ? -t_value : t_value;
+
+    if (!(magnitude < 2147483648.0F)) // Also catches NaN
+    {
+        putPadded(t_out, false, (magnitude == magnitude) ? "ovf" : "nan", 3, Spec{t_spec.width});
+        return;
+    }
+
+    std::uint32_t integer  = static_cast<std::uint32_t>(magnitude);
+    std::uint32_t fraction = static_cast<std::uint32_t>(
+        (magnitude - static_cast<float>(integer)) * static_cast<float>(POW10[precision]) + 0.5F);
+    if (fraction >= POW10[precision])
+    {
+        ++integer;
+        fraction -= POW10[precision];
+    }
+
+    char        buffer[20];
+    std::size_t pos = sizeof(buffer);
+    for (unsigned i = 0; i < precision; ++i)
+    {
+        buffer[--pos] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
+    if (precision != 0)
+    {
+        buffer[--pos] = '.';
+    }
+    pos = toDecimal(integer, buffer, pos);
+
+    putPadded(t_out, negative, buffer + pos, sizeof(buffer) - pos, t_spec);
+}
+
+template <typename T>
+void formatArgument(Writer& t_out, const T& t_value, const Spec& t_spec)
+{
+    constexpr Kind kind = kindOf<T>();
+
+    if constexpr (kind == Kind::Char)
+    {
+        putPadded(t_out, false, &t_value, 1, t_spec);
+    }
+    else if constexpr (kind == Kind::Integer)
+    {
+        formatInteger(t_out, t_value, t_spec);
+    }
+    else if constexpr (kind == Kind::Float)
+    {
+        formatFloat(t_out, static_cast<float>(t_value), t_spec);
+    }
+    else
+    {
+        const char* text   = (t_value != nullptr) ? static_cast<const char*>(t_value) : "(null)";
+        std::size_t length = 0;
+        while (text[length] != '\0')
+        {
+            ++length;
+        }
+        putPadded(t_out, false, text, length, t_spec);
+    }
+}
+
+// Copy literal text up to the next placeholder; returns its position or the terminator
+inline const char* copyLiteral(Writer& t_out, const char* t_text)
+{
+    for (;;)
+    {
+        const char* end = t_text;
+        while ((*end != '\0') && (*end != '{'))
+        {
+            ++end;
+        }
+        t_out.put(t_text, static_cast<std::size_t>(end - t_text));
+
+        if ((*end == '\0') || (end[1] != '{'))
+        {
+            return end;
+        }
+        t_out.put('{'); // "{{"
+        t_text = end + 2;
+    }
+}
+
+template <typename T>
+void formatNext(Writer& t_out, const char*& t_text, const T& t_value)
+{
+    t_text = copyLiteral(t_out, t_text);
+
+    Spec              spec;
+    const std::size_t end = parseSpec(t_text, 0, spec); // Validated at compile time
+    formatArgument(t_out, t_value, spec);
+    t_text += end;
+}
+
+} // namespace Detail
+
+/** @brief Format into t_out; the format string was checked against Args at compile time. */
+template <typename... Args>
+void formatTo(Writer& t_out, FormatString<std::type_identity_t<Args>...> t_format,
+              const Args&... t_args)
+{
+    const char* text = t_format.text;
+    (Detail::formatNext(t_out, text, t_args), ...);
+    Detail::copyLiteral(t_out, text);
+}
+
+/**
+ * @brief snprintf() replacement: always terminates, returns the formatted length.
+ *        A zero-sized buffer is left untouched and 0 is returned.
+ */
+template <typename... Args>
+std::size_t format(char* t_buffer, std::size_t t_size,
+                   FormatString<std::type_identity_t<Args>...> t_format, const Args&... t_args)
+{
+    if (t_size == 0)
+    {
+        return 0; // No room even for the terminator
+    }
+
+    Writer out(t_buffer, t_size - 1);
+    formatTo(out, t_format, t_args...);
+
+    const std::size_t length = out.size();
+    t_buffer[length]         = '\0';
+    return length;
+}
+
+/** @brief Format to Fmt::write() through a 64 B stack buffer. */
+template <typename... Args>
+void print(FormatString<std::type_identity_t<Args>...> t_format, const Args&... t_args)
+{
+    char   buffer[64];
+    Writer out(buffer, sizeof(buffer), &write);
+    formatTo(out, t_format, t_args...);
+    out.flush();
+}
+
+} // namespace Fmt
+
+/**
+ * @brief Declare a log module with its compile-time level, e.g. LOG_MODULE(AppLog, Info);
+ */
+#define LOG_MODULE(t_name, t_level)                                                                \
+    struct t_name                                                                                  \
+    {                                                                                              \
+        static constexpr ::Fmt::Level level = ::Fmt::Level::t_level;                               \
+    }
+
+#if defined(LOG_DEFERRED)
+// Binary records rendered on the host (defer_log.hpp, Tools/defer_log_decode.cpp)
+#define LOG_AT(t_module, t_level, ...) DLOG_AT(t_module, t_level, __VA_ARGS__)
+#else
+#define LOG_AT(t_module, t_level, ...)                                                             \
+    do                                                                                             \
+    {                                                                                              \
+        if constexpr (t_module::level >= ::Fmt::Level::t_level)                                    \
+        {                                                                                          \
+            ::Fmt::print(__VA_ARGS__);                                                             \
+        }                                                                                          \
+    } while (0)
+#endif
+
+#define LOG_ERROR(t_module, ...) LOG_AT(t_module, Error, __VA_ARGS__)
+#define LOG_WARN(t_module, ...)  LOG_AT(t_module, Warn, __VA_ARGS__)
+#define LOG_INFO(t_module, ...)  LOG_AT(t_module, Info, __VA_ARGS__)
+#define LOG_DEBUG(t_module, ...) LOG_AT(t_module, Debug, __VA_ARGS__)
+
+#if defined(LOG_DEFERRED)
+#include "defer_log.hpp"
+#endif
+
+#endif // FMT_LOG_HPP
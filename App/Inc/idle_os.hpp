@@ -0,0 +1,45 @@
+/**
+ * @file      App/Inc/idle_os.hpp
+ * @author    it32bit
+ * @brief     Idle policy for an EventLoop that runs as a PilOs task: block on a semaphore.
+ *
+ * @details   sleep() takes a binary semaphore when no event is pending, so the loop task
+ *            yields the CPU to other tasks and the idle task (which does the WFI). The
+ *            loop's post() calls wake() when it sets the first pending bit; a give that
+ *            lands between the pending check and the take leaves the count at 1, so the
+ *            take returns at once and no post() is missed. A count left over from a post
+ *            the loop picked up while running costs one extra pass through runOnce().
+ *
+ *            EventLoop::sleptUs() then counts the time the loop was blocked, including
+ *            time the CPU spent in other tasks.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef IDLE_OS_HPP
+#define IDLE_OS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include "pil_os.hpp"
+
+struct IdleBlock_Os
+{
+    static void sleep(const std::atomic<std::uint32_t>& t_pending)
+    {
+        if (t_pending.load(std::memory_order_acquire) == 0)
+        {
+            m_wakeup.take();
+        }
+    }
+
+    /** @brief Called by post() for the first pending event. Any context. */
+    static void wake() { m_wakeup.give(); }
+
+  private:
+    static inline Os::Semaphore m_wakeup{0, 1};
+};
+
+#endif // IDLE_OS_HPP
@@ -1,39 +1,145 @@
 #ifndef DESIGN_PATTERNS
 #define DESIGN_PATTERNS
 
-#include <list>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <stdint-gcc.h>
 
 /**
  * @brief Design Patterns: Observer
  *
  * @note Contain classes: Observer, Subject
+ *
+ *       Registration never allocates: a Subject has MAX_OBSERVERS fixed slots and, for
+ *       each of the 32 event bits (e.g. EXTI lines), a byte of the slots subscribed to
+ *       it. notifyObservers() takes the pending bits one by one with __builtin_ctz,
+ *       ORs their slot bytes and calls each of those observers once, in slot order
+ *       (registration order until a slot is freed). An event bit only visits its own
+ *       subscribers; a bit nobody subscribed to costs one AND.
+ *
+ *       notifyObservers() may run in an ISR while the main context registers or
+ *       unregisters. There are no links to follow: a slot is published with a release
+ *       store after the observer is complete, and unregistering clears the index before
+ *       the slot, so an observer re-registered during a notification never hides the
+ *       others. A notification already past the index may still call an observer once
+ *       after unregisterObserver() returned, or skip one registered meanwhile.
+ *       Registrations must not race each other, and an Observer must stay alive while
+ *       it is registered.
  */
 class Observer
 {
   public:
+    static constexpr uint32_t ALL_EVENTS = 0xFFFFFFFF;
+
     virtual void notify(uint32_t t_mask) const = 0;
 
     virtual ~Observer() = default;
+
+  private:
+    friend class Subject;
+
+    std::atomic<uint32_t> m_subscription{0};
+    bool                  m_registered{false};
 };
 
 class Subject
 {
   public:
-    void registerObserver(Observer* t_observer) { m_observers.push_back(t_observer); }
+    static constexpr size_t MAX_OBSERVERS = 8;
+    static constexpr size_t EVENT_BITS    = 32;
+
+    /** @brief Subscribe t_observer to events intersecting t_mask; false when full. */
+    bool registerObserver(Observer* t_observer, uint32_t t_mask = Observer::ALL_EVENTS)
+    {
+        if (t_observer->m_registered)
+        {
+            return false;
+        }
+
+        size_t slot = 0;
+        while ((slot < MAX_OBSERVERS) && (m_slots[slot].load(std::memory_order_relaxed) != nullptr))
+        {
+            ++slot;
+        }
+        if (slot == MAX_OBSERVERS)
+        {
+            return false;
+        }
+
+        t_observer->m_subscription.store(t_mask, std::memory_order_relaxed);
+        t_observer->m_registered = true;
+        m_slots[slot].store(t_observer, std::memory_order_release); // Complete before visible
+
+        for (uint32_t bits = t_mask; bits != 0; bits &= bits - 1)
+        {
+            std::atomic<SlotMask>& index = m_index[__builtin_ctz(bits)];
+            index.store(index.load(std::memory_order_relaxed) | static_cast<SlotMask>(1u << slot),
+                        std::memory_order_release);
+        }
 
-    void unregisterObserver(Observer* t_observer) { m_observers.remove(t_observer); }
+        m_subscribed.store(m_subscribed.load(std::memory_order_relaxed) | t_mask,
+                           std::memory_order_release);
+        return true;
+    }
+
+    void unregisterObserver(Observer* t_observer)
+    {
+        for (size_t slot = 0; slot < MAX_OBSERVERS; ++slot)
+        {
+            if (m_slots[slot].load(std::memory_order_relaxed) != t_observer)
+            {
+                continue;
+            }
+
+            // Index first: a notification starting from here on no longer picks the slot
+            uint32_t subscribed = 0;
+            for (size_t bit = 0; bit < EVENT_BITS; ++bit)
+            {
+                const auto slots = static_cast<SlotMask>(
+                    m_index[bit].load(std::memory_order_relaxed) & ~(1u << slot));
+                m_index[bit].store(slots, std::memory_order_release);
+                if (slots != 0)
+                {
+                    subscribed |= 1u << bit;
+                }
+            }
+            m_subscribed.store(subscribed, std::memory_order_release);
+
+            m_slots[slot].store(nullptr, std::memory_order_release);
+            t_observer->m_registered = false;
+        }
+    }
 
     void notifyObservers(uint32_t t_data) const
     {
-        for (auto* observer : m_observers)
+        SlotMask slots = 0;
+        for (uint32_t bits = m_subscribed.load(std::memory_order_acquire) & t_data; bits != 0;
+             bits &= bits - 1)
+        {
+            slots |= m_index[__builtin_ctz(bits)].load(std::memory_order_acquire);
+        }
+
+        for (uint32_t pending = slots; pending != 0; pending &= pending - 1)
         {
-            observer->notify(t_data);
+            // Freed or reused since the index was read: the subscription decides
+            const Observer* observer =
+                m_slots[__builtin_ctz(pending)].load(std::memory_order_acquire);
+            if ((observer != nullptr) &&
+                ((observer->m_subscription.load(std::memory_order_relaxed) & t_data) != 0))
+            {
+                observer->notify(t_data);
+            }
         }
     }
 
   private:
-    std::list<Observer*> m_observers;
+    using SlotMask = uint8_t; // Bit n: slot n
+    static_assert(MAX_OBSERVERS <= 8 * sizeof(SlotMask), "One bit per slot");
+
+    std::array<std::atomic<Observer*>, MAX_OBSERVERS> m_slots{};
+    std::array<std::atomic<SlotMask>, EVENT_BITS>     m_index{}; // Slots subscribed per event bit
+    std::atomic<uint32_t>                             m_subscribed{0}; // Bits with a subscriber
 };
 
 /**
@@ -72,4 +178,24 @@ class StaticObserverList
     size_t m_size;
 };
 
+/**
+ * @brief Design Pattern: Observer resolved at compile time
+ *
+ * @note  Callbacks are template arguments, so notifyAll() expands to direct calls that
+ *        inline into the caller (e.g. an ISR): no table, no null checks, no heap.
+ */
+template <auto... TCallbacks>
+struct StaticObservers
+{
+    static constexpr size_t count = sizeof...(TCallbacks);
+
+    template <typename T>
+    static void notifyAll([[maybe_unused]] T value) noexcept
+    {
+        (TCallbacks(value), ...);
+    }
+};
+
+using NoObservers = StaticObservers<>;
+
 #endif // DESIGN_PATTERNS
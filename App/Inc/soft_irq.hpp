@@ -0,0 +1,262 @@
+/**
+ * @file      App/Inc/soft_irq.hpp
+ * @author    it32bit
+ * @brief     Deferred interrupt work (bottom halves): lock-free per-level queues drained
+ *            at the lowest exception priority.
+ *
+ * @details   TSource is an enum whose values 0..TSource::Count-1 name the bottom halves;
+ *            each is subscribed with a handler and a level, 0 being the most urgent of
+ *            TLevels. An ISR (the top half) reads its device, calls post() with up to 32
+ *            bits of data and returns; post() queues {source, data} on the source's level
+ *            and calls TPend::pend() (e.g. SoftIrqPendSV_STM32, which pends PendSV). The
+ *            pended context calls drain(), which runs the oldest item of the most urgent
+ *            non-empty level, re-checking from level 0 after every item so urgent work
+ *            posted meanwhile overtakes the rest.
+ *
+ *            Each level is a bounded multi-producer / single-consumer queue of TDepth
+ *            cells with a sequence number per cell: a producer claims a cell with one CAS
+ *            on the tail (LDREX/STREX on Cortex-M4), fills it and publishes it with a
+ *            release store of its sequence, so ISRs of any priority may post without
+ *            masking interrupts. drain() stops at a claimed but unpublished cell; when it
+ *            runs at the lowest priority every interrupted producer has finished first.
+ *            A post to a full level is dropped and counted, and returns false.
+ *
+ *            Every run is timed in timebase cycles into a log2 histogram per source:
+ *            bucket b counts runs of [2^(b-1), 2^b) cycles, the last one everything longer.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef SOFT_IRQ_HPP
+#define SOFT_IRQ_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "pil_timebase.hpp"
+
+using SoftIrqHandler = void (*)(void* t_context, std::uint32_t t_data);
+
+inline constexpr std::size_t SOFT_IRQ_BUCKETS = 16;
+
+struct SoftIrqStats
+{
+    std::uint32_t                               runs{0};
+    std::uint32_t                               dropped{0}; // Posts that found the level full
+    std::uint32_t                               runMax{0};  // Cycles
+    std::array<std::uint32_t, SOFT_IRQ_BUCKETS> histogram{};
+};
+
+template <class TSource, class TPend, std::size_t TLevels = 2, std::size_t TDepth = 16>
+class SoftIrq
+{
+    static constexpr std::size_t SOURCES = static_cast<std::size_t>(TSource::Count);
+
+    static_assert((SOURCES >= 1) && (SOURCES <= 256), "Sources are stored in one byte");
+    static_assert((TLevels >= 1) && (TLevels <= 8), "1 to 8 levels");
+    static_assert((TDepth >= 2) && ((TDepth & (TDepth - 1)) == 0), "TDepth: a power of two");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "post() runs in interrupts");
+
+  public:
+    explicit SoftIrq(const ITimebase& t_timebase) : m_timebase(t_timebase) {}
+
+    SoftIrq(const SoftIrq&)            = delete;
+    SoftIrq& operator=(const SoftIrq&) = delete;
+
+    /** @brief Set the bottom half of t_source; before its first post(). Thread mode only. */
+    void subscribe(TSource t_source, SoftIrqHandler t_handler, void* t_context = nullptr,
+                   std::size_t t_level = TLevels - 1)
+    {
+        m_slots[index(t_source)] = {t_handler, t_context,
+                                    static_cast<std::uint8_t>((t_level < TLevels) ? t_level
+                                                                                  : TLevels - 1)};
+    }
+
+    /** @brief Queue t_source's bottom half with t_data and pend the drain. Any context. */
+    bool post(TSource t_source, std::uint32_t t_data = 0)
+    {
+        if (!m_levels[m_slots[index(t_source)].level].push(
+                static_cast<std::uint8_t>(index(t_source)), t_data))
+        {
+            m_dropped[index(t_source)].fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        TPend::pend();
+        return true;
+    }
+
+    /** @brief Run every queued item, most urgent level first. The pended context only. */
+    void drain()
+    {
+        Item item;
+        while (pop(item))
+        {
+            const std::uint64_t start = m_timebase.nowCycles();
+            const Slot&         slot  = m_slots[item.source];
+            if (slot.handler != nullptr)
+            {
+                slot.handler(slot.context, item.data);
+            }
+            record(item.source, m_timebase.nowCycles() - start);
+        }
+    }
+
+    /** @brief Items queued on t_level now, and the most ever queued. */
+    std::size_t queued(std::size_t t_level) const { return m_levels[t_level].size(); }
+    std::size_t peak(std::size_t t_level) const { return m_levels[t_level].peak(); }
+
+    SoftIrqStats stats(TSource t_source) const
+    {
+        SoftIrqStats stats = m_stats[index(t_source)];
+        stats.dropped      = m_dropped[index(t_source)].load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void resetStats()
+    {
+        m_stats = {};
+        for (auto& dropped : m_dropped)
+        {
+            dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    struct Slot
+    {
+        SoftIrqHandler handler{nullptr};
+        void*          context{nullptr};
+        std::uint8_t   level{TLevels - 1};
+    };
+
+    struct Item
+    {
+        std::uint8_t  source{0};
+        std::uint32_t data{0};
+    };
+
+    class Queue
+    {
+      public:
+        Queue()
+        {
+            for (std::uint32_t i = 0; i < TDepth; ++i)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool push(std::uint8_t t_source, std::uint32_t t_data)
+        {
+            std::uint32_t position = m_tail.load(std::memory_order_relaxed);
+            Cell*         cell     = nullptr;
+            for (;;)
+            {
+                cell = &m_cells[position & (TDepth - 1)];
+                const auto lag = static_cast<std::int32_t>(
+                    cell->sequence.load(std::memory_order_acquire) - position);
+                if (lag == 0)
+                {
+                    if (m_tail.compare_exchange_weak(position, position + 1,
+                                                     std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    return false; // The consumer has not freed this cell yet: full
+                }
+                else
+                {
+                    position = m_tail.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->item = {t_source, t_data};
+            cell->sequence.store(position + 1, std::memory_order_release);
+
+            const std::uint32_t depth = position + 1 - m_head.load(std::memory_order_relaxed);
+            if (depth > m_peak.load(std::memory_order_relaxed))
+            {
+                m_peak.store(depth, std::memory_order_relaxed); // Approximate under contention
+            }
+            return true;
+        }
+
+        bool pop(Item& t_item)
+        {
+            const std::uint32_t head = m_head.load(std::memory_order_relaxed);
+            Cell&               cell = m_cells[head & (TDepth - 1)];
+            if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+            {
+                return false; // Empty, or the next cell is claimed but not yet published
+            }
+
+            t_item = cell.item;
+            cell.sequence.store(head + TDepth, std::memory_order_release);
+            m_head.store(head + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        std::size_t size() const
+        {
+            return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed);
+        }
+
+        std::size_t peak() const { return m_peak.load(std::memory_order_relaxed); }
+
+      private:
+        struct Cell
+        {
+            std::atomic<std::uint32_t> sequence{0};
+            Item                       item{};
+        };
+
+        std::array<Cell, TDepth>   m_cells{};
+        std::atomic<std::uint32_t> m_tail{0};
+        std::atomic<std::uint32_t> m_head{0};
+        std::atomic<std::uint32_t> m_peak{0};
+    };
+
+    static constexpr std::size_t index(TSource t_source)
+    {
+        return static_cast<std::size_t>(t_source);
+    }
+
+    bool pop(Item& t_item)
+    {
+        for (Queue& level : m_levels)
+        {
+            if (level.pop(t_item))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void record(std::uint8_t t_source, std::uint64_t t_cycles)
+    {
+        const std::uint32_t run =
+            (t_cycles > UINT32_MAX) ? UINT32_MAX : static_cast<std::uint32_t>(t_cycles);
+        const std::size_t bucket = static_cast<std::size_t>(std::bit_width(run));
+
+        SoftIrqStats& stats = m_stats[t_source];
+        stats.runs++;
+        stats.runMax = (run > stats.runMax) ? run : stats.runMax;
+        stats.histogram[(bucket < SOFT_IRQ_BUCKETS) ? bucket : SOFT_IRQ_BUCKETS - 1]++;
+    }
+
+    const ITimebase&                                m_timebase;
+    std::array<Slot, SOURCES>                       m_slots{};
+    std::array<Queue, TLevels>                      m_levels{};
+    std::array<SoftIrqStats, SOURCES>               m_stats{};
+    std::array<std::atomic<std::uint32_t>, SOURCES> m_dropped{};
+};
+
+#endif // SOFT_IRQ_HPP
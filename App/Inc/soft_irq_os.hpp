@@ -0,0 +1,34 @@
+/**
+ * @file      App/Inc/soft_irq_os.hpp
+ * @author    it32bit
+ * @brief     Pend policy for SoftIrq under APP_RTOS: drain in the highest-priority task.
+ *
+ * @details   The PilOs port owns PendSV for its context switch, so the bottom halves run
+ *            in a task instead, blocked in wait() until pend() gives its binary semaphore.
+ *            The give readies the task and pends the switch from the ISR; the task runs
+ *            once no handler is active and preempts every other task, which keeps the
+ *            PendSV ordering: hardware interrupts first, then bottom halves, then tasks.
+ *            The top half pays for the give, some hundred cycles more than a PendSV pend.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef SOFT_IRQ_OS_HPP
+#define SOFT_IRQ_OS_HPP
+
+#include "pil_os.hpp"
+
+struct SoftIrqPend_Os
+{
+    static void pend() { m_pending.give(); }
+
+    /** @brief Block the draining task until something was posted. */
+    static void wait() { m_pending.take(); }
+
+  private:
+    static inline Os::Semaphore m_pending{0, 1};
+};
+
+#endif // SOFT_IRQ_OS_HPP
@@ -0,0 +1,321 @@
+/**
+ * @file      App/Inc/timer_wheel.hpp
+ * @author    it32bit
+ * @brief     Hierarchical timer wheel for software timers with statically allocated nodes.
+ *
+ * @details   TLevels levels of 64 slots. A timer due in d ticks sits in level k when
+ *            64^k <= d < 64^(k+1), in the slot of its expiry's k-th 6-bit digit; when the
+ *            wheel time reaches the start of that slot's 64^k-tick block, the slot is
+ *            cascaded one level down, until the timer fires from level 0. Timers further
+ *            out than 64^TLevels ticks park in the top level and cascade again.
+ *
+ *            SoftTimer nodes are owned by the caller (globals or members) and linked into
+ *            the slots intrusively: start and stop are O(1) and nothing is allocated.
+ *            Per-level occupancy bitmaps make ticksToNextEvent() O(TLevels), so a
+ *            tickless caller can program a hardware compare for the next due tick and
+ *            let advanceTo() jump over empty ticks instead of being interrupted on each.
+ *
+ *            Ticks are free-running 32-bit values compared by difference, so the wheel
+ *            time may wrap; expiries must stay within 2^31 ticks of now(). Callbacks run
+ *            in the caller of advanceTo() and may start or stop any timer, their own
+ *            included. A periodic timer is re-armed from its expiry, so it does not drift
+ *            when advanceTo() is called late. Not thread safe: use one context.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+using SoftTimerCallback = void (*)(void* t_context);
+
+template <std::size_t TLevels>
+class TimerWheel;
+
+struct SoftTimerLink
+{
+    SoftTimerLink* next{nullptr};
+    SoftTimerLink* prev{nullptr};
+};
+
+class SoftTimer : private SoftTimerLink
+{
+  public:
+    SoftTimer() = default;
+
+    SoftTimer(const SoftTimer&)            = delete;
+    SoftTimer& operator=(const SoftTimer&) = delete;
+
+    bool          isActive() const { return next != nullptr; }
+    std::uint32_t expires() const { return m_expires; }
+    std::uint32_t period() const { return m_period; }
+
+  private:
+    template <std::size_t TLevels>
+    friend class TimerWheel;
+
+    std::uint32_t     m_expires{0};
+    std::uint32_t     m_period{0};
+    SoftTimerCallback m_callback{nullptr};
+    void*             m_context{nullptr};
+    std::uint16_t     m_slot{0}; // level * 64 + slot, or DETACHED while being fired
+};
+
+template <std::size_t TLevels = 4>
+class TimerWheel
+{
+    static constexpr std::size_t   SLOT_BITS = 6;
+    static constexpr std::size_t   SLOTS     = std::size_t{1} << SLOT_BITS;
+    static constexpr std::uint32_t SLOT_MASK = SLOTS - 1;
+
+    static_assert((TLevels >= 1) && (TLevels * SLOT_BITS <= 30), "Range must fit 2^30 ticks");
+
+  public:
+    static constexpr std::uint32_t NO_EVENT = UINT32_MAX;
+
+    /** @brief Ticks covered without parking; later expiries cascade more than once. */
+    static constexpr std::uint32_t RANGE = std::uint32_t{1} << (TLevels * SLOT_BITS);
+
+    explicit TimerWheel(std::uint32_t t_now = 0) : m_now(t_now)
+    {
+        for (SoftTimerLink& head : m_heads)
+        {
+            head.next = &head;
+            head.prev = &head;
+        }
+    }
+
+    TimerWheel(const TimerWheel&)            = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    std::uint32_t now() const { return m_now; }
+
+    /**
+     * @brief (Re)start t_timer to fire at tick t_expires, then every t_period ticks if
+     *        not 0. An expiry not after now() fires on the next tick.
+     */
+    void startAt(SoftTimer& t_timer, std::uint32_t t_expires, SoftTimerCallback t_callback,
+                 void* t_context, std::uint32_t t_period = 0)
+    {
+        stop(t_timer);
+
+        const std::uint32_t delta = t_expires - m_now;
+        t_timer.m_expires  = ((delta == 0) || (delta > INT32_MAX)) ? (m_now + 1) : t_expires;
+        t_timer.m_period   = t_period;
+        t_timer.m_callback = t_callback;
+        t_timer.m_context  = t_context;
+        insert(t_timer);
+    }
+
+    /** @brief (Re)start t_timer t_delay ticks from now() (at least one). */
+    void start(SoftTimer& t_timer, std::uint32_t t_delay, SoftTimerCallback t_callback,
+               void* t_context, std::uint32_t t_period = 0)
+    {
+        startAt(t_timer, m_now + t_delay, t_callback, t_context, t_period);
+    }
+
+    void stop(SoftTimer& t_timer)
+    {
+        if (!t_timer.isActive())
+        {
+            return;
+        }
+        t_timer.prev->next = t_timer.next;
+        t_timer.next->prev = t_timer.prev;
+        t_timer.next       = nullptr;
+        t_timer.prev       = nullptr;
+        m_active--;
+
+        const std::uint16_t slot = t_timer.m_slot;
+        if ((slot != DETACHED) && (m_heads[slot].next == &m_heads[slot]))
+        {
+            m_occupied[slot / SLOTS] &= ~(std::uint64_t{1} << (slot % SLOTS));
+        }
+    }
+
+    std::size_t active() const { return m_active; }
+
+    /**
+     * @brief Ticks after now() at which advanceTo() has work: an expiry, or a cascade of
+     *        an occupied slot (never later than the expiries in it). NO_EVENT when empty.
+     */
+    std::uint32_t ticksToNextEvent() const
+    {
+        std::uint32_t next = NO_EVENT;
+
+        // Level 0 holds expiries now+1 .. now+63 (slot now & 63 is done)
+        const std::uint32_t first  = (m_now + 1) & SLOT_MASK;
+        const std::uint64_t level0 = std::rotr(m_occupied[0], static_cast<int>(first));
+        if (level0 != 0)
+        {
+            next = 1 + static_cast<std::uint32_t>(std::countr_zero(level0));
+        }
+
+        for (std::size_t level = 1; level < TLevels; ++level)
+        {
+            const std::size_t shift = level * SLOT_BITS;
+
+            // A level-k slot cascades when its 64^k-tick block starts; the next block
+            // start is boundary, later ones follow every 64^k ticks
+            const std::uint32_t boundary = ((m_now >> shift) + 1) << shift;
+            const std::uint32_t slot     = (boundary >> shift) & SLOT_MASK;
+            const std::uint64_t occupied = std::rotr(m_occupied[level], static_cast<int>(slot));
+            if (occupied != 0)
+            {
+                const std::uint32_t ahead =
+                    (boundary - m_now) +
+                    (static_cast<std::uint32_t>(std::countr_zero(occupied)) << shift);
+                next = (ahead < next) ? ahead : next;
+            }
+        }
+        return next;
+    }
+
+    /**
+     * @brief Move the wheel time to t_now (at most 2^31 ticks ahead), firing every timer
+     *        due on the way in expiry order. Empty ticks are skipped. Returns the number
+     *        of callbacks run.
+     */
+    std::size_t advanceTo(std::uint32_t t_now)
+    {
+        std::size_t fired = 0;
+
+        for (;;)
+        {
+            const std::uint32_t remaining = t_now - m_now;
+            const std::uint32_t step      = ticksToNextEvent();
+            if ((remaining == 0) || (step > remaining))
+            {
+                m_now = t_now;
+                return fired;
+            }
+            m_now += step;
+            fired += processTick();
+        }
+    }
+
+  private:
+    static constexpr std::uint16_t DETACHED = UINT16_MAX;
+
+    static void link(SoftTimerLink& t_head, SoftTimerLink& t_node)
+    {
+        t_node.next       = &t_head;
+        t_node.prev       = t_head.prev;
+        t_head.prev->next = &t_node;
+        t_head.prev       = &t_node;
+    }
+
+    void insert(SoftTimer& t_timer)
+    {
+        std::uint32_t delta   = t_timer.m_expires - m_now;
+        std::uint32_t expires = t_timer.m_expires;
+        if (delta >= RANGE)
+        {
+            // Park at the far end of the top level; the cascade re-inserts it
+            delta   = RANGE - 1;
+            expires = m_now + delta;
+        }
+
+        std::size_t level = 0;
+        while ((level + 1 < TLevels) && (delta >= (std::uint32_t{1} << ((level + 1) * SLOT_BITS))))
+        {
+            ++level;
+        }
+
+        const std::size_t slot = (expires >> (level * SLOT_BITS)) & SLOT_MASK;
+        t_timer.m_slot         = static_cast<std::uint16_t>(level * SLOTS + slot);
+        link(m_heads[t_timer.m_slot], t_timer);
+        m_occupied[level] |= std::uint64_t{1} << slot;
+        m_active++;
+    }
+
+    // Move a whole slot to t_list; its timers are marked DETACHED but stay active
+    void detach(std::size_t t_index, SoftTimerLink& t_list)
+    {
+        SoftTimerLink& head = m_heads[t_index];
+        t_list.next         = &t_list;
+        t_list.prev         = &t_list;
+        if (head.next != &head)
+        {
+            t_list.next     = head.next;
+            t_list.prev     = head.prev;
+            head.next->prev = &t_list;
+            head.prev->next = &t_list;
+            head.next       = &head;
+            head.prev       = &head;
+        }
+        m_occupied[t_index / SLOTS] &= ~(std::uint64_t{1} << (t_index % SLOTS));
+
+        for (SoftTimerLink* node = t_list.next; node != &t_list; node = node->next)
+        {
+            static_cast<SoftTimer*>(node)->m_slot = DETACHED;
+        }
+    }
+
+    // Unlink the first timer of a detached list; it is still counted as active
+    static SoftTimer* pop(SoftTimerLink& t_list)
+    {
+        SoftTimerLink* node = t_list.next;
+        if (node == &t_list)
+        {
+            return nullptr;
+        }
+        t_list.next      = node->next;
+        node->next->prev = &t_list;
+        return static_cast<SoftTimer*>(node);
+    }
+
+    std::size_t processTick()
+    {
+        SoftTimerLink list;
+
+        // Cascade every level whose block starts at this tick, top down
+        for (std::size_t level = TLevels - 1; level >= 1; --level)
+        {
+            const std::size_t shift = level * SLOT_BITS;
+            if ((m_now & ((std::uint32_t{1} << shift) - 1)) != 0)
+            {
+                continue;
+            }
+            detach(level * SLOTS + ((m_now >> shift) & SLOT_MASK), list);
+            while (SoftTimer* timer = pop(list))
+            {
+                m_active--;
+                insert(*timer);
+            }
+        }
+
+        std::size_t fired = 0;
+        detach(m_now & SLOT_MASK, list);
+        while (SoftTimer* timer = pop(list))
+        {
+            // Inactive before the callback, so it can restart or stop itself
+            timer->next = nullptr;
+            timer->prev = nullptr;
+            m_active--;
+
+            if (timer->m_period != 0)
+            {
+                timer->m_expires += timer->m_period;
+                insert(*timer);
+            }
+            timer->m_callback(timer->m_context);
+            fired++;
+        }
+        return fired;
+    }
+
+    std::uint32_t                              m_now;
+    std::size_t                                m_active{0};
+    std::array<std::uint64_t, TLevels>         m_occupied{};
+    std::array<SoftTimerLink, TLevels * SLOTS> m_heads; // 8 bytes per slot on the target
+};
+
+#endif // TIMER_WHEEL_HPP
@@ -12,7 +12,8 @@
 #ifndef UART_REDIRECT_HPP
 #define UART_REDIRECT_HPP
 
-class UartManager;
+#include "uart_manager_stm32.hpp" // UartManager is an alias, it cannot be forward-declared
+
 void setUartRedirect(UartManager& manager);
 
 #endif
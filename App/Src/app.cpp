@@ -10,7 +10,6 @@
  ******************************************************************************
  */
 #include <cstring>
-#include <stdio.h>
 #include "app.hpp"
 #include "boot_flag_manager.hpp"
 #include "clock_manager_stm32.hpp"
@@ -19,17 +18,48 @@
 
 #include "api_debug.hpp"
 #include "console.hpp"
+#include "console_commands.hpp"
+#include "fmt_log.hpp"
 #include "uart_redirect.hpp"
 
 #include "flash_writer_stm32.hpp"
+#include "flash_layout.hpp"
+#include "event_log.hpp"
+#include "flash_log.hpp"
+#include "timebase_stm32.hpp"
+#include "timer_stm32.hpp"
+#include "gpio_stm32.hpp"
+#include "fault_capture_stm32.hpp"
+#include "image_manager.hpp"
+#include "shared_memory.hpp"
+#include "priority_lock_stm32.hpp"
 #include "stm32f4xx_hal.h"
 #include "stm32f4xx.h"
+#if defined(APP_RTOS)
+#include "pil_os.hpp"
+#endif
+
+LOG_MODULE(AppLog, Info);
 
 /**
  * @brief Static functions
  */
 static void AppIntro();
 static void ClockErrorHandler();
+static void ErrorLogInit();
+static void EventLogCommand(const char* t_param);
+static void SuperviseTick(void* t_context);
+static void Supervise(void* t_context);
+static void HeartBeat(void* t_context);
+static void RunSoftTimers(void* t_context);
+static void ArmSoftTimerAlarm(void* t_context);
+static void LoopStatsCommand(const char* t_param);
+static void SoftIrqStatsCommand(const char* t_param);
+static void LockStatsCommand(const char* t_param);
+static Coro::Task ButtonFlow(Coro::Event& t_pressed, IGPIOPin* t_led);
+#if defined(APP_RTOS)
+static void OsStatsCommand(const char* t_param);
+#endif
 
 /**
  * @brief Global Objects
@@ -41,12 +71,77 @@ AdcManager         adc;
 static UartManager uart2;
 Console            console;
 
+static FlashWriterSTM32F4 logWriter;
+Log::FlashLog             errorLog(&logWriter, FlashLayout::ERROR_LOG_START,
+                                   FlashLayout::ERROR_LOG_SIZE,
+                                   FlashLayout::sectorFromAddress(FlashLayout::ERROR_LOG_START));
+// Producers are thread mode and bottom halves, all below the lock ceiling
+struct EventLogLock : PriorityLock<>
+{
+    EventLogLock() : PriorityLock(LOCK_SITE("event log")) {}
+};
+Log::EventLog<32, EventLogLock> eventLog(errorLog, HAL_GetTick);
+
+AppSoftIrq     softIrq(timebase);
+AppEventLoop   eventLoop(timebase);
+SoftTimerWheel softTimers;
+
+static SoftTimer heartBeat;
+
+Coro::Executor coroutines([](void*) { eventLoop.post(LoopEvent::Coroutines); });
+
+// Frames of the application flows; 'loop' shows the use and the largest frame
+static Coro::FramePool<4, 256> coroutineFrames;
+
+void* Coro::allocateFrame(size_t t_size)
+{
+    return coroutineFrames.allocate(t_size);
+}
+
+void Coro::releaseFrame(void* t_frame)
+{
+    coroutineFrames.release(t_frame);
+}
+
+// Supervise runs every 250 ms when the loop is healthy; the watchdog allows 1 s
+static Timer_STM32    superviseTimer(TimerId::Tim3);
+constexpr TimerPeriod SUPERVISE_PERIOD = Timer_STM32::period(TimerId::Tim3, 250000);
+static_assert(SUPERVISE_PERIOD.valid, "TIM3 cannot count 250 ms at this clock");
+
+#if defined(APP_RTOS)
+// The event loop runs as a task; higher priorities are free for time-critical tasks
+static Os::StackWord loopStack[256]; // 2 KiB
+static Os::Task      loopTask("loop", [](void*) { eventLoop.run(); }, nullptr, 2, loopStack);
+
+// Bottom halves above every other task, as PendSV is above thread mode without the RTOS
+static Os::StackWord softIrqStack[128]; // 1 KiB
+static Os::Task      softIrqTask(
+    "softirq",
+    [](void*)
+    {
+        for (;;)
+        {
+            SoftIrqPend_Os::wait();
+            softIrq.drain();
+        }
+    },
+    nullptr, Os::PRIORITIES - 1, softIrqStack);
+#endif
+
 /**
  * @brief Main Application entry point for C++ code
  */
 extern "C" int main(void)
 {
     clock.initialize(ClockErrorHandler);
+    timebase.initialize();
+
+    // Before the interrupts that post them are enabled
+    softIrq.subscribe(SoftIrqId::ConsoleRx, &ConsoleRxSoftIrq, nullptr, 0);
+    softIrq.subscribe(SoftIrqId::Button, &ButtonSoftIrq, nullptr, 1);
+#if !defined(APP_RTOS)
+    SoftIrqPendSV_STM32::initialize();
+#endif
 
     FlashWriterSTM32F4 writer;
     BootFlagManager    flags(&writer);
@@ -59,27 +154,44 @@ extern "C" int main(void)
 
     /** Initialization code for C++ application can be added here */
     watchdog.initialize(1000); // 1 second timeout
-    gpio.initialize(gpioPinConfigs);
+    gpio.initialize();
     adc.initialize();
+    superviseTimer.startPeriodic(SUPERVISE_PERIOD, &SuperviseTick, nullptr);
+    StartSoftTimer(heartBeat, 500, &HeartBeat, nullptr, 500);
 
     uart2.initialize(UartId::Uart2, 115200);
     setUartRedirect(uart2);
 
-    UserButtonManager usrButton(exti0_Subject, GPIO_PIN_0);
-    LedManager        usrLed(exti0_Subject, GPIO_PIN_0, gpio.getPin(PinId::LD_BLU));
+    ErrorLogInit();
+
+    Coro::SubjectEvent buttonPressed(exti0_Subject, GPIO_PIN_0);
+    if (!coroutines.spawn(ButtonFlow(buttonPressed, gpio.getPin(PinId::LD_BLU))))
+    {
+        LOG_ERROR(AppLog, "Coroutine frame pool exhausted\n\r");
+    }
 
     AppIntro();
 
-    __enable_irq();
+    eventLoop.subscribe(LoopEvent::Coroutines, [](void*) { coroutines.runReady(); });
+    eventLoop.subscribe(LoopEvent::ConsoleRx, [](void*) { console.poll(); });
+    eventLoop.subscribe(LoopEvent::Timers, &RunSoftTimers);
+    eventLoop.subscribe(LoopEvent::Supervise, &Supervise);
+    eventLoop.setIdleHook(&ArmSoftTimerAlarm);
 
-    /** Main loop */
-    for (;;)
+#if defined(APP_RTOS)
+    if (!loopTask.start() || !softIrqTask.start())
     {
-        usrButton.process();
-        usrLed.process();
-
-        watchdog.feed();
+        LOG_ERROR(AppLog, "OS: loop or softirq task not started\n\r");
     }
+
+    /** Scheduler: enables interrupts, the loop task blocks until an event is posted */
+    Os::run();
+#else
+    __enable_irq();
+
+    /** Main loop: sleeps until an interrupt posts an event */
+    eventLoop.run();
+#endif
 }
 
 extern "C" void WatchdogFeed(void)
@@ -87,97 +199,355 @@ extern "C" void WatchdogFeed(void)
     watchdog.feed();
 }
 
-void ConsoleNotify(uint8_t t_item)
+/**
+ * @brief TIM3 interrupt: request a Supervise pass from the main loop
+ */
+static void SuperviseTick(void* t_context)
 {
-    console.receivedData(t_item);
+    eventLoop.post(LoopEvent::Supervise);
 }
 
 /**
- * @brief Application Intro on wake-up
+ * @brief Lowest-priority event: it only runs when every handler returned and no higher
+ *        event starves the loop, so this is where the watchdog is fed.
  */
-static void AppIntro()
+static void Supervise(void* t_context)
 {
-    uint32_t bootFlag = *(__IO uint32_t*)FlashLayout::CONFIG_START;
+    eventLog.flushIfDue(HAL_GetTick());
+    watchdog.feed();
+}
 
-    std::array<uint8_t, 4> bytes = {static_cast<uint8_t>((bootFlag >> 24) & 0xFF),
-                                    static_cast<uint8_t>((bootFlag >> 16) & 0xFF),
-                                    static_cast<uint8_t>((bootFlag >> 8) & 0xFF),
-                                    static_cast<uint8_t>((bootFlag >> 0) & 0xFF)};
+/**
+ * @brief Heartbeat LED, toggled every 500 ms by a software timer
+ */
+static void HeartBeat(void* t_context)
+{
+    StaticPin_STM32<PinId::LD_GRE>::toggle();
+}
 
-    printf("HA-CTRL-APP\tFirmware Version: %d.%d\tNew FW Status:'%c%c%c%c'\n\r",
-           FIRMWARE_VERSION.major, FIRMWARE_VERSION.minor, bytes[0], bytes[1], bytes[2], bytes[3]);
+static uint32_t SoftTimerTick(uint64_t t_us)
+{
+    return static_cast<uint32_t>(t_us / 1000U);
+}
+
+void StartSoftTimer(SoftTimer& t_timer, uint32_t t_delayMs, SoftTimerCallback t_callback,
+                    void* t_context, uint32_t t_periodMs)
+{
+    const uint32_t now = SoftTimerTick(timebase.nowUs());
+
+    // The wheel only advances when something is due: count from the current tick, and
+    // catch an idle wheel up so it never lags by more than the alarm's 30 min
+    if (softTimers.active() == 0)
+    {
+        softTimers.advanceTo(now);
+    }
+    softTimers.startAt(t_timer, now + t_delayMs, t_callback, t_context, t_periodMs);
+}
+
+static void RunSoftTimers(void* t_context)
+{
+    softTimers.advanceTo(SoftTimerTick(timebase.nowUs()));
 }
 
 /**
- * @brief  This function is executed in case of clock error occurrence.
+ * @brief Idle hook: program the TIM2 compare for the wheel's next event, so the core
+ *        sleeps until then instead of waking for a periodic tick
  */
-static void ClockErrorHandler()
+static void ArmSoftTimerAlarm(void* t_context)
 {
-    uint32_t loop = 0;
-    __disable_irq();
-    while (1)
+    constexpr uint32_t MAX_AHEAD_MS = 30U * 60U * 1000U; // Well inside the TIM2 wrap
+
+    const uint32_t next = softTimers.ticksToNextEvent();
+    if (next == SoftTimerWheel::NO_EVENT)
     {
-        ++loop;
+        timebase.cancelAlarm();
+        return;
+    }
+
+    const uint64_t nowUs = timebase.nowUs();
+    const auto     ahead = static_cast<int32_t>(softTimers.now() + next - SoftTimerTick(nowUs));
+
+    // Not ahead: due already (the wheel lags), the alarm fires at once
+    uint64_t atMs = nowUs / 1000U;
+    if (ahead > 0)
+    {
+        atMs += (static_cast<uint32_t>(ahead) < MAX_AHEAD_MS) ? ahead : MAX_AHEAD_MS;
     }
+
+    timebase.setAlarm(atMs * 1000U, [](void*) { eventLoop.post(LoopEvent::Timers); }, nullptr);
 }
 
-UserButtonManager::UserButtonManager(Subject& t_subject, uint32_t t_pin_mask)
-    : m_subject(t_subject), m_pin_mask(t_pin_mask)
+void ConsoleNotify(uint8_t t_item)
 {
-    m_subject.registerObserver(this);
+    console.receivedData(t_item);
 }
 
-void UserButtonManager::notify(uint32_t t_pin_mask) const
+/**
+ * @brief Mount the error log, move a crash snapshot left by the fault handler into it
+ *        and record the reset cause
+ */
+static void ErrorLogInit()
 {
-    if ((t_pin_mask & m_pin_mask) != 0)
+    errorLog.mount();
+
+    eventLog.record(static_cast<uint16_t>(AppEvent::Boot), RCC->CSR);
+    RCC->CSR |= RCC_CSR_RMVF;
+
+    if (FaultCapture::hasPending())
     {
-        m_pending = true;
+        const Log::CrashRecord& record = FaultCapture::pending();
+
+        bool saved{false};
+        {
+            PriorityLock<> lock(LOCK_SITE("crash record"));
+            saved = errorLog.append(static_cast<uint8_t>(Log::RecordType::Crash),
+                                    Log::crashRecordPayload(record));
+        }
+
+        LOG_ERROR(AppLog, "Crash captured: exception {} PC 0x{08X} CFSR 0x{08X} ({})\n\r",
+                  record.exception, record.pc, record.cfsr,
+                  saved ? "saved to error log" : "log failed");
+
+        eventLog.record(static_cast<uint16_t>(AppEvent::CrashRecorded), record.pc);
+        FaultCapture::clear();
     }
+
+    // Precise MemManage/BusFault/UsageFault reports instead of escalation to HardFault
+    SCB->SHCSR |= SCB_SHCSR_USGFAULTENA_Msk | SCB_SHCSR_BUSFAULTENA_Msk | SCB_SHCSR_MEMFAULTENA_Msk;
 }
 
 /**
- * @brief Lambda getFilename
+ * @brief Console command "events": commit staged events now and show the counters
  */
-auto getFilename = []() -> const char*
+static void EventLogCommand(const char* t_param)
 {
-    const char* path     = __FILE__;
-    const char* filename = std::strrchr(const_cast<char*>(path), '/');
-    const char* ret      = (filename != nullptr) ? filename + 1 : path;
-    return ret;
-};
+    const size_t pending = eventLog.pending();
+    const bool   flushed = eventLog.flush();
 
-void UserButtonManager::process()
+    Fmt::print("Events flushed: {} ({}), dropped since boot: {}\r\n", pending,
+               flushed ? "ok" : "log failed", eventLog.dropped());
+}
+
+CONSOLE_COMMAND(events, &EventLogCommand, "Flush staged events to the error log");
+
+/**
+ * @brief Console command "loop": wake-to-handler latency per event and time asleep;
+ *        "loop reset" starts a new measurement
+ */
+static void LoopStatsCommand(const char* t_param)
 {
-    if (m_pending)
+    static constexpr const char* names[] = {"coroutines", "console", "timers", "supervise"};
+    static_assert(std::size(names) == static_cast<size_t>(LoopEvent::Count));
+
+    const uint32_t cyclesPerUs = timebase.cyclesPerUs();
+    const uint64_t periodUs    = eventLoop.statsPeriodUs();
+
+    Fmt::print("Asleep {}% of {} ms, {} sleeps\r\n",
+               (periodUs != 0) ? static_cast<uint32_t>(eventLoop.sleptUs() * 100 / periodUs) : 0U,
+               static_cast<uint32_t>(periodUs / 1000), eventLoop.sleeps());
+
+    for (size_t i = 0; i < std::size(names); ++i)
+    {
+        const EventStats& stats = eventLoop.stats(static_cast<LoopEvent>(i));
+        const uint32_t    average =
+            (stats.dispatched != 0) ? static_cast<uint32_t>(stats.latencyTotal / stats.dispatched)
+                                    : 0U;
+
+        Fmt::print("{}: runs {} latency avg {} max {} cycles ({} us), run max {} us\r\n",
+                   names[i], stats.dispatched, average, stats.latencyMax,
+                   stats.latencyMax / cyclesPerUs, stats.runMax / cyclesPerUs);
+    }
+
+    Fmt::print("Coroutine frames: {} of {} used, peak {}, largest {} bytes, failed {}\r\n",
+               coroutineFrames.used(), coroutineFrames.capacity(), coroutineFrames.peak(),
+               coroutineFrames.largest(), coroutineFrames.failed());
+
+    if (std::strcmp(t_param, "reset") == 0)
+    {
+        eventLoop.resetStats();
+    }
+}
+
+CONSOLE_COMMAND(loop, &LoopStatsCommand, "Event loop latency and sleep time, 'loop reset'");
+
+/**
+ * @brief Console command "softirq": runs, drops and the run-time histogram of each bottom
+ *        half, queue peaks per level; "softirq reset" clears the counters
+ */
+static void SoftIrqStatsCommand(const char* t_param)
+{
+    static constexpr const char* names[] = {"button", "console"};
+    static_assert(std::size(names) == static_cast<size_t>(SoftIrqId::Count));
+
+    const uint32_t cyclesPerUs = timebase.cyclesPerUs();
+
+    for (size_t i = 0; i < std::size(names); ++i)
+    {
+        const SoftIrqStats stats = softIrq.stats(static_cast<SoftIrqId>(i));
+
+        Fmt::print("{}: runs {} dropped {} max {} cycles ({} us)\r\n", names[i], stats.runs,
+                   stats.dropped, stats.runMax, stats.runMax / cyclesPerUs);
+
+        // Bucket b: runs of 2^(b-1) up to 2^b cycles, the last one anything longer
+        for (size_t bucket = 0; bucket < SOFT_IRQ_BUCKETS - 1; ++bucket)
+        {
+            if (stats.histogram[bucket] != 0)
+            {
+                Fmt::print("  < {} cycles: {}\r\n", 1U << bucket, stats.histogram[bucket]);
+            }
+        }
+        if (stats.histogram[SOFT_IRQ_BUCKETS - 1] != 0)
+        {
+            Fmt::print("  >= {} cycles: {}\r\n", 1U << (SOFT_IRQ_BUCKETS - 2),
+                       stats.histogram[SOFT_IRQ_BUCKETS - 1]);
+        }
+    }
+
+    Fmt::print("Queue peak: level 0 {}, level 1 {}\r\n", softIrq.peak(0), softIrq.peak(1));
+
+    if (std::strcmp(t_param, "reset") == 0)
     {
-        m_pending  = false;
-        float temp = adc.readTemperature();
+        softIrq.resetStats();
+    }
+}
+
+CONSOLE_COMMAND(softirq, &SoftIrqStatsCommand, "Bottom-half run times, 'softirq reset'");
+
+/**
+ * @brief Console command "locks": entries and longest BASEPRI-masked interval of every
+ *        PriorityLock site run so far; "locks reset" clears them
+ */
+static void LockStatsCommand(const char* t_param)
+{
+    const uint32_t cyclesPerUs = timebase.cyclesPerUs();
+
+    for (const LockSite* site = LockSites::first; site != nullptr; site = site->next)
+    {
+        Fmt::print("{}: entries {} longest {} cycles ({} us)\r\n", site->name, site->entries,
+                   site->longest, site->longest / cyclesPerUs);
+    }
+    Fmt::print("Ceiling {}: priorities {}..{} keep running\r\n", IrqPriority::CEILING, 0U,
+               IrqPriority::CEILING - 1);
+
+    if (std::strcmp(t_param, "reset") == 0)
+    {
+        LockSites::resetStats();
+    }
+}
+
+CONSOLE_COMMAND(locks, &LockStatsCommand, "Longest masked interval per lock site, 'locks reset'");
+
+#if defined(APP_RTOS)
+/**
+ * @brief Console command "os": tasks with their stack high-water mark, context-switch
+ *        time and interrupt-to-task latency; "os reset" starts a new measurement
+ */
+static void OsStatsCommand(const char* t_param)
+{
+    Os::forEachTask(
+        [](const Os::Task& t_task, void*)
+        {
+            static constexpr const char* states[] = {"created", "ready", "blocked", "sleeping",
+                                                     "finished"};
+            const Os::TaskStats stats = t_task.stats();
+
+            Fmt::print("{}: priority {} {}, stack {} of {} bytes, switched in {}\r\n",
+                       t_task.name(), t_task.priority(),
+                       states[static_cast<size_t>(t_task.state())], stats.stackUsed,
+                       stats.stackSize, stats.switchesIn);
+        },
+        nullptr);
+
+    const Os::KernelStats stats = Os::kernelStats();
+    const uint32_t        switchAverage =
+        (stats.switches != 0) ? static_cast<uint32_t>(stats.switchTotal / stats.switches) : 0U;
+    const uint32_t wakeAverage =
+        (stats.wakeups != 0) ? static_cast<uint32_t>(stats.wakeTotal / stats.wakeups) : 0U;
 
-        printf("[%s:%d]:%3d:Temperature: %3.2f[*C]\n\r", getFilename(), __LINE__,
-               static_cast<int>(++m_press_counter), temp);
+    Fmt::print("Switches: {} avg {} max {} cycles ({} us)\r\n", stats.switches, switchAverage,
+               stats.switchMax, stats.switchMax / stats.cyclesPerUs);
+    Fmt::print("Give-to-task wakeups: {} avg {} max {} cycles ({} us)\r\n", stats.wakeups,
+               wakeAverage, stats.wakeMax, stats.wakeMax / stats.cyclesPerUs);
+
+    if (std::strcmp(t_param, "reset") == 0)
+    {
+        Os::resetKernelStats();
     }
 }
 
-LedManager::LedManager(Subject& t_subject, uint32_t t_ledMask, IGPIOPin* t_led)
-    : m_subject(t_subject), m_pin_mask(t_ledMask), m_ledPtr(t_led)
+CONSOLE_COMMAND(os, &OsStatsCommand, "RTOS tasks, switch time and wake latency, 'os reset'");
+#endif
+
+/**
+ * @brief Application Intro on wake-up
+ */
+static void AppIntro()
 {
-    m_subject.registerObserver(this);
+    uint32_t bootFlag = *(__IO uint32_t*)FlashLayout::CONFIG_START;
+
+    std::array<char, 4> bytes = {static_cast<char>((bootFlag >> 24) & 0xFF),
+                                 static_cast<char>((bootFlag >> 16) & 0xFF),
+                                 static_cast<char>((bootFlag >> 8) & 0xFF),
+                                 static_cast<char>((bootFlag >> 0) & 0xFF)};
+
+    LOG_INFO(AppLog, "HA-CTRL-APP\tFirmware Version: {}.{}\tNew FW Status:'{}{}{}{}'\n\r",
+             FIRMWARE_VERSION.major, FIRMWARE_VERSION.minor, bytes[0], bytes[1], bytes[2],
+             bytes[3]);
+
+    if (Shared::bootProfile.magic == Shared::BOOT_PROFILE_MAGIC)
+    {
+        static constexpr const char* status[] = {"not checked", "verified", "cached", "failed",
+                                                 "unprovisioned"};
+
+        const auto index = static_cast<std::uint32_t>(Shared::bootProfile.signatureStatus);
+        LOG_INFO(AppLog, "Boot profile:\tSignature: {}\tCheck time: {} us ({} cycles)\n\r",
+                 (index < std::size(status)) ? status[index] : "?",
+                 Shared::bootProfile.signatureCheckUs, Shared::bootProfile.signatureCheckCycles);
+    }
 }
 
-void LedManager::notify(uint32_t mask) const
+/**
+ * @brief  This function is executed in case of clock error occurrence.
+ */
+static void ClockErrorHandler()
 {
-    if ((mask & m_pin_mask) != 0)
+    uint32_t loop = 0;
+    __disable_irq();
+    while (1)
     {
-        m_pending = true;
+        ++loop;
     }
 }
 
-void LedManager::process()
+/**
+ * @brief Lambda getFilename
+ */
+auto getFilename = []() -> const char*
 {
-    if (m_pending)
+    const char* path     = __FILE__;
+    const char* filename = std::strrchr(const_cast<char*>(path), '/');
+    const char* ret      = (filename != nullptr) ? filename + 1 : path;
+    return ret;
+};
+
+/**
+ * @brief Button flow: each debounced press toggles the blue LED, then reads and logs
+ *        the temperature
+ */
+static Coro::Task ButtonFlow(Coro::Event& t_pressed, IGPIOPin* t_led)
+{
+    uint32_t presses = 0;
+
+    for (;;)
     {
-        m_pending = false;
-        m_ledPtr->toggle();
+        co_await t_pressed;
+        t_led->toggle();
+
+        const float temp = adc.readTemperature();
+        eventLog.record(static_cast<uint16_t>(AppEvent::ButtonPressed), ++presses);
+
+        LOG_INFO(AppLog, "[{}:{}]:{3}:Temperature: {3.2}[*C]\n\r", getFilename(), __LINE__,
+                 static_cast<int>(presses), temp);
     }
 }
 
@@ -6,30 +6,29 @@
 #include "app_it.hpp"
 #include "stm32f4xx_hal.h"
 #include "console.hpp"
+#include "cycle_counter_stm32.hpp"
+#include "timebase_stm32.hpp"
+
+extern Console console;
 
 /**
  * @brief Global Object Instance of SubjectWithDebouce
  */
-SubjectWithDebouce exti0_Subject{200u};
+SubjectWithDebouce exti0_Subject{timebase, 200u};
 
 /**
  * @brief Class Debouncer
  */
-Debouncer::Debouncer(uint32_t debounceMs) : debounceTime(debounceMs), lastTick(0), locked(false) {}
+Debouncer::Debouncer(const ITimebase& t_timebase, uint32_t debounceMs)
+    : quiet(t_timebase), debounceUs(static_cast<uint64_t>(debounceMs) * 1000u)
+{
+}
 
 bool Debouncer::shouldTrigger()
 {
-    uint32_t now = HAL_GetTick();
-
-    if (now - lastTick > debounceTime)
+    if (quiet.expired())
     {
-        lastTick = now;
-        locked   = false;
-    }
-
-    if (!locked)
-    {
-        locked = true;
+        quiet.restart(debounceUs);
         return true;
     }
 
@@ -37,33 +36,71 @@ bool Debouncer::shouldTrigger()
 }
 
 /**
- * @brief  Heatbeat Led Toggle every 500[ms]
+ * @brief HAL time base on the TIM2 timebase instead of a 1 ms SysTick interrupt, so the
+ *        App can sleep until its next event. Until timebase.initialize() HAL_GetTick()
+ *        stays 0, as it did with SysTick before HAL_RCC_ClockConfig() started it.
  */
-extern "C" void SysTick_HeartBeat(void)
+extern "C" HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
 {
-    static uint32_t ticks = 0u;
+    return HAL_OK;
+}
 
-    auto ledHeartBeat = gpio.getPin(PinId::LD_GRE);
+extern "C" uint32_t HAL_GetTick(void)
+{
+    return static_cast<uint32_t>(timebase.nowUs() / 1000U);
+}
 
-    if (ticks++ >= 500)
+/**
+ * @brief Callback function for Externall Interrupt on Gpio: defer to ButtonSoftIrq
+ */
+extern "C" void EXTI0_Callback(uint16_t GPIO_Pin)
+{
+    softIrq.post(SoftIrqId::Button, GPIO_Pin);
+}
+
+/**
+ * @brief Callback function for USART2 RX: hand byte and status to ConsoleRxSoftIrq; a
+ *        byte that finds the queue full is lost like a hardware overrun
+ */
+extern "C" void USART2_Callback(uint32_t t_byte, uint32_t t_status)
+{
+    const uint32_t start = CycleCounter::now();
+
+    if (!softIrq.post(SoftIrqId::ConsoleRx, (t_byte & 0xFFU) | (t_status << 8)))
     {
-        ticks = 0;
-        ledHeartBeat->toggle();
+        console.noteOverrun();
     }
+
+    console.noteIsrCycles(CycleCounter::elapsed(start));
 }
 
 /**
- * @brief Callback function for Externall Interrupt on Gpio
+ * @brief Bottom half of EXTI0: debounce and notify the button observers
  */
-extern "C" void EXTI0_Callback(uint16_t GPIO_Pin)
+void ButtonSoftIrq(void* t_context, uint32_t t_pin)
 {
-    exti0_Subject.notifyObserversWhenStable(GPIO_Pin);
+    exti0_Subject.notifyObserversWhenStable(t_pin);
+}
+
+/**
+ * @brief Bottom half of USART2 RX: enqueue only, the console runs in the event loop
+ */
+void ConsoleRxSoftIrq(void* t_context, uint32_t t_data)
+{
+    if ((t_data >> 8) & USART_SR_ORE)
+    {
+        console.noteOverrun();
+    }
+    Uart2Observers::notifyAll(static_cast<uint8_t>(t_data));
+    eventLoop.post(LoopEvent::ConsoleRx);
 }
 
+#if !defined(APP_RTOS) // The PilOs port switches tasks in PendSV
 /**
- * @brief Callback function for Externall Interrupt on Gpio
+ * @brief Lowest-priority exception: run the bottom halves posted by the interrupts
  */
-extern "C" void USART2_Callback(uint32_t t_byte)
+extern "C" void PendSV_Handler(void)
 {
-    uart2_Observers.notifyAll(static_cast<uint8_t>(t_byte));
+    softIrq.drain();
 }
+#endif
@@ -1,14 +1,73 @@
-#include <cstdio>
 #include <cstring>
 #include "console.hpp"
+#include "console_commands.hpp"
+#include "console_tx.hpp"
+#include "fmt_log.hpp"
 #include "adc_manager_stm32.hpp"
 #include "shared_memory.hpp"
+#include "flash_log.hpp"
+#include "cycle_counter_stm32.hpp"
 
 #include "stm32f4xx_ll_usart.h"
 
-extern AdcManager adc;
+extern AdcManager    adc;
+extern Log::FlashLog errorLog;
+extern Console       console;
+
+extern "C" void WatchdogFeed(void);
+
+// Collected and sorted by name in the App linker script (.console_commands)
+extern "C" const ConsoleCommand __console_commands_start[];
+extern "C" const ConsoleCommand __console_commands_end[];
+
+CONSOLE_COMMAND(help, &Console::help, "Show available commands");
+CONSOLE_COMMAND(reset, &Console::reset, "Reset the MCU");
+CONSOLE_COMMAND(echo, &Console::echo, "Echo a number back");
+CONSOLE_COMMAND(temp, &Console::temperature, "Get Temp from Tsensor");
+CONSOLE_COMMAND(watchdog, &Console::watchdogTest, "Watchdog Test: while(1){}");
+CONSOLE_COMMAND(fw_update, &Console::firmwareUpdate, "Firmware Update");
+CONSOLE_COMMAND(errlog, &Console::errorLogDump, "Dump error log (binary, Tools/decode_error_log.py)");
+CONSOLE_COMMAND(uart, &Console::uartStats, "Console RX counters and ISR time");
+
+std::span<const ConsoleCommand> ConsoleCommands::all()
+{
+    return {__console_commands_start, __console_commands_end};
+}
 
 void Console::receivedData(uint8_t byte) noexcept
+{
+    m_stats.rxBytes = m_stats.rxBytes + 1;
+
+    if (!m_rxQueue.push(byte))
+    {
+        m_stats.rxDropped = m_stats.rxDropped + 1;
+    }
+}
+
+void Console::noteOverrun() noexcept
+{
+    m_stats.rxOverruns = m_stats.rxOverruns + 1;
+}
+
+void Console::noteIsrCycles(uint32_t t_cycles) noexcept
+{
+    m_stats.isrCyclesLast = t_cycles;
+    if (t_cycles > m_stats.isrCyclesMax)
+    {
+        m_stats.isrCyclesMax = t_cycles;
+    }
+}
+
+void Console::poll()
+{
+    uint8_t byte;
+    while (m_rxQueue.pop(byte))
+    {
+        assemble(byte);
+    }
+}
+
+void Console::assemble(uint8_t byte)
 {
     if (isBufferFull())
     {
@@ -32,30 +91,29 @@ void Console::receivedData(uint8_t byte) noexcept
 
 void Console::process(const char* t_line)
 {
-    for (const auto& cmd : cmdConfigArray)
+    const size_t length = strcspn(t_line, " ");
+
+    const ConsoleCommand* cmd = ConsoleCommands::find(ConsoleCommands::all(), t_line, length);
+    if (cmd == nullptr)
     {
-        if (strncmp(t_line, cmd.name, strlen(cmd.name)) == 0)
-        {
-            const char* param = t_line + strlen(cmd.name);
-            while (*param == ' ')
-                ++param;
-            cmd.handler(param);
-            return;
-        }
+        send("Unknown command\r\n");
+        return;
     }
 
-    send("Unknown command\r\n");
+    const char* param = t_line + length;
+    while (*param == ' ')
+        ++param;
+    cmd->handler(param);
 }
 
 void Console::send(const char* t_msg)
 {
-    while (*t_msg != '\0')
-    {
-        while (!(USART2->SR & USART_SR_TXE))
-        {
-        };
-        USART2->DR = *t_msg++;
-    }
+    consoleTx.write(t_msg, strlen(t_msg));
+}
+
+void Console::sendRaw(const uint8_t* t_data, size_t t_size)
+{
+    consoleTx.write(reinterpret_cast<const char*>(t_data), t_size);
 }
 
 bool Console::isBufferFull() const noexcept
@@ -92,30 +150,24 @@ void Console::setMessageToProcess() noexcept
 
 void Console::help(const char* t_item)
 {
-    size_t item_size = std::strlen(t_item);
+    const size_t item_size = strcspn(t_item, " ");
 
-    for (const auto& cmd : cmdConfigArray)
+    for (const auto& cmd : ConsoleCommands::all())
     {
-        if (strncmp(t_item, cmd.name, strlen(cmd.name)) == 0)
+        if (item_size && (ConsoleCommands::compare(cmd, t_item, item_size) != 0))
         {
-            send(cmd.name);
-            send(" - ");
-            send(cmd.description);
-            send("\r\n");
-            break;
-        }
-        else if (!item_size)
-        {
-            Console::send(cmd.name);
-            Console::send(" - ");
-            Console::send(cmd.description);
-            Console::send("\r\n");
+            continue;
         }
+        send(cmd.name);
+        send(" - ");
+        send(cmd.description);
+        send("\r\n");
     }
 }
 
 void Console::reset(const char* t_item)
 {
+    consoleTx.flush();
     NVIC_SystemReset();
 }
 
@@ -128,7 +180,7 @@ void Console::echo(const char* t_item)
 void Console::temperature(const char* t_item)
 {
     float temp = adc.readTemperature();
-    printf("Temperature: %3.2f[*C] \r\n", temp);
+    Fmt::print("Temperature: {3.2}[*C] \r\n", temp);
 }
 
 void Console::watchdogTest(const char* t_item)
@@ -142,5 +194,46 @@ void Console::firmwareUpdate(const char* msg)
 {
     // printf("Send binary file...");
     Shared::firmwareUpdateFlag = Shared::PREPARE_TO_RECEIVE_BINARY;
+    consoleTx.flush();
     NVIC_SystemReset();
 }
+
+void Console::errorLogDump(const char* msg)
+{
+    size_t validPages = 0;
+    for (size_t page = 0; page < errorLog.pageCount(); ++page)
+    {
+        validPages += errorLog.isPageValid(page) ? 1 : 0;
+    }
+
+    // Text header, then the raw pages: "ERRLOG <page size> <page count>\r\n<pages>\r\nEND\r\n"
+    char header[32];
+    Fmt::format(header, sizeof(header), "ERRLOG {} {}\r\n", Log::FlashLog::PAGE_SIZE, validPages);
+    send(header);
+
+    for (size_t page = 0; page < errorLog.pageCount(); ++page)
+    {
+        if (errorLog.isPageValid(page))
+        {
+            sendRaw(reinterpret_cast<const uint8_t*>(errorLog.start() +
+                                                     page * Log::FlashLog::PAGE_SIZE),
+                    Log::FlashLog::PAGE_SIZE);
+            WatchdogFeed(); // ~90 ms per page at 115200 baud
+        }
+    }
+
+    send("\r\nEND\r\n");
+}
+
+void Console::uartStats(const char* msg)
+{
+    const ConsoleStats& stats = console.m_stats;
+
+    const uint32_t isrCyclesMax = stats.isrCyclesMax;
+
+    Fmt::print("RX bytes: {} dropped: {} overruns: {}\r\n", stats.rxBytes, stats.rxDropped,
+               stats.rxOverruns);
+    Fmt::print("ISR cycles last: {} max: {} ({} us)\r\n", stats.isrCyclesLast, isrCyclesMax,
+               CycleCounter::toMicroseconds(isrCyclesMax));
+    Fmt::print("TX dropped: {} DMA errors: {}\r\n", consoleTx.dropped(), consoleTx.dmaErrors());
+}
@@ -0,0 +1,103 @@
+/**
+ * @file      App/Src/console_tx.cpp
+ * @author    it32bit
+ * @brief     DMA-driven USART2 transmit path shared by Fmt logging, printf and Console.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#include "console_tx.hpp"
+#include "defer_log.hpp"
+#include "fmt_log.hpp"
+#include "stm32f4xx.h"
+#include "timebase_stm32.hpp"
+
+ConsoleTx consoleTx;
+
+volatile void* Usart2TxPort::dataRegister()
+{
+    return &USART2->DR;
+}
+
+void ConsoleTx::write(const char* t_data, size_t t_size)
+{
+    if (__get_IPSR() != 0)
+    {
+        // An ISR would be a second producer next to the main loop
+        m_dropped = m_dropped + static_cast<uint32_t>(t_size);
+        return;
+    }
+
+    size_t done = m_tx.push(std::span<const char>(t_data, t_size));
+    startTransmit();
+
+    while (done < t_size)
+    {
+        pollIfMasked();
+        done += m_tx.push(std::span<const char>(t_data + done, t_size - done));
+        startTransmit();
+    }
+}
+
+bool ConsoleTx::tryWrite(const char* t_data, size_t t_size) noexcept
+{
+    if ((__get_IPSR() != 0) || (m_tx.space() < t_size))
+    {
+        return false;
+    }
+
+    m_tx.push(std::span<const char>(t_data, t_size));
+    startTransmit();
+    return true;
+}
+
+void ConsoleTx::flush()
+{
+    while (!m_tx.empty())
+    {
+        pollIfMasked();
+    }
+    while (!(USART2->SR & USART_SR_TC))
+    {
+    }
+}
+
+void ConsoleTx::startTransmit() noexcept
+{
+    // Thread mode and the DMA interrupt both start chunks: claim the idle DMA atomically
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    // Every time: a write before the USART clock is on is lost, and a chunk started
+    // then would wait for its request forever
+    USART2->CR3 |= USART_CR3_DMAT;
+
+    m_tx.startTransmit();
+
+    __set_PRIMASK(primask);
+}
+
+void ConsoleTx::pollIfMasked() noexcept
+{
+    if (__get_PRIMASK() != 0)
+    {
+        m_dma.poll(); // The DMA interrupt cannot run: handle its completion here
+    }
+}
+
+void Fmt::write(const char* t_data, std::size_t t_size)
+{
+    consoleTx.write(t_data, t_size);
+}
+
+bool DeferLog::writeFrame(const std::uint8_t* t_frame, std::size_t t_size)
+{
+    return consoleTx.tryWrite(reinterpret_cast<const char*>(t_frame), t_size);
+}
+
+std::uint64_t DeferLog::timestamp()
+{
+    return timebase.nowCycles();
+}
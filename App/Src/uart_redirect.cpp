@@ -1,5 +1,6 @@
 
 #include "uart_manager_stm32.hpp"
+#include "console_tx.hpp"
 
 static UartManager* g_uartManager = nullptr;
 
@@ -12,9 +13,7 @@ extern "C" int _write(int file, char* ptr, int len)
 {
     if (!g_uartManager) return 0;
 
-    for (int i = 0; i < len; ++i)
-    {
-        g_uartManager->write(ptr[i]);
-    }
+    // The manager configured USART2; bytes go out through the interrupt-driven TX ring
+    consoleTx.write(ptr, static_cast<size_t>(len));
     return len;
 }
\ No newline at end of file
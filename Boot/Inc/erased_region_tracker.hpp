@@ -0,0 +1,195 @@
+/**
+ * @file      Boot/Inc/erased_region_tracker.hpp
+ * @author    it32bit
+ * @brief     Persistent "region known erased" markers for the update slots.
+ *            Lets the bootloaders recognise an erased slot in O(1) instead of
+ *            reading up to 448 KB of flash on every boot.
+ *
+ * @details   Each region owns a small row of words in CONFIG_ERASED_MARKER_START:
+ *
+  | Word value  | Meaning                                              |
+  |-------------|------------------------------------------------------|
+  | 0xFFFFFFFF  | Unused slot (end of the row)                         |
+  | 0x45525344  | 'ERSD' - region was verified erased after this write |
+  | 0x00000000  | Revoked marker (programmed over, no erase needed)    |
+ *
+ *            The last used word of a row is the current state. Marking appends,
+ *            revoking clears bits in place, so the tracker never erases sector 3
+ *            itself; BootFlagManager::setState() does, which only drops markers and
+ *            costs one full scan on the next boot. A marker is trusted only together
+ *            with a spot check of the region's first word and metadata word, which
+ *            catches images programmed by tools that do not know about the tracker.
+ *
+ *            The marker row and the regions default to the FlashLayout addresses; the class
+ *            has no MCU dependency and runs on the host against a RAM-backed writer.
+ *
+ * @tparam TLock  RAII guard held while a marker word is programmed (e.g. a PriorityLock).
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef ERASED_REGION_TRACKER_HPP
+#define ERASED_REGION_TRACKER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "blank_check.hpp"
+#include "flash_layout.hpp"
+#include "pil_flash_writer.hpp"
+
+enum class UpdateRegion : std::uint8_t
+{
+    NewBootloader2 = 0,
+    NewApp         = 1,
+    Count
+};
+
+struct ErasedRegion
+{
+    std::uintptr_t start;
+    std::size_t    size;
+    std::uintptr_t metadata; // Spot-checked together with the first word
+};
+
+using ErasedRegionTable = std::array<ErasedRegion, static_cast<std::size_t>(UpdateRegion::Count)>;
+
+// The update slots on the target, in UpdateRegion order
+inline constexpr ErasedRegionTable UPDATE_REGIONS{{
+    {FlashLayout::NEW_BOOTLOADER2_START, FlashLayout::NEW_BOOTLOADER2_SIZE,
+     FlashLayout::NEW_BOOTLOADER2_METADATA_START},
+    {FlashLayout::NEW_APP_START, FlashLayout::NEW_APP_TOTAL_SIZE,
+     FlashLayout::NEW_APP_METADATA_START},
+}};
+
+template <typename TLock>
+class ErasedRegionTracker
+{
+  public:
+    explicit ErasedRegionTracker(
+        IFlashWriter* t_writer, std::uintptr_t t_markers = FlashLayout::CONFIG_ERASED_MARKER_START,
+        const ErasedRegionTable& t_regions = UPDATE_REGIONS)
+        : m_writer(t_writer), m_markers(t_markers), m_regions(t_regions)
+    {
+    }
+
+    /**
+     * @brief Marker-accelerated blank check. Falls back to a full scan when no valid
+     *        marker exists and records a marker when that scan finds the region erased.
+     */
+    bool isErased(UpdateRegion t_region);
+
+    void markErased(UpdateRegion t_region);
+    void invalidate(UpdateRegion t_region);
+
+  private:
+    static constexpr std::uint32_t MARKER_ERASED  = 0x45525344; // 'ERSD'
+    static constexpr std::uint32_t MARKER_REVOKED = 0x00000000;
+    static constexpr std::uint32_t MARKER_EMPTY   = 0xFFFFFFFF;
+
+    static constexpr std::size_t ROW_WORDS = FlashLayout::CONFIG_ERASED_MARKER_SIZE /
+                                             static_cast<std::size_t>(UpdateRegion::Count) /
+                                             sizeof(std::uint32_t);
+
+    const ErasedRegion& region(UpdateRegion t_region) const
+    {
+        return m_regions[static_cast<std::size_t>(t_region)];
+    }
+
+    const volatile std::uint32_t* row(UpdateRegion t_region) const
+    {
+        return reinterpret_cast<const volatile std::uint32_t*>(
+            m_markers + static_cast<std::size_t>(t_region) * ROW_WORDS * sizeof(std::uint32_t));
+    }
+
+    std::size_t usedWords(UpdateRegion t_region) const;
+    bool        hasMarker(UpdateRegion t_region) const;
+
+    IFlashWriter*     m_writer;
+    std::uintptr_t    m_markers;
+    ErasedRegionTable m_regions;
+};
+
+template <typename TLock>
+std::size_t ErasedRegionTracker<TLock>::usedWords(UpdateRegion t_region) const
+{
+    const volatile std::uint32_t* words = row(t_region);
+
+    std::size_t used = 0;
+    while ((used < ROW_WORDS) && (words[used] != MARKER_EMPTY))
+    {
+        ++used;
+    }
+    return used;
+}
+
+template <typename TLock>
+bool ErasedRegionTracker<TLock>::hasMarker(UpdateRegion t_region) const
+{
+    const std::size_t used = usedWords(t_region);
+
+    return (used != 0) && (row(t_region)[used - 1] == MARKER_ERASED);
+}
+
+template <typename TLock>
+bool ErasedRegionTracker<TLock>::isErased(UpdateRegion t_region)
+{
+    const ErasedRegion& info = region(t_region);
+
+    // O(1) path: marker plus spot checks of the words any image write touches first
+    if ((hasMarker(t_region) == true) &&
+        (isImageEmpty(info.start, sizeof(std::uint32_t)) == true) &&
+        (isImageEmpty(info.metadata, sizeof(std::uint32_t)) == true))
+    {
+        return true;
+    }
+
+    const bool erased = isImageEmpty(info.start, info.size);
+    if (erased == true)
+    {
+        markErased(t_region);
+    }
+    else
+    {
+        invalidate(t_region); // Stale marker, the slot was written behind our back
+    }
+    return erased;
+}
+
+template <typename TLock>
+void ErasedRegionTracker<TLock>::markErased(UpdateRegion t_region)
+{
+    if (hasMarker(t_region) == true)
+    {
+        return;
+    }
+
+    const std::size_t used = usedWords(t_region);
+    if (used == ROW_WORDS)
+    {
+        return; // Row full until the next config sector erase; boots fall back to scanning
+    }
+
+    TLock lock;
+
+    m_writer->writeWord(reinterpret_cast<std::uintptr_t>(&row(t_region)[used]), MARKER_ERASED);
+}
+
+template <typename TLock>
+void ErasedRegionTracker<TLock>::invalidate(UpdateRegion t_region)
+{
+    if (hasMarker(t_region) == false)
+    {
+        return;
+    }
+
+    TLock lock;
+
+    // Clearing all bits needs no erase
+    m_writer->writeWord(reinterpret_cast<std::uintptr_t>(&row(t_region)[usedWords(t_region) - 1]),
+                        MARKER_REVOKED);
+}
+
+#endif // ERASED_REGION_TRACKER_HPP
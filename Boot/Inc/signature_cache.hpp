@@ -0,0 +1,164 @@
+/**
+ * @file      Boot/Inc/signature_cache.hpp
+ * @author    it32bit
+ * @brief     Flash-backed record of application images whose signature was already verified.
+ *            Lets BootSec skip the Ed25519 check on normal boots. The caller still checks the
+ *            firmware SHA-256 against Metadata::firmwareHash on every boot (isImageHashValid),
+ *            so a cached entry only vouches for the metadata and certificate it was made from.
+ *
+ * @details   An entry is the HMAC-SHA256 of the whole Metadata block followed by the whole
+ *            Certificate, keyed with the device secret (Firmware::DeviceSecret). The metadata
+ *            carries the firmware hash, so firmware, metadata and signature are all bound to
+ *            the entry; matching CRC or signature bytes alone never produce a hit.
+ *
+ *            Entries are appended into the region without erasing. On the target the region
+ *            is CONFIG_SIGNATURE_CACHE_START, which shares sector 3 with the boot flag, so
+ *            every BootFlagManager::setState() wipes the cache as well - exactly when a new
+ *            image is installed. The class has no MCU dependency and runs on the host
+ *            against a RAM-backed writer.
+ *
+ *            Threat model: the bootloaders rewrite sector 3 in normal operation, so it cannot
+ *            be write-protected and anything able to program flash (an exploited App, a
+ *            debugger on an RDP level 0 part) can append entries. A key built from public
+ *            data alone would let it plant an entry for forged metadata and skip the signature
+ *            check; without the device secret it cannot produce a valid entry. The secret sits
+ *            in sector 1 and is readable by code running on the device, so the cache does not
+ *            hold against an attacker that already reads flash - ship with RDP level 1. A
+ *            device without a provisioned secret runs with the cache disabled: contains()
+ *            never hits and store() writes nothing.
+ *
+ * @tparam TLock  RAII guard held while an entry is programmed (e.g. a PriorityLock).
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef SIGNATURE_CACHE_HPP
+#define SIGNATURE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include "firmware_metadata.hpp"
+#include "flash_layout.hpp"
+#include "hmac_sha256.hpp"
+#include "pil_flash_writer.hpp"
+
+template <typename TLock>
+class SignatureCache
+{
+  public:
+    explicit SignatureCache(IFlashWriter*  t_writer,
+                            std::uintptr_t t_start  = FlashLayout::CONFIG_SIGNATURE_CACHE_START,
+                            std::size_t    t_size   = FlashLayout::CONFIG_SIGNATURE_CACHE_SIZE,
+                            std::uintptr_t t_secret = FlashLayout::CERT_DEVICE_SECRET_START)
+        : m_writer(t_writer), m_start(t_start), m_slotCount(t_size / sizeof(Entry)),
+          m_secret(reinterpret_cast<const Firmware::DeviceSecret*>(t_secret))
+    {
+    }
+
+    bool contains(std::uintptr_t t_metadata, std::uintptr_t t_cert) const;
+    void store(std::uintptr_t t_metadata, std::uintptr_t t_cert);
+
+  private:
+    struct Entry
+    {
+        std::uint32_t magic;
+        std::uint32_t key[Integrity::Sha256::DigestSize / sizeof(std::uint32_t)];
+    };
+
+    static constexpr std::uint32_t ENTRY_MAGIC = 0x53494756; // 'SIGV'
+    static constexpr std::uint32_t ENTRY_EMPTY = 0xFFFFFFFF;
+
+    bool  isEnabled() const { return m_secret->magic == Firmware::DEVICE_SECRET_MAGIC; }
+    Entry makeEntry(std::uintptr_t t_metadata, std::uintptr_t t_cert) const;
+
+    const Entry* slots() const { return reinterpret_cast<const Entry*>(m_start); }
+
+    IFlashWriter*                 m_writer;
+    std::uintptr_t                m_start;
+    std::size_t                   m_slotCount;
+    const Firmware::DeviceSecret* m_secret;
+};
+
+template <typename TLock>
+typename SignatureCache<TLock>::Entry SignatureCache<TLock>::makeEntry(std::uintptr_t t_metadata,
+                                                                       std::uintptr_t t_cert) const
+{
+    Integrity::HmacSha256 mac(m_secret->key);
+    mac.update(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(t_metadata),
+                                             sizeof(Firmware::Metadata)));
+    mac.update(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(t_cert),
+                                             sizeof(Firmware::Certificate)));
+    const Integrity::Sha256::Digest digest = mac.finish();
+
+    Entry entry{ENTRY_MAGIC, {}};
+    std::memcpy(entry.key, digest.data(), sizeof(entry.key));
+
+    return entry;
+}
+
+template <typename TLock>
+bool SignatureCache<TLock>::contains(std::uintptr_t t_metadata, std::uintptr_t t_cert) const
+{
+    if (isEnabled() == false)
+    {
+        return false;
+    }
+
+    const Entry expected = makeEntry(t_metadata, t_cert);
+
+    for (std::size_t i = 0; i < m_slotCount; ++i)
+    {
+        if ((slots()[i].magic == ENTRY_MAGIC) &&
+            (std::memcmp(slots()[i].key, expected.key, sizeof(expected.key)) == 0))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename TLock>
+void SignatureCache<TLock>::store(std::uintptr_t t_metadata, std::uintptr_t t_cert)
+{
+    if (isEnabled() == false)
+    {
+        return;
+    }
+
+    const Entry entry = makeEntry(t_metadata, t_cert);
+
+    for (std::size_t i = 0; i < m_slotCount; ++i)
+    {
+        // A slot torn by a reset has some words programmed - never write over it
+        const auto* words = reinterpret_cast<const std::uint32_t*>(&slots()[i]);
+        bool        empty = true;
+        for (std::size_t w = 0; w < sizeof(Entry) / sizeof(std::uint32_t); ++w)
+        {
+            empty = empty && (words[w] == ENTRY_EMPTY);
+        }
+        if (empty == false)
+        {
+            continue;
+        }
+
+        TLock lock;
+
+        // Magic last, so a torn write never produces a valid-looking entry
+        const std::uintptr_t slot = m_start + i * sizeof(Entry);
+        for (std::size_t w = 0; w < sizeof(entry.key) / sizeof(std::uint32_t); ++w)
+        {
+            m_writer->writeWord(slot + offsetof(Entry, key) + w * sizeof(std::uint32_t),
+                                entry.key[w]);
+        }
+        m_writer->writeWord(slot + offsetof(Entry, magic), entry.magic);
+        return;
+    }
+    // Cache full: verification simply runs again on every boot until the next setState()
+}
+
+#endif // SIGNATURE_CACHE_HPP
@@ -1,7 +1,7 @@
 #include "boot_flag_manager.hpp"
 #include "stm32f4xx.h"
 #include "flash_layout.hpp"
-#include "image_manager.hpp"
+#include "priority_lock_stm32.hpp"
 
 // TODO: To be removed, for debug purpose
 static void debugLedBlue()
@@ -24,7 +24,7 @@ BootState BootFlagManager::getState() const
 
 void BootFlagManager::setState(BootState state)
 {
-    CriticalSection criticalSection; // interrupts disabled here
+    PriorityLock<> lock(LOCK_SITE("boot flag")); // Masks the IRQs up to the ceiling
 
     m_writer->eraseSector(CONFIG_SECTOR); // Define CONFIG_SECTOR based on address
     m_writer->writeWord(FLAG_ADDR, static_cast<std::uint32_t>(state));
@@ -17,19 +17,29 @@
 #include "flash_writer_stm32.hpp"
 #include "flash_layout.hpp"
 #include "image_manager.hpp"
+#include "erased_region_tracker.hpp"
+#include "timebase_stm32.hpp"
+#include "priority_lock_stm32.hpp"
 
 namespace BootPrim
 {
 
+// Masks the IRQs up to the ceiling while a marker word is programmed
+struct ErasedMarkerLock : PriorityLock<>
+{
+    ErasedMarkerLock() : PriorityLock(LOCK_SITE("erased marker")) {}
+};
+
 ClockManager clock;
 
 extern "C" int main()
 {
     clock.initialize(nullptr);
 
-    FlashWriterSTM32F4 writer;
-    BootFlagManager    flags(&writer);
-    ImageManager       image(&writer);
+    FlashWriterSTM32F4                    writer;
+    BootFlagManager                       flags(&writer);
+    ImageManager                          image(&writer);
+    ErasedRegionTracker<ErasedMarkerLock> erasedRegions(&writer);
 
     /**
      * Boot-Sec
@@ -50,16 +60,16 @@ extern "C" int main()
         }
 
         image.clearImage(FlashLayout::NEW_BOOTLOADER2_START, FlashLayout::NEW_BOOTLOADER2_SIZE);
+        erasedRegions.markErased(UpdateRegion::NewBootloader2);
     }
     else
     {
-        bool newBootSecCandidateFirmwareEmpty =
-            isImageEmpty(FlashLayout::NEW_BOOTLOADER2_START, FlashLayout::NEW_BOOTLOADER2_SIZE);
-        bool newBootSecCandidateMetaEmpty =
-            isImageEmpty(FlashLayout::NEW_BOOTLOADER2_START, FlashLayout::NEW_BOOTLOADER2_SIZE);
-        if ((newBootSecCandidateFirmwareEmpty == false) || (newBootSecCandidateMetaEmpty == false))
+        // The slot includes its metadata block, one check covers both
+        bool newBootSecCandidateEmpty = erasedRegions.isErased(UpdateRegion::NewBootloader2);
+        if (newBootSecCandidateEmpty == false)
         {
             image.clearImage(FlashLayout::NEW_BOOTLOADER2_START, FlashLayout::NEW_BOOTLOADER2_SIZE);
+            erasedRegions.markErased(UpdateRegion::NewBootloader2);
         }
     }
 
@@ -94,22 +104,16 @@ extern "C" int main()
     /**
      * Secend Bootloader Integrity check FAIL
      */
-    uint32_t timer{};
+    timebase.initialize();
+    Deadline blink(timebase);
 
     while (true)
     {
-        /**
-         * @brief Blinking period depends on number of uC cycles per loop (~30 - 50):
-         *      Tc = 1/16MHz = 62.5ns,
-         *      Tloop = Tc x CyclePerLoop,
-         *      Ttoggle = Tloop x 1M,
-         *  Obserwed blinking period ~1Hz
-         */
-        if ((timer % 1000000) == 0)
+        if (blink.expired())
         {
+            blink.advance(500000);
             LEDControl::toggleOrangeLED();
         }
-        ++timer;
     }
 }
 
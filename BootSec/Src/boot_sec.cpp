@@ -21,14 +21,18 @@
 #include "uart_manager_stm32.hpp"
 #include "image_manager.hpp"
 #include "shared_memory.hpp"
+#include "signature_cache.hpp"
+#include "erased_region_tracker.hpp"
+#include "timebase_stm32.hpp"
+#include "priority_lock_stm32.hpp"
 
 // Access Metadata and Cert Regions
 // const auto* metadata     = reinterpret_cast<const Firmware::Metadata*>(FlashLayout::METADATA_START);
-// const auto* cert_pub     = reinterpret_cast<const uint8_t*>(FlashLayout::CERT_PUBLIC_START);
-// const auto* cert_priv    = reinterpret_cast<const uint8_t*>(FlashLayout::CERT_PRIVATE_START);
 // const auto* error_log    = reinterpret_cast<const uint8_t*>(FlashLayout::ERROR_LOG_START);
 
 static void ClockErrorHandler();
+static bool SignatureCheck(std::uintptr_t t_firmware, std::uintptr_t t_metadata,
+                           std::uintptr_t t_cert);
 
 static void ClockErrorHandler()
 {
@@ -38,22 +42,70 @@ static void ClockErrorHandler()
     }
 }
 
+/**
+ * @brief Ed25519 check of an image against the provisioned public key. The time spent is
+ *        recorded in Shared::bootProfile. Devices without a key keep CRC-only behaviour.
+ */
+static bool SignatureCheck(std::uintptr_t t_firmware, std::uintptr_t t_metadata,
+                           std::uintptr_t t_cert)
+{
+    if (isSignatureEnforced(FlashLayout::CERT_PRIVATE_START) == false)
+    {
+        Shared::bootProfile.signatureStatus = Shared::SignatureStatus::Unprovisioned;
+        return true;
+    }
+
+    const std::uint64_t start = timebase.nowCycles();
+    const bool signatureValid =
+        isImageSigned(t_firmware, t_metadata, t_cert, FlashLayout::CERT_PRIVATE_START);
+    const auto cycles = static_cast<std::uint32_t>(timebase.nowCycles() - start);
+
+    Shared::bootProfile.signatureCheckCycles = cycles;
+    Shared::bootProfile.signatureCheckUs     = cycles / timebase.cyclesPerUs();
+    Shared::bootProfile.signatureStatus =
+        signatureValid ? Shared::SignatureStatus::Verified : Shared::SignatureStatus::Failed;
+
+    return signatureValid;
+}
+
+// Masks the IRQs up to the ceiling while an entry is programmed
+struct SignatureCacheLock : PriorityLock<>
+{
+    SignatureCacheLock() : PriorityLock(LOCK_SITE("signature cache")) {}
+};
+
+// Masks the IRQs up to the ceiling while a marker word is programmed
+struct ErasedMarkerLock : PriorityLock<>
+{
+    ErasedMarkerLock() : PriorityLock(LOCK_SITE("erased marker")) {}
+};
+
 ClockManager clock;
 GpioManager  gpio;
 UartManager  uart;
 
 extern "C" int main()
 {
-    FlashWriterSTM32F4 writer;
-    BootFlagManager    flags(&writer);
-    ImageManager       image(&writer);
+    FlashWriterSTM32F4                    writer;
+    BootFlagManager                       flags(&writer);
+    ImageManager                          image(&writer);
+    SignatureCache<SignatureCacheLock>    signatures(&writer);
+    ErasedRegionTracker<ErasedMarkerLock> erasedRegions(&writer);
 
     clock.initialize(ClockErrorHandler);
-    gpio.initialize(gpioPinConfigs);
+    timebase.initialize();
+
+    Shared::bootProfile.magic                = Shared::BOOT_PROFILE_MAGIC;
+    Shared::bootProfile.signatureStatus      = Shared::SignatureStatus::NotChecked;
+    Shared::bootProfile.signatureCheckCycles = 0;
+    Shared::bootProfile.signatureCheckUs     = 0;
+
+    gpio.initialize();
     uart.initialize(UartId::Uart2, 115200);
-    UartReceiver receiver(*uart.getUart(), writer);
+    UartReceiver receiver(*uart.getUart(), writer, timebase);
 
     bool candidateReceived{false};
+    bool appSignatureChecked{false};
     auto red    = gpio.getPin(PinId::LD_RED);
     auto orange = gpio.getPin(PinId::LD_ORA);
 
@@ -64,15 +116,39 @@ extern "C" int main()
         Shared::firmwareUpdateFlag = 0;
         orange->set();
 
-        receiver.receiveImage(FlashLayout::NEW_BOOTLOADER2_START,
-                              FlashLayout::NEW_BOOTLOADER2_SIZE + FlashLayout::NEW_APP_TOTAL_SIZE);
-        orange->reset();
+        // The package starts with a manifest; only the listed components are transferred
+        // and programmed, the other slot stays erased and untouched
+        Firmware::UpdateManifest manifest{};
+        bool                     received =
+            receiver.receiveBuffer(reinterpret_cast<std::uint8_t*>(&manifest), sizeof(manifest));
 
-        candidateReceived = true;
+        // A host that stops sending leaves a partial candidate; it is erased below
+        if ((received == true) && (isManifestValid(manifest) == true))
+        {
+            if ((manifest.componentMask & Firmware::COMPONENT_BOOTSEC) != 0)
+            {
+                erasedRegions.invalidate(UpdateRegion::NewBootloader2);
+                received =
+                    receiver.receiveImage(FlashLayout::NEW_BOOTLOADER2_START,
+                                          manifest.bootSecSize) &&
+                    receiver.receiveImage(FlashLayout::NEW_BOOTLOADER2_METADATA_START,
+                                          Firmware::COMPONENT_TRAILER_SIZE);
+            }
+            if ((received == true) && ((manifest.componentMask & Firmware::COMPONENT_APP) != 0))
+            {
+                erasedRegions.invalidate(UpdateRegion::NewApp);
+                received = receiver.receiveImage(FlashLayout::NEW_APP_START, manifest.appSize) &&
+                           receiver.receiveImage(FlashLayout::NEW_APP_METADATA_START,
+                                                 Firmware::COMPONENT_TRAILER_SIZE);
+            }
+            candidateReceived = received;
+        }
+        orange->reset();
     }
 
     /**
-     * If flags == BootState::Staged then: App Image is compared with metadata
+     * If flags == BootState::Staged then: App Image is compared with metadata.
+     * isImageDiffrent() ignores an app slot without metadata (BootSec-only package).
      */
     if ((flags.getState() == BootState::Staged) || (candidateReceived == true))
     {
@@ -82,7 +158,9 @@ extern "C" int main()
         if (newAppCandidateDiffrent == true)
         {
             bool newAppCandidateCheck =
-                isImageAuthentic(FlashLayout::NEW_APP_START, FlashLayout::NEW_APP_METADATA_START);
+                isImageAuthentic(FlashLayout::NEW_APP_START, FlashLayout::NEW_APP_METADATA_START) &&
+                SignatureCheck(FlashLayout::NEW_APP_START, FlashLayout::NEW_APP_METADATA_START,
+                               FlashLayout::NEW_APP_CERT_START);
 
             if (newAppCandidateCheck == true)
             {
@@ -93,50 +171,82 @@ extern "C" int main()
                 image.writeImage(FlashLayout::NEW_APP_START, FlashLayout::APP_START,
                                  FlashLayout::NEW_APP_TOTAL_SIZE);
                 flags.setState(BootState::Applied);
+
+                // setState() erased the cache sector; remember the image just verified
+                if (Shared::bootProfile.signatureStatus == Shared::SignatureStatus::Verified)
+                {
+                    signatures.store(FlashLayout::APPLICATION_METADATA_START,
+                                     FlashLayout::APP_CERT_START);
+                }
+                appSignatureChecked = true;
             }
             else
             {
                 flags.setState(BootState::Failed);
             }
         }
-        image.clearImage(FlashLayout::NEW_APP_START, FlashLayout::NEW_APP_TOTAL_SIZE);
+
+        // A BootSec-only package leaves the app slot blank, no need to erase 384 KB again
+        if (erasedRegions.isErased(UpdateRegion::NewApp) == false)
+        {
+            image.clearImage(FlashLayout::NEW_APP_START, FlashLayout::NEW_APP_TOTAL_SIZE);
+            erasedRegions.markErased(UpdateRegion::NewApp);
+        }
     }
     else
     {
-        bool newAppCandidateFirmwareEmpty =
-            isImageEmpty(FlashLayout::NEW_APP_START, FlashLayout::NEW_APP_TOTAL_SIZE);
-        bool newAppCandidateMetaEmpty =
-            isImageEmpty(FlashLayout::NEW_APP_METADATA_START, FlashLayout::NEW_APP_METADATA_SIZE);
-        if ((newAppCandidateFirmwareEmpty == false) || (newAppCandidateMetaEmpty == false))
+        // The slot includes its metadata block, one check covers both
+        bool newAppCandidateEmpty = erasedRegions.isErased(UpdateRegion::NewApp);
+        if (newAppCandidateEmpty == false)
         {
             image.clearImage(FlashLayout::NEW_APP_START, FlashLayout::NEW_APP_TOTAL_SIZE);
+            erasedRegions.markErased(UpdateRegion::NewApp);
         }
     }
 
     bool appCheck =
         isImageAuthentic(FlashLayout::APP_START, FlashLayout::APPLICATION_METADATA_START);
 
+    // Public-key cost is paid once per image; later boots still hash the firmware and
+    // skip only the Ed25519 step when the cache holds this metadata and certificate
+    if ((appCheck == true) && (appSignatureChecked == false))
+    {
+        if ((isSignatureEnforced(FlashLayout::CERT_PRIVATE_START) == true) &&
+            (signatures.contains(FlashLayout::APPLICATION_METADATA_START,
+                                 FlashLayout::APP_CERT_START) == true))
+        {
+            appCheck = isImageHashValid(FlashLayout::APP_START,
+                                        FlashLayout::APPLICATION_METADATA_START);
+            Shared::bootProfile.signatureStatus =
+                appCheck ? Shared::SignatureStatus::Cached : Shared::SignatureStatus::Failed;
+        }
+        else
+        {
+            appCheck = SignatureCheck(FlashLayout::APP_START,
+                                      FlashLayout::APPLICATION_METADATA_START,
+                                      FlashLayout::APP_CERT_START);
+            if (Shared::bootProfile.signatureStatus == Shared::SignatureStatus::Verified)
+            {
+                signatures.store(FlashLayout::APPLICATION_METADATA_START,
+                                 FlashLayout::APP_CERT_START);
+            }
+        }
+    }
+
     if (appCheck == true)
     {
         red->reset();
         Bootloader::jumpToAddress(FlashLayout::APP_START);
     }
 
-    uint32_t timer{};
+    Deadline blink(timebase);
 
     while (true)
     {
-        /**
-         * @brief Blinking period depends on number of uC cycles per loop (~30 - 50):
-         *      Tc = 1/16MHz = 62.5ns,
-         *      Tloop = Tc x CyclePerLoop,
-         *      Ttoggle = Tloop x 1M,
-         *  Obserwed blinking period ~1Hz
-         */
-        if ((timer % 1000000) == 0)
+        if (blink.expired())
         {
+            blink.advance(500000);
             red->toggle();
         }
-        ++timer;
     }
 }
@@ -35,8 +35,8 @@ extern "C"
     void SysTick_Handler(void);
 // Callbacks
     void EXTI0_Callback(uint16_t gpioPinMask);
-    void USART2_Callback(uint8_t t_byte);
-    void SysTick_HeartBeat(void);
+    void USART2_Callback(uint32_t t_byte, uint32_t t_status);
+    void FaultCapture_Entry(void);
 #ifdef __cplusplus
 }
 #endif
@@ -38,45 +38,37 @@ void NMI_Handler(void)
 /**
  * @brief This function handles Hard fault interrupt.
  */
-void HardFault_Handler(void)
+__attribute__((naked)) void HardFault_Handler(void)
 {
-    while (1)
-    {
-        ;
-    }
+    // Snapshot into .noinit and reset, see fault_capture_stm32.hpp
+    __asm volatile("b FaultCapture_Entry");
 }
 
 /**
  * @brief This function handles Memory management fault.
  */
-void MemManage_Handler(void)
+__attribute__((naked)) void MemManage_Handler(void)
 {
-    while (1)
-    {
-        ;
-    }
+    // Snapshot into .noinit and reset, see fault_capture_stm32.hpp
+    __asm volatile("b FaultCapture_Entry");
 }
 
 /**
  * @brief This function handles Pre-fetch fault, memory access fault.
  */
-void BusFault_Handler(void)
+__attribute__((naked)) void BusFault_Handler(void)
 {
-    while (1)
-    {
-        ;
-    }
+    // Snapshot into .noinit and reset, see fault_capture_stm32.hpp
+    __asm volatile("b FaultCapture_Entry");
 }
 
 /**
  * @brief This function handles Undefined instruction or illegal state.
  */
-void UsageFault_Handler(void)
+__attribute__((naked)) void UsageFault_Handler(void)
 {
-    while (1)
-    {
-        ;
-    }
+    // Snapshot into .noinit and reset, see fault_capture_stm32.hpp
+    __asm volatile("b FaultCapture_Entry");
 }
 
 /**
@@ -94,14 +86,15 @@ void DebugMon_Handler(void)
 /* please refer to the startup file (startup_stm32f4xx.s).                    */
 /******************************************************************************/
 
+#if !defined(APP_RTOS) // The PilOs port drives SysTick as its kernel tick
 /**
  * @brief This function handles System tick timer.
  */
 void SysTick_Handler(void)
 {
     HAL_IncTick(); // Required if using HAL
-    SysTick_HeartBeat();
 }
+#endif
 
 /**
  * @brief This function handles External Interrupts
@@ -120,9 +113,11 @@ void EXTI0_IRQHandler(void)
  */
 void USART2_IRQHandler(void)
 {
-    if (USART2->SR & USART_SR_RXNE)
+    const uint32_t status = USART2->SR;
+
+    if (status & (USART_SR_RXNE | USART_SR_ORE))
     {
-        volatile uint32_t data = USART2->DR; // Read clears RXNE
-        USART2_Callback(data);
+        volatile uint32_t data = USART2->DR; // SR then DR read clears RXNE and ORE
+        USART2_Callback(data, status);
     }
 }
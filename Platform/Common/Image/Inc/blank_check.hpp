@@ -0,0 +1,21 @@
+/**
+ * @file      Platform/Common/Image/Inc/blank_check.hpp
+ * @author    it32bit
+ * @brief     Erased-flash check shared by the bootloaders and the erased region tracker.
+ *            Plain memory reads only, so it also runs on the host.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef BLANK_CHECK_HPP
+#define BLANK_CHECK_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/** @brief True when every byte of [t_data, t_data + t_size) reads 0xFF. */
+bool isImageEmpty(std::uintptr_t t_data, std::size_t t_size);
+
+#endif // BLANK_CHECK_HPP
@@ -2,8 +2,11 @@
 #define IMAGE_MANAGER_HPP
 
 #include <cstdint>
+#include "blank_check.hpp"
 #include "flash_layout.hpp"
 #include "pil_flash_writer.hpp"
+#include "firmware_metadata.hpp"
+#include "update_manifest.hpp"
 #include "stm32f4xx.h"
 
 class ImageManager
@@ -23,36 +26,20 @@ class ImageManager
 
 bool isImageStaged(std::uintptr_t t_metadata);
 bool isImageAuthentic(std::uintptr_t t_firmware, std::uintptr_t t_metadata);
+/**
+ * @brief True only when the candidate slot carries valid metadata that differs from the
+ *        active image, so a slot left empty by a single-component update is skipped.
+ */
 bool isImageDiffrent(std::uintptr_t t_meta_active, std::uintptr_t t_meta_candidate);
-bool isImageEmpty(std::uintptr_t t_firmware, std::size_t t_size);
 
-class CriticalSection
-{
-  public:
-    CriticalSection()
-    {
-        // Save current PRIMASK state
-        previousState = __get_PRIMASK();
-        // Disable interrupts globally
-        __disable_irq();
-    }
-
-    ~CriticalSection()
-    {
-        // Restore previous state
-        if (!previousState)
-        {
-            __enable_irq();
-        }
-        // If previousState == 1, interrupts were already disabled → leave disabled
-    }
-
-    // Non-copyable
-    CriticalSection(const CriticalSection&)            = delete;
-    CriticalSection& operator=(const CriticalSection&) = delete;
-
-  private:
-    uint32_t previousState;
-};
+/**
+ * @brief Signature policy: enforced only once a PublicKeyStore has been provisioned at
+ *        t_key_store. A blank certificate sector keeps the CRC-only behaviour of older devices.
+ */
+bool isSignatureEnforced(std::uintptr_t t_key_store);
+/** @brief SHA-256 of the firmware against Metadata::firmwareHash; no public-key work. */
+bool isImageHashValid(std::uintptr_t t_firmware, std::uintptr_t t_metadata);
+bool isImageSigned(std::uintptr_t t_firmware, std::uintptr_t t_metadata, std::uintptr_t t_cert,
+                   std::uintptr_t t_key_store);
 
 #endif // IMAGE_MANAGER_HPP
@@ -10,6 +10,32 @@ extern volatile std::uint32_t firmwareUpdateFlag;
 
 constexpr std::uint32_t PREPARE_TO_RECEIVE_BINARY = 0xFEEDC0DE;
 
+// Signature check outcome reported by BootSec
+enum class SignatureStatus : std::uint32_t
+{
+    NotChecked    = 0,
+    Verified      = 1, // Full Ed25519 verification ran on this boot
+    Cached        = 2, // Image matched an entry in the signature cache
+    Failed        = 3,
+    Unprovisioned = 4  // No public key in the certificate sector, check skipped
+};
+
+/**
+ * @brief Filled by BootSec right before the jump, read by the App. Lives in .shared_ram.profile
+ *        (NOLOAD) so it survives the jump; magic tells a fresh boot from power-on garbage.
+ */
+struct BootProfile
+{
+    std::uint32_t   magic;
+    SignatureStatus signatureStatus;
+    std::uint32_t   signatureCheckCycles;
+    std::uint32_t   signatureCheckUs;
+};
+
+constexpr std::uint32_t BOOT_PROFILE_MAGIC = 0xB007B007;
+
+extern volatile BootProfile bootProfile;
+
 } // namespace Shared
 
 #endif // SHARED_MEMORY_HPP
@@ -0,0 +1,23 @@
+/**
+ * @file      Platform/Common/Image/Inc/update_manifest.hpp
+ * @author    it32bit
+ * @brief     Acceptance check of the UART update package header, run by BootSec before
+ *            anything is programmed. No MCU dependency, so it also runs on the host.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef UPDATE_MANIFEST_HPP
+#define UPDATE_MANIFEST_HPP
+
+#include "firmware_metadata.hpp"
+
+/**
+ * @brief True when magic, format version and check word match, componentMask lists only
+ *        known components, and every listed component plus its trailer fits its slot.
+ */
+bool isManifestValid(const Firmware::UpdateManifest& t_manifest);
+
+#endif // UPDATE_MANIFEST_HPP
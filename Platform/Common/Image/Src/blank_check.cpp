@@ -0,0 +1,56 @@
+/**
+ * @file      Platform/Common/Image/Src/blank_check.cpp
+ * @author    it32bit
+ * @brief     Erased-flash check shared by the bootloaders and the erased region tracker.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#include "blank_check.hpp"
+
+bool isImageEmpty(std::uintptr_t t_data, std::size_t t_size)
+{
+    constexpr std::uint32_t ERASED_WORD = 0xFFFFFFFF;
+    constexpr std::size_t   UNROLL      = 8; // 8 words per iteration, one LDM on Cortex-M4
+
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(t_data);
+
+    // Leading bytes up to the first word boundary
+    while ((t_size != 0) && ((reinterpret_cast<std::uintptr_t>(bytes) & 0x3) != 0))
+    {
+        if (*bytes != 0xFF)
+            return false;
+        ++bytes;
+        --t_size;
+    }
+
+    const auto* words = reinterpret_cast<const std::uint32_t*>(bytes);
+    std::size_t wordCount = t_size / sizeof(std::uint32_t);
+
+    for (; wordCount >= UNROLL; wordCount -= UNROLL, words += UNROLL)
+    {
+        // AND-reduce the block, a single compare then decides for 32 bytes
+        const std::uint32_t block = words[0] & words[1] & words[2] & words[3] & words[4] &
+                                    words[5] & words[6] & words[7];
+        if (block != ERASED_WORD)
+            return false; // Some data exists
+    }
+
+    for (; wordCount != 0; --wordCount, ++words)
+    {
+        if (*words != ERASED_WORD)
+            return false;
+    }
+
+    // Trailing bytes
+    bytes = reinterpret_cast<const std::uint8_t*>(words);
+    for (std::size_t i = 0; i < (t_size % sizeof(std::uint32_t)); ++i)
+    {
+        if (bytes[i] != 0xFF)
+            return false;
+    }
+
+    return true; // Fully erased
+}
@@ -1,16 +1,20 @@
+#include <cstring>
 #include <span>
 #include "image_manager.hpp"
+#include "priority_lock_stm32.hpp"
 #include "stm32f4xx.h"
 #include "flash_layout.hpp"
 #include "firmware_metadata.hpp"
 #include "crc32_check.hpp"
+#include "sha256.hpp"
+#include "ed25519_verify.hpp"
 
 ImageManager::ImageManager(IFlashWriter* writer) : m_writer(writer) {}
 
 void ImageManager::writeImage(std::uintptr_t t_image_src, std::uintptr_t t_image_dst,
                               std::size_t t_image_size)
 {
-    CriticalSection criticalSection; // interrupts disabled here
+    PriorityLock<> lock(LOCK_SITE("image write")); // Masks the IRQs up to the ceiling
 
     // Image can be bigger then sector size
     std::uintptr_t current_addr = t_image_dst;
@@ -26,14 +30,12 @@ void ImageManager::writeImage(std::uintptr_t t_image_src, std::uintptr_t t_image
     }
 
     m_writer->writeImage(t_image_src, t_image_dst, t_image_size);
-
-    // interrupts enabled here (only if previous they were enabled)
 }
 
 void ImageManager::writeMeta(std::uintptr_t t_image_src, std::uintptr_t t_image_dst,
                              std::size_t t_image_size)
 {
-    CriticalSection criticalSection; // interrupts disabled here
+    PriorityLock<> lock(LOCK_SITE("image metadata")); // Masks the IRQs up to the ceiling
 
     const Firmware::Metadata* metadata = reinterpret_cast<const Firmware::Metadata*>(t_image_dst);
 
@@ -49,7 +51,7 @@ void ImageManager::writeMeta(std::uintptr_t t_image_src, std::uintptr_t t_image_
 
 void ImageManager::clearImage(std::uintptr_t t_image_start, std::size_t t_image_size)
 {
-    CriticalSection criticalSection; // interrupts disabled here
+    PriorityLock<> lock(LOCK_SITE("image clear")); // Masks the IRQs up to the ceiling
 
     // Image can be bigger then sector size
     std::uintptr_t current_addr = t_image_start;
@@ -107,6 +109,11 @@ bool isImageDiffrent(std::uintptr_t t_meta_active, std::uintptr_t t_meta_candida
 
     bool result{false};
 
+    if (candidate->magic != Firmware::METADATA_MAGIC)
+    {
+        return result; // Component not part of this update
+    }
+
     if ((active->version != candidate->version) || (active->firmwareCRC != candidate->firmwareCRC))
     {
         result = true;
@@ -115,15 +122,57 @@ bool isImageDiffrent(std::uintptr_t t_meta_active, std::uintptr_t t_meta_candida
     return result;
 }
 
-bool isImageEmpty(std::uintptr_t t_data, std::size_t t_size)
+bool isSignatureEnforced(std::uintptr_t t_key_store)
+{
+    const Firmware::PublicKeyStore* store =
+        reinterpret_cast<const Firmware::PublicKeyStore*>(t_key_store);
+
+    return (store->magic == Firmware::PUBLIC_KEY_MAGIC) &&
+           (store->algorithm == Firmware::SIGNATURE_ALG_ED25519);
+}
+
+bool isImageHashValid(std::uintptr_t t_firmware, std::uintptr_t t_metadata)
+{
+    const Firmware::Metadata* metadata = reinterpret_cast<const Firmware::Metadata*>(t_metadata);
+
+    if ((metadata->magic != Firmware::METADATA_MAGIC) ||
+        (metadata->firmwareSize > FlashLayout::APP_SIZE))
+    {
+        return false;
+    }
+
+    std::span<const std::uint8_t> firmware{reinterpret_cast<const std::uint8_t*>(t_firmware),
+                                           metadata->firmwareSize};
+
+    const Integrity::Sha256::Digest digest = Integrity::Sha256::compute(firmware);
+
+    return std::memcmp(digest.data(), metadata->firmwareHash, digest.size()) == 0;
+}
+
+bool isImageSigned(std::uintptr_t t_firmware, std::uintptr_t t_metadata, std::uintptr_t t_cert,
+                   std::uintptr_t t_key_store)
 {
-    std::span<const std::uint8_t> image{reinterpret_cast<const std::uint8_t*>(t_data), t_size};
+    const Firmware::Certificate*    cert = reinterpret_cast<const Firmware::Certificate*>(t_cert);
+    const Firmware::PublicKeyStore* store =
+        reinterpret_cast<const Firmware::PublicKeyStore*>(t_key_store);
 
-    for (std::uint8_t byte : image)
+    if ((cert->magic != Firmware::CERTIFICATE_MAGIC) ||
+        (cert->algorithm != Firmware::SIGNATURE_ALG_ED25519) || (cert->keyId != store->keyId))
     {
-        if (byte != 0xFF)
-            return false; // Some data exists
+        return false;
+    }
+
+    // The signature covers the metadata only, so bind the firmware to it through the hash
+    if (isImageHashValid(t_firmware, t_metadata) == false)
+    {
+        return false;
     }
 
-    return true; // Fully erased
+    std::span<const std::uint8_t> message{reinterpret_cast<const std::uint8_t*>(t_metadata),
+                                          sizeof(Firmware::Metadata)};
+
+    return Integrity::Ed25519Verifier::verify(
+        std::span<const std::uint8_t, Integrity::Ed25519Verifier::SignatureSize>(cert->signature),
+        message,
+        std::span<const std::uint8_t, Integrity::Ed25519Verifier::PublicKeySize>(store->publicKey));
 }
@@ -5,4 +5,6 @@ namespace Shared
 
 alignas(4) __attribute__((section(".shared_ram"))) volatile std::uint32_t firmwareUpdateFlag;
 
+alignas(4) __attribute__((section(".shared_ram.profile"))) volatile BootProfile bootProfile;
+
 }
@@ -0,0 +1,45 @@
+/**
+ * @file      Platform/Common/Image/Src/update_manifest.cpp
+ * @author    it32bit
+ * @brief     Acceptance check of the UART update package header.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#include "update_manifest.hpp"
+#include "flash_layout.hpp"
+
+bool isManifestValid(const Firmware::UpdateManifest& t_manifest)
+{
+    constexpr std::uint32_t KNOWN_COMPONENTS = Firmware::COMPONENT_BOOTSEC | Firmware::COMPONENT_APP;
+
+    const std::uint32_t check = t_manifest.magic ^ t_manifest.formatVersion ^
+                                t_manifest.componentMask ^ t_manifest.bootSecSize ^
+                                t_manifest.appSize ^ t_manifest.reserved[0] ^ t_manifest.reserved[1];
+
+    if ((t_manifest.magic != Firmware::UPDATE_MANIFEST_MAGIC) ||
+        (t_manifest.formatVersion != Firmware::UPDATE_MANIFEST_VERSION) ||
+        (t_manifest.check != check) || (t_manifest.componentMask == 0) ||
+        ((t_manifest.componentMask & ~KNOWN_COMPONENTS) != 0))
+    {
+        return false;
+    }
+
+    if (((t_manifest.componentMask & Firmware::COMPONENT_BOOTSEC) != 0) &&
+        ((t_manifest.bootSecSize == 0) ||
+         (t_manifest.bootSecSize >
+          FlashLayout::NEW_BOOTLOADER2_SIZE - Firmware::COMPONENT_TRAILER_SIZE)))
+    {
+        return false;
+    }
+
+    if (((t_manifest.componentMask & Firmware::COMPONENT_APP) != 0) &&
+        ((t_manifest.appSize == 0) || (t_manifest.appSize > FlashLayout::NEW_APP_SIZE)))
+    {
+        return false;
+    }
+
+    return true;
+}
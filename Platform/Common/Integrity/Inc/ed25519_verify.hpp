@@ -0,0 +1,44 @@
+/**
+ * @file      Platform/Common/Integrity/Inc/ed25519_verify.hpp
+ * @author    it32bit
+ * @brief     Ed25519 (RFC 8032) signature verification for firmware images.
+ *
+ * @details   Verification only - the device never holds a signing key. Field elements mod
+ *            2^255-19 are kept as 8x32-bit limbs, so every multiply-accumulate step is a
+ *            32x32+32+32 -> 64 operation that GCC lowers to UMAAL on Cortex-M4. All field and
+ *            point arithmetic runs in fixed time (no secret-dependent branches or indexing).
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef ED25519_VERIFY_HPP
+#define ED25519_VERIFY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Integrity
+{
+
+class Ed25519Verifier
+{
+  public:
+    static constexpr std::size_t PublicKeySize = 32;
+    static constexpr std::size_t SignatureSize = 64;
+
+    /**
+     * @brief Verify an Ed25519 signature over t_message.
+     * @return true only for a canonical signature (S < L, canonical point encodings)
+     *         that matches t_public_key.
+     */
+    static bool verify(std::span<const std::uint8_t, SignatureSize> t_signature,
+                       std::span<const std::uint8_t>                t_message,
+                       std::span<const std::uint8_t, PublicKeySize> t_public_key);
+};
+
+} // namespace Integrity
+
+#endif // ED25519_VERIFY_HPP
@@ -0,0 +1,41 @@
+/**
+ * @file      Platform/Common/Integrity/Inc/hmac_sha256.hpp
+ * @author    it32bit
+ * @brief     HMAC-SHA256 (RFC 2104) on top of the portable Sha256, used to key flash records
+ *            to a device secret.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef HMAC_SHA256_HPP
+#define HMAC_SHA256_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "sha256.hpp"
+
+namespace Integrity
+{
+
+class HmacSha256
+{
+  public:
+    explicit HmacSha256(std::span<const std::uint8_t> t_key);
+
+    void           update(std::span<const std::uint8_t> t_data);
+    Sha256::Digest finish();
+
+  private:
+    static constexpr std::size_t BlockSize = 64;
+
+    Sha256                              m_inner;
+    std::array<std::uint8_t, BlockSize> m_outerPad{}; // Key ^ opad, kept until finish()
+};
+
+} // namespace Integrity
+
+#endif // HMAC_SHA256_HPP
@@ -0,0 +1,49 @@
+/**
+ * @file      Platform/Common/Integrity/Inc/sha256.hpp
+ * @author    it32bit
+ * @brief     Portable SHA-256 (FIPS 180-4) used to check the firmware hash stored in metadata.
+ *            The STM32F407 has no HASH peripheral, so this runs in software.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef SHA256_HPP
+#define SHA256_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Integrity
+{
+
+class Sha256
+{
+  public:
+    static constexpr std::size_t DigestSize = 32;
+    using Digest                            = std::array<std::uint8_t, DigestSize>;
+
+    Sha256();
+
+    void   update(std::span<const std::uint8_t> t_data);
+    Digest finish();
+
+    static Digest compute(std::span<const std::uint8_t> t_data);
+
+  private:
+    static constexpr std::size_t BlockSize = 64;
+
+    void processBlock(const std::uint8_t* t_block);
+
+    std::array<std::uint32_t, 8>         m_state;
+    std::array<std::uint8_t, BlockSize> m_block{};
+    std::size_t                          m_blockLength{0};
+    std::uint64_t                        m_totalLength{0};
+};
+
+} // namespace Integrity
+
+#endif // SHA256_HPP
@@ -0,0 +1,48 @@
+/**
+ * @file      Platform/Common/Integrity/Inc/sha512.hpp
+ * @author    it32bit
+ * @brief     Portable SHA-512 (FIPS 180-4), required by Ed25519 to hash R || A || M.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef SHA512_HPP
+#define SHA512_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Integrity
+{
+
+class Sha512
+{
+  public:
+    static constexpr std::size_t DigestSize = 64;
+    using Digest                            = std::array<std::uint8_t, DigestSize>;
+
+    Sha512();
+
+    void   update(std::span<const std::uint8_t> t_data);
+    Digest finish();
+
+    static Digest compute(std::span<const std::uint8_t> t_data);
+
+  private:
+    static constexpr std::size_t BlockSize = 128;
+
+    void processBlock(const std::uint8_t* t_block);
+
+    std::array<std::uint64_t, 8>         m_state;
+    std::array<std::uint8_t, BlockSize> m_block{};
+    std::size_t                          m_blockLength{0};
+    std::uint64_t                        m_totalLength{0};
+};
+
+} // namespace Integrity
+
+#endif // SHA512_HPP
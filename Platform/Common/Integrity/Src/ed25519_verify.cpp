@@ -0,0 +1,554 @@
+/**
+ * @file      Platform/Common/Integrity/Src/ed25519_verify.cpp
+ * @author    it32bit
+ * @brief     Ed25519 signature verification (RFC 8032, section 5.1.7).
+ *
+ * @details   Curve arithmetic follows the well-known TweetNaCl structure (extended twisted
+ *            Edwards coordinates, unified addition, Montgomery-ladder style scalar multiply
+ *            with conditional swaps), but the field layer is re-written for 32-bit cores:
+ *
+ *            - Fe holds 8 little-endian 32-bit limbs, value kept loosely reduced below 2^256
+ *            - 2^256 = 38 (mod p) is used to fold carries out of the top limb
+ *            - mul() is a plain 8x8 schoolbook product where every inner step is
+ *              a * b + t + carry, which is exactly one UMAAL on Cortex-M4
+ *            - freeze() produces the canonical representative in constant time
+ *
+ *            Verification only handles public data, but the field and ladder code stays
+ *            branch-free so it can be reused for signing-side operations in host tools.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#include <array>
+#include "ed25519_verify.hpp"
+#include "sha512.hpp"
+
+namespace Integrity
+{
+
+namespace
+{
+using Fe = std::array<std::uint32_t, 8>;
+
+struct Point
+{
+    Fe x;
+    Fe y;
+    Fe z;
+    Fe t;
+};
+
+// clang-format off
+constexpr Fe FE_ZERO = {0, 0, 0, 0, 0, 0, 0, 0};
+constexpr Fe FE_ONE  = {1, 0, 0, 0, 0, 0, 0, 0};
+
+// d = -121665/121666 and 2*d
+constexpr Fe FE_D2 = {0x26b2f159, 0xebd69b94, 0x8283b156, 0x00e0149a,
+                      0xeef3d130, 0x198e80f2, 0x56dffce7, 0x2406d9dc};
+constexpr Fe FE_D  = {0x135978a3, 0x75eb4dca, 0x4141d8ab, 0x00700a4d,
+                      0x7779e898, 0x8cc74079, 0x2b6ffe73, 0x52036cee};
+
+// sqrt(-1) = 2^((p-1)/4)
+constexpr Fe FE_SQRTM1 = {0x4a0ea0b0, 0xc4ee1b27, 0xad2fe478, 0x2f431806,
+                          0x3dfbd7a7, 0x2b4d0099, 0x4fc1df0b, 0x2b832480};
+
+// Base point B (x, y = 4/5, t = x*y)
+constexpr Fe FE_BASE_X = {0x8f25d51a, 0xc9562d60, 0x9525a7b2, 0x692cc760,
+                          0xfdd6dc5c, 0xc0a4e231, 0xcd6e53fe, 0x216936d3};
+constexpr Fe FE_BASE_Y = {0x66666658, 0x66666666, 0x66666666, 0x66666666,
+                          0x66666666, 0x66666666, 0x66666666, 0x66666666};
+constexpr Fe FE_BASE_T = {0xa5b7dda3, 0x6dde8ab3, 0x775152f5, 0x20f09f80,
+                          0x64abe37d, 0x66ea4e8e, 0xd78b7665, 0x67875f0f};
+
+// Group order L = 2^252 + 27742317777372353535851937790883648493, little-endian bytes
+constexpr std::array<std::int64_t, 32> ORDER_L = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10};
+// clang-format on
+
+// -----------------------------------------------------------------------------
+// Field arithmetic mod p = 2^255 - 19
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Fold a carry out of bit 256 back into the value (2^256 = 38 mod p).
+ * @note  Two rounds always run: the second one can only be hit when the first wrapped,
+ *        and then the value is small, so no third carry exists.
+ */
+void feFold(Fe& r, std::uint64_t t_carry)
+{
+    for (int round = 0; round < 2; ++round)
+    {
+        std::uint64_t c = t_carry * 38;
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            c += r[i];
+            r[i] = static_cast<std::uint32_t>(c);
+            c >>= 32;
+        }
+        t_carry = c;
+    }
+}
+
+void feAdd(Fe& r, const Fe& a, const Fe& b)
+{
+    std::uint64_t c = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        c += static_cast<std::uint64_t>(a[i]) + b[i];
+        r[i] = static_cast<std::uint32_t>(c);
+        c >>= 32;
+    }
+    feFold(r, c);
+}
+
+void feSub(Fe& r, const Fe& a, const Fe& b)
+{
+    // A borrow out of bit 256 means the result wrapped by 2^256, i.e. is 38 too large
+    std::int64_t c = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        c += static_cast<std::int64_t>(a[i]) - b[i];
+        r[i] = static_cast<std::uint32_t>(c);
+        c >>= 32;
+    }
+    for (int round = 0; round < 2; ++round)
+    {
+        c *= 38;
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            c += r[i];
+            r[i] = static_cast<std::uint32_t>(c);
+            c >>= 32;
+        }
+    }
+}
+
+void feMul(Fe& r, const Fe& a, const Fe& b)
+{
+    std::array<std::uint32_t, 16> t{};
+
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        std::uint32_t carry = 0;
+        for (std::size_t j = 0; j < 8; ++j)
+        {
+            // UMAAL: RdHi:RdLo = Rn * Rm + RdHi + RdLo
+            const std::uint64_t uv = static_cast<std::uint64_t>(a[i]) * b[j] + t[i + j] + carry;
+            t[i + j]               = static_cast<std::uint32_t>(uv);
+            carry                  = static_cast<std::uint32_t>(uv >> 32);
+        }
+        t[i + 8] = carry;
+    }
+
+    std::uint64_t c = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        c += static_cast<std::uint64_t>(t[i + 8]) * 38 + t[i];
+        r[i] = static_cast<std::uint32_t>(c);
+        c >>= 32;
+    }
+    feFold(r, c);
+}
+
+void feSqr(Fe& r, const Fe& a)
+{
+    feMul(r, a, a);
+}
+
+/**
+ * @brief Reduce to the canonical representative in [0, p).
+ */
+void feFreeze(Fe& r)
+{
+    std::uint64_t c = static_cast<std::uint64_t>(r[7] >> 31) * 19;
+    r[7] &= 0x7FFFFFFF;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        c += r[i];
+        r[i] = static_cast<std::uint32_t>(c);
+        c >>= 32;
+    }
+
+    // r < 2^255 + 19 now; subtract p when r + 19 reaches 2^255
+    Fe t;
+    c = 19;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        c += r[i];
+        t[i] = static_cast<std::uint32_t>(c);
+        c >>= 32;
+    }
+    const std::uint32_t mask = 0U - (t[7] >> 31);
+    t[7] &= 0x7FFFFFFF;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        r[i] = (t[i] & mask) | (r[i] & ~mask);
+    }
+}
+
+void fePack(std::uint8_t* t_out, const Fe& a)
+{
+    Fe t = a;
+    feFreeze(t);
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        t_out[i * 4 + 0] = static_cast<std::uint8_t>(t[i]);
+        t_out[i * 4 + 1] = static_cast<std::uint8_t>(t[i] >> 8);
+        t_out[i * 4 + 2] = static_cast<std::uint8_t>(t[i] >> 16);
+        t_out[i * 4 + 3] = static_cast<std::uint8_t>(t[i] >> 24);
+    }
+}
+
+void feUnpack(Fe& r, const std::uint8_t* t_in)
+{
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        r[i] = static_cast<std::uint32_t>(t_in[i * 4 + 0]) |
+               (static_cast<std::uint32_t>(t_in[i * 4 + 1]) << 8) |
+               (static_cast<std::uint32_t>(t_in[i * 4 + 2]) << 16) |
+               (static_cast<std::uint32_t>(t_in[i * 4 + 3]) << 24);
+    }
+    r[7] &= 0x7FFFFFFF;
+}
+
+bool feEqual(const Fe& a, const Fe& b)
+{
+    Fe x = a;
+    Fe y = b;
+    feFreeze(x);
+    feFreeze(y);
+
+    std::uint32_t diff = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        diff |= x[i] ^ y[i];
+    }
+    return diff == 0;
+}
+
+std::uint32_t feParity(const Fe& a)
+{
+    Fe t = a;
+    feFreeze(t);
+    return t[0] & 1U;
+}
+
+/**
+ * @brief Constant-time conditional swap, t_swap must be 0 or 1.
+ */
+void feSwap(Fe& a, Fe& b, std::uint32_t t_swap)
+{
+    const std::uint32_t mask = 0U - t_swap;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        const std::uint32_t t = mask & (a[i] ^ b[i]);
+        a[i] ^= t;
+        b[i] ^= t;
+    }
+}
+
+/**
+ * @brief r = a^(p-2) = 1/a. Exponent bits are all ones except bits 2 and 4.
+ */
+void feInvert(Fe& r, const Fe& a)
+{
+    Fe c = a;
+    for (int bit = 253; bit >= 0; --bit)
+    {
+        feSqr(c, c);
+        if (bit != 2 && bit != 4)
+        {
+            feMul(c, c, a);
+        }
+    }
+    r = c;
+}
+
+/**
+ * @brief r = a^((p-5)/8). Exponent bits are all ones except bit 1.
+ */
+void fePow2523(Fe& r, const Fe& a)
+{
+    Fe c = a;
+    for (int bit = 250; bit >= 0; --bit)
+    {
+        feSqr(c, c);
+        if (bit != 1)
+        {
+            feMul(c, c, a);
+        }
+    }
+    r = c;
+}
+
+// -----------------------------------------------------------------------------
+// Group arithmetic (extended twisted Edwards coordinates)
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief p = p + q, unified formula (also valid for doubling).
+ */
+void pointAdd(Point& p, const Point& q)
+{
+    Fe a, b, c, d, t, e, f, g, h;
+
+    feSub(a, p.y, p.x);
+    feSub(t, q.y, q.x);
+    feMul(a, a, t);
+    feAdd(b, p.x, p.y);
+    feAdd(t, q.x, q.y);
+    feMul(b, b, t);
+    feMul(c, p.t, q.t);
+    feMul(c, c, FE_D2);
+    feMul(d, p.z, q.z);
+    feAdd(d, d, d);
+    feSub(e, b, a);
+    feSub(f, d, c);
+    feAdd(g, d, c);
+    feAdd(h, b, a);
+
+    feMul(p.x, e, f);
+    feMul(p.y, h, g);
+    feMul(p.z, g, f);
+    feMul(p.t, e, h);
+}
+
+void pointSwap(Point& p, Point& q, std::uint32_t t_swap)
+{
+    feSwap(p.x, q.x, t_swap);
+    feSwap(p.y, q.y, t_swap);
+    feSwap(p.z, q.z, t_swap);
+    feSwap(p.t, q.t, t_swap);
+}
+
+/**
+ * @brief p = s * q for a 256-bit little-endian scalar, fixed sequence of operations.
+ * @note  q is used as ladder scratch and is clobbered.
+ */
+void pointScalarMul(Point& p, Point& q, const std::uint8_t* t_scalar)
+{
+    p = Point{FE_ZERO, FE_ONE, FE_ONE, FE_ZERO};
+
+    for (int i = 255; i >= 0; --i)
+    {
+        const std::uint32_t bit = (t_scalar[i / 8] >> (i & 7)) & 1U;
+        pointSwap(p, q, bit);
+        pointAdd(q, p);
+        pointAdd(p, p);
+        pointSwap(p, q, bit);
+    }
+}
+
+void pointScalarBase(Point& p, const std::uint8_t* t_scalar)
+{
+    Point base{FE_BASE_X, FE_BASE_Y, FE_ONE, FE_BASE_T};
+    pointScalarMul(p, base, t_scalar);
+}
+
+void pointPack(std::uint8_t* t_out, const Point& p)
+{
+    Fe zInv, x, y;
+    feInvert(zInv, p.z);
+    feMul(x, p.x, zInv);
+    feMul(y, p.y, zInv);
+    fePack(t_out, y);
+    t_out[31] ^= static_cast<std::uint8_t>(feParity(x) << 7);
+}
+
+/**
+ * @brief Decode a public key and negate it (r = -A), as needed for S*B - h*A.
+ * @return false for non-canonical or off-curve encodings.
+ */
+bool pointUnpackNegated(Point& r, const std::uint8_t* t_in)
+{
+    Fe num, den, den2, den4, den6, t, chk;
+
+    r.z = FE_ONE;
+    feUnpack(r.y, t_in);
+
+    // Reject y >= p (non-canonical encoding)
+    Fe canonical = r.y;
+    feFreeze(canonical);
+    if (canonical != r.y)
+    {
+        return false;
+    }
+
+    feSqr(num, r.y);
+    feMul(den, num, FE_D);
+    feSub(num, num, r.z); // u = y^2 - 1
+    feAdd(den, r.z, den); // v = d*y^2 + 1
+
+    // x = u * v^3 * (u * v^7)^((p-5)/8)
+    feSqr(den2, den);
+    feSqr(den4, den2);
+    feMul(den6, den4, den2);
+    feMul(t, den6, num);
+    feMul(t, t, den);
+
+    fePow2523(t, t);
+    feMul(t, t, num);
+    feMul(t, t, den);
+    feMul(t, t, den);
+    feMul(r.x, t, den);
+
+    feSqr(chk, r.x);
+    feMul(chk, chk, den);
+    if (!feEqual(chk, num))
+    {
+        feMul(r.x, r.x, FE_SQRTM1);
+    }
+
+    feSqr(chk, r.x);
+    feMul(chk, chk, den);
+    if (!feEqual(chk, num))
+    {
+        return false;
+    }
+
+    const std::uint32_t sign = t_in[31] >> 7;
+    if (feEqual(r.x, FE_ZERO) && (sign == 1U))
+    {
+        return false;
+    }
+
+    // Choose the root with the opposite sign, which yields -A
+    if (feParity(r.x) == sign)
+    {
+        feSub(r.x, FE_ZERO, r.x);
+    }
+
+    feMul(r.t, r.x, r.y);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Scalars mod L
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Reduce a 512-bit little-endian value (as signed byte limbs) modulo L.
+ */
+void scalarModL(std::uint8_t* t_out, std::array<std::int64_t, 64>& x)
+{
+    std::int64_t carry = 0;
+
+    for (int i = 63; i >= 32; --i)
+    {
+        carry = 0;
+        int j = i - 32;
+        for (; j < i - 12; ++j)
+        {
+            x[j] += carry - 16 * x[i] * ORDER_L[j - (i - 32)];
+            carry = (x[j] + 128) >> 8;
+            x[j] -= carry * 256;
+        }
+        x[j] += carry;
+        x[i] = 0;
+    }
+
+    carry = 0;
+    for (std::size_t j = 0; j < 32; ++j)
+    {
+        x[j] += carry - (x[31] >> 4) * ORDER_L[j];
+        carry = x[j] >> 8;
+        x[j] &= 255;
+    }
+    for (std::size_t j = 0; j < 32; ++j)
+    {
+        x[j] -= carry * ORDER_L[j];
+    }
+    for (std::size_t i = 0; i < 32; ++i)
+    {
+        x[i + 1] += x[i] >> 8;
+        t_out[i] = static_cast<std::uint8_t>(x[i] & 255);
+    }
+}
+
+void scalarReduce(std::uint8_t* t_out, const std::uint8_t* t_wide)
+{
+    std::array<std::int64_t, 64> x;
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        x[i] = t_wide[i];
+    }
+    scalarModL(t_out, x);
+}
+
+/**
+ * @brief RFC 8032 requires 0 <= S < L (rejects malleable signatures).
+ */
+bool scalarIsCanonical(const std::uint8_t* t_scalar)
+{
+    for (int i = 31; i >= 0; --i)
+    {
+        const auto limb = static_cast<std::int64_t>(t_scalar[i]);
+        if (limb < ORDER_L[i])
+        {
+            return true;
+        }
+        if (limb > ORDER_L[i])
+        {
+            return false;
+        }
+    }
+    return false; // S == L
+}
+
+bool bytesEqual(const std::uint8_t* a, const std::uint8_t* b, std::size_t t_size)
+{
+    std::uint8_t diff = 0;
+    for (std::size_t i = 0; i < t_size; ++i)
+    {
+        diff |= a[i] ^ b[i];
+    }
+    return diff == 0;
+}
+
+} // namespace
+
+bool Ed25519Verifier::verify(std::span<const std::uint8_t, SignatureSize> t_signature,
+                             std::span<const std::uint8_t>                t_message,
+                             std::span<const std::uint8_t, PublicKeySize> t_public_key)
+{
+    const std::uint8_t* encodedR = t_signature.data();
+    const std::uint8_t* scalarS  = t_signature.data() + 32;
+
+    if (!scalarIsCanonical(scalarS))
+    {
+        return false;
+    }
+
+    Point negA;
+    if (!pointUnpackNegated(negA, t_public_key.data()))
+    {
+        return false;
+    }
+
+    // k = SHA-512(R || A || M) mod L
+    Sha512 sha;
+    sha.update(t_signature.first<32>());
+    sha.update(t_public_key);
+    sha.update(t_message);
+    const Sha512::Digest digest = sha.finish();
+
+    std::array<std::uint8_t, 32> k;
+    scalarReduce(k.data(), digest.data());
+
+    // R' = S*B - k*A
+    Point p;
+    Point q;
+    pointScalarMul(p, negA, k.data());
+    pointScalarBase(q, scalarS);
+    pointAdd(p, q);
+
+    std::array<std::uint8_t, 32> check;
+    pointPack(check.data(), p);
+
+    return bytesEqual(check.data(), encodedR, check.size());
+}
+
+} // namespace Integrity
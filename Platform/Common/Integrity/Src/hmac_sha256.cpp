@@ -0,0 +1,58 @@
+/**
+ * @file      Platform/Common/Integrity/Src/hmac_sha256.cpp
+ * @author    it32bit
+ * @brief     HMAC-SHA256 (RFC 2104).
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#include <algorithm>
+#include "hmac_sha256.hpp"
+
+namespace Integrity
+{
+
+HmacSha256::HmacSha256(std::span<const std::uint8_t> t_key)
+{
+    std::array<std::uint8_t, BlockSize> key{};
+
+    // Keys longer than a block are replaced by their digest, shorter ones are zero-padded
+    if (t_key.size() > BlockSize)
+    {
+        const Sha256::Digest digest = Sha256::compute(t_key);
+        std::copy(digest.begin(), digest.end(), key.begin());
+    }
+    else
+    {
+        std::copy(t_key.begin(), t_key.end(), key.begin());
+    }
+
+    std::array<std::uint8_t, BlockSize> innerPad;
+    for (std::size_t i = 0; i < BlockSize; ++i)
+    {
+        innerPad[i]   = key[i] ^ 0x36;
+        m_outerPad[i] = key[i] ^ 0x5C;
+    }
+    m_inner.update(innerPad);
+}
+
+void HmacSha256::update(std::span<const std::uint8_t> t_data)
+{
+    m_inner.update(t_data);
+}
+
+Sha256::Digest HmacSha256::finish()
+{
+    const Sha256::Digest innerDigest = m_inner.finish();
+
+    Sha256 outer;
+    outer.update(m_outerPad);
+    outer.update(innerDigest);
+
+    m_outerPad.fill(0);
+    return outer.finish();
+}
+
+} // namespace Integrity
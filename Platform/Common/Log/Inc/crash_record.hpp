@@ -0,0 +1,81 @@
+/**
+ * @file      Platform/Common/Log/Inc/crash_record.hpp
+ * @author    it32bit
+ * @brief     Post-mortem fault snapshot, captured in RAM by the fault handler and
+ *            committed to the error log after reset. Layout is decoded by
+ *            Tools/decode_error_log.py - keep both in sync.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef CRASH_RECORD_HPP
+#define CRASH_RECORD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace Log
+{
+
+constexpr std::uint32_t CRASH_MAGIC       = 0x43525348; // 'CRSH'
+constexpr std::size_t   CRASH_STACK_WORDS = 32;
+
+struct CrashRecord
+{
+    std::uint32_t magic;
+    std::uint32_t exception; // IPSR: 3 HardFault, 4 MemManage, 5 BusFault, 6 UsageFault
+
+    // Frame stacked by the core on exception entry
+    std::uint32_t r0, r1, r2, r3, r12, lr, pc, xpsr;
+
+    std::uint32_t excReturn; // EXC_RETURN in LR of the handler
+    std::uint32_t sp;        // Stack pointer before the exception
+    std::uint32_t cfsr, hfsr, mmfar, bfar;
+
+    std::uint32_t uptimeMs;
+    std::uint32_t signatureStatus; // Shared::BootProfile of the boot that crashed
+    std::uint32_t signatureCheckUs;
+
+    std::uint32_t stackWords; // Valid words in stack[]
+    std::uint32_t stack[CRASH_STACK_WORDS];
+
+    std::uint32_t check; // XOR of all previous words
+};
+
+inline std::uint32_t crashRecordCheck(const CrashRecord& t_record)
+{
+    const auto* words = reinterpret_cast<const std::uint32_t*>(&t_record);
+
+    std::uint32_t check = 0;
+    for (std::size_t i = 0; i < offsetof(CrashRecord, check) / sizeof(std::uint32_t); ++i)
+    {
+        check ^= words[i];
+    }
+    return check;
+}
+
+/** @brief Payload of a RecordType::Crash record: the snapshot exactly as it sits in RAM. */
+inline std::span<const std::uint8_t> crashRecordPayload(const CrashRecord& t_record)
+{
+    return std::span(reinterpret_cast<const std::uint8_t*>(&t_record), sizeof(t_record));
+}
+
+/** @brief Copy a RecordType::Crash payload back; false on a wrong size, magic or check word. */
+inline bool decodeCrashRecord(std::span<const std::uint8_t> t_payload, CrashRecord& t_record)
+{
+    if (t_payload.size() != sizeof(CrashRecord))
+    {
+        return false;
+    }
+    std::memcpy(&t_record, t_payload.data(), sizeof(t_record));
+
+    return (t_record.magic == CRASH_MAGIC) && (t_record.check == crashRecordCheck(t_record));
+}
+
+} // namespace Log
+
+#endif // CRASH_RECORD_HPP
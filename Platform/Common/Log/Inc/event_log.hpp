@@ -0,0 +1,150 @@
+/**
+ * @file      Platform/Common/Log/Inc/event_log.hpp
+ * @author    it32bit
+ * @brief     Timestamped event log, staged in RAM and committed to a FlashLog in batches.
+ *
+ * @details   record() only stores a 12 B entry into a RAM ring under a short TLock
+ *            guard, so it is safe from interrupts and costs well below a microsecond.
+ *            flushIfDue() runs from the main loop and programs all staged entries as a
+ *            single RecordType::Event record (words only, no erase except when the log
+ *            sector wraps). Entries leave the ring only after the record is committed.
+ *
+ *            Every entry carries a 16-bit sequence number: entries rejected because the
+ *            ring was full still consume one, so a reader sees lost events as gaps.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef EVENT_LOG_HPP
+#define EVENT_LOG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "flash_log.hpp"
+
+namespace Log
+{
+
+struct Event
+{
+    std::uint32_t timestampMs;
+    std::uint16_t id;
+    std::uint16_t sequence;
+    std::uint32_t data;
+};
+
+static_assert(sizeof(Event) == 12, "Event layout is decoded by Tools/decode_error_log.py");
+
+/**
+ * @tparam TCapacity Staged entries, power of two; one flush fits into a single record.
+ * @tparam TLock     RAII guard that masks the producers (e.g. a PriorityLock).
+ */
+template <std::size_t TCapacity, typename TLock>
+class EventLog
+{
+  public:
+    using Clock = std::uint32_t (*)();
+
+    static constexpr std::uint32_t FLUSH_INTERVAL_MS = 5000;
+    static constexpr std::size_t   FLUSH_THRESHOLD   = TCapacity / 2;
+
+    static_assert((TCapacity != 0) && ((TCapacity & (TCapacity - 1)) == 0),
+                  "Capacity must be a power of two");
+    static_assert(TCapacity * sizeof(Event) <= FlashLog::MAX_PAYLOAD_SIZE,
+                  "A full staging buffer must fit into one log record");
+
+    EventLog(FlashLog& t_log, Clock t_clock) : m_log(t_log), m_clock(t_clock) {}
+
+    /** @brief Stage one event. Returns false (and leaves a sequence gap) when full. */
+    bool record(std::uint16_t t_id, std::uint32_t t_data = 0)
+    {
+        TLock lock;
+
+        const std::uint16_t sequence = m_sequence++;
+        if (m_count == TCapacity)
+        {
+            ++m_dropped;
+            return false;
+        }
+
+        m_events[(m_first + m_count) & MASK] = Event{m_clock(), t_id, sequence, t_data};
+        ++m_count;
+        return true;
+    }
+
+    /** @brief Commit staged events when the buffer is half full or the oldest is stale. */
+    bool flushIfDue(std::uint32_t t_now)
+    {
+        std::size_t   count;
+        std::uint32_t oldest;
+        {
+            TLock lock;
+            count  = m_count;
+            oldest = m_events[m_first].timestampMs;
+        }
+
+        if ((count >= FLUSH_THRESHOLD) || ((count != 0) && (t_now - oldest >= FLUSH_INTERVAL_MS)))
+        {
+            return flush();
+        }
+        return true;
+    }
+
+    /** @brief Commit all staged events as one record. Blocks for the flash programming. */
+    bool flush()
+    {
+        std::array<Event, TCapacity> batch;
+        std::size_t                  count;
+        {
+            TLock lock;
+            count = m_count;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                batch[i] = m_events[(m_first + i) & MASK];
+            }
+        }
+
+        if (count == 0)
+        {
+            return true;
+        }
+
+        // Producers may keep appending behind the snapshot while flash is programmed
+        const bool committed =
+            m_log.append(static_cast<std::uint8_t>(RecordType::Event),
+                         std::span(reinterpret_cast<const std::uint8_t*>(batch.data()),
+                                   count * sizeof(Event)));
+
+        if (committed)
+        {
+            TLock lock;
+            m_first = (m_first + count) & MASK;
+            m_count -= count;
+        }
+        return committed;
+    }
+
+    std::size_t   pending() const { return m_count; }
+    std::uint32_t dropped() const { return m_dropped; }
+
+  private:
+    static constexpr std::size_t MASK = TCapacity - 1;
+
+    FlashLog& m_log;
+    Clock     m_clock;
+
+    // Only accessed under TLock, which is also a compiler barrier
+    std::array<Event, TCapacity> m_events{};
+    std::size_t                  m_first{0};
+    std::size_t                  m_count{0};
+    std::uint16_t                m_sequence{0}; // Restarts at 0 on every boot
+    std::uint32_t                m_dropped{0};
+};
+
+} // namespace Log
+
+#endif // EVENT_LOG_HPP
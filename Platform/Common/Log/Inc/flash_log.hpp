@@ -0,0 +1,138 @@
+/**
+ * @file      Platform/Common/Log/Inc/flash_log.hpp
+ * @author    it32bit
+ * @brief     Append-only paged record log on a single erasable flash sector.
+ *
+ * @details   The sector is split into fixed pages. Every page starts with a header
+ *            {PAGE_MAGIC, sequence}; records follow back to back and never span pages:
+ *
+  | Word            | Content                                                      |
+  |-----------------|--------------------------------------------------------------|
+  | header          | [31:24] RECORD_SYNC, [23:16] type, [15:0] payload length (B) |
+  | payload[0..n]   | Payload, padded with 0xFF to a whole word                    |
+ *
+ *            Payload words are programmed first and the header word last, so a reset
+ *            in the middle leaves an uncommitted record that mount() detects and skips
+ *            by closing the page. The head is found at mount() from the page with the
+ *            highest sequence plus a walk of that single page. When the last page is
+ *            full the sector is erased and the log wraps; the sequence keeps counting,
+ *            so a reader can tell how much history was dropped.
+ *
+ *            Only word programming and sector erase of IFlashWriter are used; the class
+ *            has no MCU dependency and runs on the host against a RAM-backed writer.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef FLASH_LOG_HPP
+#define FLASH_LOG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "pil_flash_writer.hpp"
+
+namespace Log
+{
+
+// Record types stored in the error log sector
+enum class RecordType : std::uint8_t
+{
+    Crash = 0x01, // CrashRecord, see crash_record.hpp
+    Event = 0x02, // Batch of Event entries, see event_log.hpp
+};
+
+class FlashLog
+{
+  public:
+    static constexpr std::uint32_t PAGE_MAGIC  = 0x4C4F4750; // 'LOGP'
+    static constexpr std::uint32_t RECORD_SYNC = 0xA5;
+    static constexpr std::size_t   PAGE_SIZE   = 1024;
+    static constexpr std::size_t   PAGE_HEADER_SIZE  = 2 * sizeof(std::uint32_t);
+    static constexpr std::size_t   MAX_PAYLOAD_SIZE  = PAGE_SIZE - PAGE_HEADER_SIZE - sizeof(std::uint32_t);
+
+    FlashLog(IFlashWriter* t_writer, std::uintptr_t t_start, std::size_t t_size,
+             std::uint8_t t_sector);
+
+    /** @brief Locate the head after reset. Must run once before append(). */
+    void mount();
+
+    /** @brief Program one record; may open a new page or erase the sector on wrap. */
+    bool append(std::uint8_t t_type, std::span<const std::uint8_t> t_payload);
+
+    /** @brief Visit committed records oldest first: t_visitor(type, payload). */
+    template <typename Visitor>
+    void forEach(Visitor&& t_visitor) const;
+
+    /** @brief Free payload bytes left in the open page before a page switch. */
+    std::size_t freeInPage() const;
+
+    std::uintptr_t start() const { return m_start; }
+    std::size_t    pageCount() const { return m_pageCount; }
+    bool           isPageValid(std::size_t t_page) const;
+    std::uint32_t  pageSequence(std::size_t t_page) const;
+
+  private:
+    static constexpr std::uint32_t ERASED_WORD = 0xFFFFFFFF;
+    static constexpr std::size_t   NO_PAGE     = static_cast<std::size_t>(-1);
+
+    static std::size_t alignedSize(std::size_t t_length) { return (t_length + 3U) & ~std::size_t{3}; }
+
+    std::uint32_t  word(std::uintptr_t t_address) const;
+    std::uintptr_t pageAddress(std::size_t t_page) const { return m_start + t_page * PAGE_SIZE; }
+    bool           isBlank(std::uintptr_t t_address, std::size_t t_size) const;
+    std::size_t    walkPage(std::size_t t_page) const;
+    bool           openNextPage();
+
+    IFlashWriter*  m_writer;
+    std::uintptr_t m_start;
+    std::size_t    m_pageCount;
+    std::uint8_t   m_sector;
+
+    std::size_t   m_headPage{NO_PAGE}; // Page currently appended to
+    std::size_t   m_headOffset{0};     // Next free byte inside m_headPage
+    std::uint32_t m_sequence{0};       // Sequence of m_headPage
+};
+
+template <typename Visitor>
+void FlashLog::forEach(Visitor&& t_visitor) const
+{
+    // Pages in sequence order: the oldest valid page follows the head page
+    for (std::size_t i = 1; i <= m_pageCount; ++i)
+    {
+        const std::size_t page = (m_headPage == NO_PAGE) ? (i - 1) : ((m_headPage + i) % m_pageCount);
+        if (isPageValid(page) == false)
+        {
+            continue;
+        }
+
+        std::size_t offset = PAGE_HEADER_SIZE;
+        while (offset + sizeof(std::uint32_t) <= PAGE_SIZE)
+        {
+            const std::uint32_t header = word(pageAddress(page) + offset);
+            if ((header >> 24) != RECORD_SYNC)
+            {
+                break;
+            }
+
+            const std::size_t length = header & 0xFFFF;
+            if (offset + sizeof(std::uint32_t) + length > PAGE_SIZE)
+            {
+                break;
+            }
+
+            t_visitor(static_cast<std::uint8_t>((header >> 16) & 0xFF),
+                      std::span<const std::uint8_t>(
+                          reinterpret_cast<const std::uint8_t*>(pageAddress(page) + offset +
+                                                                sizeof(std::uint32_t)),
+                          length));
+            offset += sizeof(std::uint32_t) + alignedSize(length);
+        }
+    }
+}
+
+} // namespace Log
+
+#endif // FLASH_LOG_HPP
@@ -0,0 +1,182 @@
+/**
+ * @file      Platform/Common/Log/Src/flash_log.cpp
+ * @author    it32bit
+ * @brief     Append-only paged record log on a single erasable flash sector.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#include <cstring>
+#include "flash_log.hpp"
+
+namespace Log
+{
+
+FlashLog::FlashLog(IFlashWriter* t_writer, std::uintptr_t t_start, std::size_t t_size,
+                   std::uint8_t t_sector)
+    : m_writer(t_writer), m_start(t_start), m_pageCount(t_size / PAGE_SIZE), m_sector(t_sector)
+{
+}
+
+std::uint32_t FlashLog::word(std::uintptr_t t_address) const
+{
+    return *reinterpret_cast<const volatile std::uint32_t*>(t_address);
+}
+
+bool FlashLog::isBlank(std::uintptr_t t_address, std::size_t t_size) const
+{
+    for (std::size_t i = 0; i < t_size; i += sizeof(std::uint32_t))
+    {
+        if (word(t_address + i) != ERASED_WORD)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FlashLog::isPageValid(std::size_t t_page) const
+{
+    return word(pageAddress(t_page)) == PAGE_MAGIC;
+}
+
+std::uint32_t FlashLog::pageSequence(std::size_t t_page) const
+{
+    return word(pageAddress(t_page) + sizeof(std::uint32_t));
+}
+
+std::size_t FlashLog::walkPage(std::size_t t_page) const
+{
+    std::size_t offset = PAGE_HEADER_SIZE;
+
+    while (offset + sizeof(std::uint32_t) <= PAGE_SIZE)
+    {
+        const std::uint32_t header = word(pageAddress(t_page) + offset);
+        if (header == ERASED_WORD)
+        {
+            // Free space must be fully erased, otherwise a record was torn: close the page
+            return isBlank(pageAddress(t_page) + offset, PAGE_SIZE - offset) ? offset : PAGE_SIZE;
+        }
+
+        const std::size_t length = header & 0xFFFF;
+        if (((header >> 24) != RECORD_SYNC) ||
+            (offset + sizeof(std::uint32_t) + length > PAGE_SIZE))
+        {
+            return PAGE_SIZE;
+        }
+        offset += sizeof(std::uint32_t) + alignedSize(length);
+    }
+
+    return PAGE_SIZE;
+}
+
+void FlashLog::mount()
+{
+    m_headPage   = NO_PAGE;
+    m_headOffset = PAGE_SIZE;
+    m_sequence   = 0;
+
+    for (std::size_t page = 0; page < m_pageCount; ++page)
+    {
+        if (isPageValid(page) == false)
+        {
+            continue;
+        }
+
+        const std::uint32_t sequence = pageSequence(page);
+        if ((m_headPage == NO_PAGE) || (static_cast<std::int32_t>(sequence - m_sequence) > 0))
+        {
+            m_headPage = page;
+            m_sequence = sequence;
+        }
+    }
+
+    if (m_headPage != NO_PAGE)
+    {
+        m_headOffset = walkPage(m_headPage);
+    }
+}
+
+std::size_t FlashLog::freeInPage() const
+{
+    if ((m_headPage == NO_PAGE) || (m_headOffset + sizeof(std::uint32_t) > PAGE_SIZE))
+    {
+        return 0;
+    }
+    return PAGE_SIZE - m_headOffset - sizeof(std::uint32_t);
+}
+
+bool FlashLog::openNextPage()
+{
+    std::size_t next = (m_headPage == NO_PAGE) ? 0 : (m_headPage + 1);
+
+    if ((next >= m_pageCount) || (isBlank(pageAddress(next), PAGE_SIZE) == false))
+    {
+        // Wrap: the whole sector is the erase unit, older history is dropped
+        m_writer->eraseSector(m_sector);
+        next = 0;
+    }
+
+    const std::uint32_t sequence = (m_headPage == NO_PAGE) ? (m_sequence) : (m_sequence + 1);
+
+    m_writer->writeWord(pageAddress(next) + sizeof(std::uint32_t), sequence);
+    m_writer->writeWord(pageAddress(next), PAGE_MAGIC);
+
+    if ((isPageValid(next) == false) || (pageSequence(next) != sequence))
+    {
+        return false;
+    }
+
+    m_headPage   = next;
+    m_headOffset = PAGE_HEADER_SIZE;
+    m_sequence   = sequence;
+    return true;
+}
+
+bool FlashLog::append(std::uint8_t t_type, std::span<const std::uint8_t> t_payload)
+{
+    if ((t_payload.size() > MAX_PAYLOAD_SIZE) || (m_pageCount == 0))
+    {
+        return false;
+    }
+
+    const std::size_t recordSize = sizeof(std::uint32_t) + alignedSize(t_payload.size());
+
+    if ((m_headPage == NO_PAGE) || (m_headOffset + recordSize > PAGE_SIZE))
+    {
+        if (openNextPage() == false)
+        {
+            return false;
+        }
+    }
+
+    const std::uintptr_t record = pageAddress(m_headPage) + m_headOffset;
+
+    // Payload first ...
+    for (std::size_t i = 0; i < t_payload.size(); i += sizeof(std::uint32_t))
+    {
+        std::uint32_t value = ERASED_WORD;
+        std::memcpy(&value, t_payload.data() + i,
+                    (t_payload.size() - i < sizeof(value)) ? (t_payload.size() - i) : sizeof(value));
+        m_writer->writeWord(record + sizeof(std::uint32_t) + i, value);
+    }
+
+    // ... header last: it is the commit point of the record
+    const std::uint32_t header = (RECORD_SYNC << 24) | (static_cast<std::uint32_t>(t_type) << 16) |
+                                 static_cast<std::uint32_t>(t_payload.size());
+    m_writer->writeWord(record, header);
+
+    if (word(record) != header)
+    {
+        // The walk stops at a bad header and would hide every later record of this page
+        m_headOffset = PAGE_SIZE;
+        return false;
+    }
+
+    m_headOffset += recordSize;
+    return true;
+}
+
+} // namespace Log
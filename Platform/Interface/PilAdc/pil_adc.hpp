@@ -1,23 +1,44 @@
 /**
  * @file      Platform/Interface/PilAdc/pil_adc.hpp
  * @author    it32bit
- * @brief     Declares the IAdc interface for platform-independent ADC access.
- *            Enables portable temperature sensing and analog input abstraction across MCU targets.
+ * @brief     Platform-independent ADC binding: the AdcDriver concept and PlatformAdc.
+ *            Enables portable temperature sensing with the driver call resolved at compile time.
+ *
+ * @details   PlatformAdc<TTraits> owns the TTraits::Adc driver by value; readTemperature()
+ *            returns 0 until initialize() has run.
  *
  * @version   1.0
- * @date      2025-10-19
+ * @date      2026-10-18
  * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
  *            (c) 2025 ha-ctrl project authors.
  */
 #ifndef PIL_ADC_HPP
 #define PIL_ADC_HPP
 
-class IAdc
+#include <concepts>
+
+template <class T>
+concept AdcDriver = requires(T t_driver) {
+    { t_driver.init() } -> std::same_as<void>;
+    { t_driver.readTemperature() } -> std::same_as<float>;
+};
+
+template <class TTraits>
+    requires AdcDriver<typename TTraits::Adc>
+class PlatformAdc
 {
   public:
-    virtual void  init()            = 0;
-    virtual float readTemperature() = 0;
-    virtual ~IAdc()                 = default;
+    void initialize()
+    {
+        m_driver.init();
+        m_ready = true;
+    }
+
+    float readTemperature() { return m_ready ? m_driver.readTemperature() : 0.0f; }
+
+  private:
+    typename TTraits::Adc m_driver{};
+    bool                  m_ready{false};
 };
 
 #endif
@@ -1,22 +1,37 @@
 /**
  * @file Platform/Interface/PilClock/pil_clock_config.hpp
  * @author it32bit
- * @brief Declares the IClockConfigurator interface for platform-specific system clock configuration.
- *        Enables flexible and testable clock setup with optional callback integration.
+ * @brief Platform-independent system clock binding: the ClockDriver concept and PlatformClock.
+ *        The configuration for the image is picked by its traits, with an optional error callback.
  *
  * @version 1.0
- * @date 2025-10-19
+ * @date 2026-10-18
  * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
  *            (c) 2025 ha-ctrl project authors.
  */
 #ifndef PIL_CLOCK_CONFIGURATOR_HPP
 #define PIL_CLOCK_CONFIGURATOR_HPP
 
-class IClockConfigurator
+#include <concepts>
+
+template <class T>
+concept ClockDriver = requires(T t_driver, void (*t_handler)()) {
+    { t_driver.configure(t_handler) } -> std::same_as<void>;
+};
+
+template <class TTraits>
+    requires ClockDriver<typename TTraits::Clock>
+class PlatformClock
 {
   public:
-    virtual ~IClockConfigurator()                       = default;
-    virtual void configure(void (*handler)() = nullptr) = 0;
+    /**
+     * @brief Configure the system clock.
+     * @param t_handler Called on a clock setup failure, may be nullptr.
+     */
+    void initialize(void (*t_handler)()) { m_driver.configure(t_handler); }
+
+  private:
+    typename TTraits::Clock m_driver{};
 };
 
 #endif // PIL_CLOCK_CONFIGURATOR_HPP
@@ -0,0 +1,143 @@
+/**
+ ******************************************************************************
+ * @file        pil_dma.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       Abstract DMA channel and typed transfer descriptors.
+ *
+ *              A DmaTransfer is built by one of the named constructors below, which
+ *              take typed pointers, so the item width always matches the buffers.
+ *              Completion, half-completion (when asked for) and errors are reported
+ *              through one callback in interrupt context. Circular and double-buffer
+ *              transfers keep running until stop(); the others end after one pass.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef PIL_DMA_HPP
+#define PIL_DMA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+enum class DmaDirection : std::uint8_t
+{
+    PeripheralToMemory,
+    MemoryToPeripheral,
+    MemoryToMemory
+};
+
+enum class DmaWidth : std::uint8_t
+{
+    Bits8 = 0,
+    Bits16,
+    Bits32
+};
+
+enum class DmaEvent : std::uint8_t
+{
+    HalfComplete,
+    Complete, // In double-buffer mode: one buffer is full, see IDmaChannel::activeBuffer()
+    Error
+};
+
+using DmaCallback = void (*)(void* t_context, DmaEvent t_event);
+
+template <typename T>
+constexpr DmaWidth dmaWidthOf()
+{
+    static_assert((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4),
+                  "DMA items are 8, 16 or 32 bits wide");
+    return (sizeof(T) == 1) ? DmaWidth::Bits8
+                            : ((sizeof(T) == 2) ? DmaWidth::Bits16 : DmaWidth::Bits32);
+}
+
+struct DmaTransfer
+{
+    DmaDirection   direction{DmaDirection::PeripheralToMemory};
+    DmaWidth       width{DmaWidth::Bits8};
+    volatile void* peripheral{nullptr}; // Data register; the source for memory to memory
+    void*          memory{nullptr};
+    void*          memory1{nullptr}; // Second buffer, double-buffer mode only
+    std::uint16_t  count{0};         // Items, not bytes
+    bool           circular{false};
+    bool           halfComplete{false};
+    DmaCallback    callback{nullptr};
+    void*          context{nullptr};
+
+    template <typename T>
+    static constexpr DmaTransfer toPeripheral(volatile void* t_register, const T* t_source,
+                                              std::uint16_t t_count, DmaCallback t_callback,
+                                              void* t_context)
+    {
+        return {DmaDirection::MemoryToPeripheral, dmaWidthOf<T>(), t_register,
+                const_cast<T*>(t_source), nullptr, t_count, false, false, t_callback, t_context};
+    }
+
+    template <typename T>
+    static constexpr DmaTransfer fromPeripheral(volatile void* t_register, T* t_destination,
+                                                std::uint16_t t_count, DmaCallback t_callback,
+                                                void* t_context)
+    {
+        return {DmaDirection::PeripheralToMemory, dmaWidthOf<T>(), t_register, t_destination,
+                nullptr, t_count, false, false, t_callback, t_context};
+    }
+
+    template <typename T>
+    static constexpr DmaTransfer memoryToMemory(const T* t_source, T* t_destination,
+                                                std::uint16_t t_count, DmaCallback t_callback,
+                                                void* t_context)
+    {
+        return {DmaDirection::MemoryToMemory, dmaWidthOf<T>(), const_cast<T*>(t_source),
+                t_destination, nullptr, t_count, false, false, t_callback, t_context};
+    }
+
+    /** @brief Peripheral to memory, alternating between two buffers of t_count items. */
+    template <typename T>
+    static constexpr DmaTransfer doubleBuffer(volatile void* t_register, T* t_buffer0,
+                                              T* t_buffer1, std::uint16_t t_count,
+                                              DmaCallback t_callback, void* t_context)
+    {
+        return {DmaDirection::PeripheralToMemory, dmaWidthOf<T>(), t_register, t_buffer0,
+                t_buffer1, t_count, true, false, t_callback, t_context};
+    }
+
+    /** @brief Restart from the beginning of the buffer after every pass. */
+    constexpr DmaTransfer repeating() const
+    {
+        DmaTransfer transfer = *this;
+        transfer.circular    = true;
+        return transfer;
+    }
+
+    /** @brief Also report DmaEvent::HalfComplete, e.g. to consume a circular buffer. */
+    constexpr DmaTransfer withHalfComplete() const
+    {
+        DmaTransfer transfer  = *this;
+        transfer.halfComplete = true;
+        return transfer;
+    }
+
+    std::size_t bytes() const { return std::size_t{count} << static_cast<unsigned>(width); }
+};
+
+class IDmaChannel
+{
+  public:
+    virtual ~IDmaChannel() = default;
+
+    /** @brief false if busy or the transfer is not possible on this channel. */
+    virtual bool start(const DmaTransfer& t_transfer) = 0;
+    virtual void stop()                                = 0;
+    virtual bool isBusy() const                        = 0;
+
+    /** @brief Items still to move in the current pass. */
+    virtual std::uint16_t remaining() const = 0;
+
+    /** @brief Double-buffer mode: buffer the DMA is filling now (0 or 1). */
+    virtual std::uint8_t activeBuffer() const = 0;
+};
+
+#endif // PIL_DMA_HPP
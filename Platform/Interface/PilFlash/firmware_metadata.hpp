@@ -27,6 +27,68 @@ struct Metadata
 
 } __attribute__((packed));
 
+constexpr uint32_t CERTIFICATE_MAGIC     = 0x43455254; // 'CERT'
+constexpr uint32_t PUBLIC_KEY_MAGIC      = 0x504B4559; // 'PKEY'
+constexpr uint32_t SIGNATURE_ALG_ED25519 = 1;
+
+// Place this at APP_CERT_START or NEW_APP_CERT_START
+// Signature covers the whole Metadata block, which in turn carries the SHA-256 of the firmware
+struct Certificate
+{
+    std::uint32_t magic;
+    std::uint32_t algorithm;     // SIGNATURE_ALG_ED25519
+    std::uint32_t keyId;         // Must match PublicKeyStore::keyId
+    std::uint32_t reserved;
+    std::uint8_t  signature[64]; // Ed25519 signature (R || S)
+
+} __attribute__((packed));
+
+// Device trust anchor, provisioned at CERT_PRIVATE_START (never written by the bootloaders)
+struct PublicKeyStore
+{
+    std::uint32_t magic;
+    std::uint32_t algorithm;
+    std::uint32_t keyId;
+    std::uint32_t reserved;
+    std::uint8_t  publicKey[32];
+
+} __attribute__((packed));
+
+constexpr uint32_t DEVICE_SECRET_MAGIC = 0x44534543; // 'DSEC'
+
+// Per-device HMAC key, provisioned at CERT_DEVICE_SECRET_START (never written by the bootloaders)
+struct DeviceSecret
+{
+    std::uint32_t magic;
+    std::uint32_t reserved[3];
+    std::uint8_t  key[32]; // Random, unique to the device
+
+} __attribute__((packed));
+
+constexpr uint32_t UPDATE_MANIFEST_MAGIC   = 0x5550444D; // 'UPDM'
+constexpr uint32_t UPDATE_MANIFEST_VERSION = 1;
+
+// Component bits of UpdateManifest::componentMask
+constexpr uint32_t COMPONENT_BOOTSEC = 1U << 0;
+constexpr uint32_t COMPONENT_APP     = 1U << 1;
+
+// Every component is sent as <firmware bytes><trailer>, trailer = metadata (512) + cert (512)
+constexpr uint32_t COMPONENT_TRAILER_SIZE = 1024;
+
+// Header of the UART update package, followed by the BootSec and then the App component
+// (only those present in componentMask). Generated by cmake/make_update_package.py
+struct UpdateManifest
+{
+    std::uint32_t magic;
+    std::uint32_t formatVersion;
+    std::uint32_t componentMask;
+    std::uint32_t bootSecSize; // Firmware bytes of BootSec component (without trailer)
+    std::uint32_t appSize;     // Firmware bytes of App component (without trailer)
+    std::uint32_t reserved[2];
+    std::uint32_t check;       // XOR of all previous words
+
+} __attribute__((packed));
+
 } // namespace Firmware
 
 #endif // FIRMWARE_METADATA_HPP
\ No newline at end of file
@@ -0,0 +1,265 @@
+/**
+ ******************************************************************************
+ * @file        pil_os.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       Thin preemptive OS layer: tasks, counting semaphores, queues, timers.
+ *
+ *              The classes are declared here and implemented by one port, whose
+ *              os_port.hpp supplies the control blocks and Os::Lock:
+ *              Platform/OsPort/STM32F4 (Cortex-M4F, PendSV context switch,
+ *              SysTick kernel tick) on the target, Platform/OsPort/Posix
+ *              (std::thread) on the host.
+ *              Everything is statically allocated by the caller: task stacks are
+ *              spans of StackWord, objects live in globals or members.
+ *
+ *              Priorities run from 1 (lowest application priority) to
+ *              PRIORITIES - 1; 0 belongs to the idle task. A ready task always
+ *              preempts lower ones; tasks of equal priority share the CPU per
+ *              tick. Semaphore::give(), tryTake() and Queue::trySend() are safe
+ *              in interrupts; calls that block are for tasks only.
+ *
+ *              Stats are in the port's cycle counter (KernelStats::cyclesPerUs):
+ *              context-switch time and the latency from a give() that readies a
+ *              task to that task running again.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef PIL_OS_HPP
+#define PIL_OS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Os
+{
+
+using TaskEntry     = void (*)(void* t_argument);
+using TimerCallback = void (*)(void* t_context);
+using StackWord     = std::uint64_t; // Keeps task stacks 8-byte aligned (AAPCS)
+
+inline constexpr std::uint32_t WAIT_FOREVER = UINT32_MAX;
+inline constexpr std::uint8_t  PRIORITIES   = 8;
+
+enum class TaskState : std::uint8_t
+{
+    Created,  // Not started yet
+    Ready,    // Running or runnable
+    Blocked,  // On a semaphore, maybe with a timeout
+    Sleeping, // In sleepMs()
+    Finished  // Its entry returned
+};
+
+struct TaskStats
+{
+    std::uint32_t switchesIn{0}; // Times the scheduler resumed it
+    std::uint32_t stackUsed{0};  // High-water mark in bytes; 0 if the port cannot tell
+    std::uint32_t stackSize{0};
+};
+
+struct KernelStats
+{
+    std::uint32_t switches{0};
+    std::uint32_t switchMax{0}; // Cycles from PendSV entry to the next task picked
+    std::uint64_t switchTotal{0};
+    std::uint32_t wakeups{0}; // Tasks readied by a give()
+    std::uint32_t wakeMax{0}; // Cycles from that give() to the task running
+    std::uint64_t wakeTotal{0};
+    std::uint32_t cyclesPerUs{1};
+};
+
+} // namespace Os
+
+#include "os_port.hpp"
+
+namespace Os
+{
+
+class Task
+{
+  public:
+    /** @param t_priority 1 .. PRIORITIES - 1, higher preempts lower. */
+    Task(const char* t_name, TaskEntry t_entry, void* t_argument, std::uint8_t t_priority,
+         std::span<StackWord> t_stack);
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    /** @brief Make the task runnable (from run() on if called before it); false if it
+     *         was started already or the port refused it. */
+    bool start();
+
+    const char*  name() const;
+    std::uint8_t priority() const;
+    TaskState    state() const;
+    TaskStats    stats() const;
+
+  private:
+    friend struct Port::Access;
+
+    Port::TaskControl m_control;
+};
+
+class Semaphore
+{
+  public:
+    explicit Semaphore(std::uint32_t t_initial = 0, std::uint32_t t_max = UINT32_MAX);
+
+    Semaphore(const Semaphore&)            = delete;
+    Semaphore& operator=(const Semaphore&) = delete;
+
+    /** @brief Wait up to t_timeoutMs for a count; false on timeout. Tasks only. */
+    bool take(std::uint32_t t_timeoutMs = WAIT_FOREVER);
+
+    /** @brief Take a count if there is one. Any context. */
+    bool tryTake();
+
+    /** @brief Hand a count to the highest-priority waiter, or keep it. Any context. */
+    void give();
+
+    std::uint32_t count() const;
+
+  private:
+    friend struct Port::Access;
+
+    Port::SemaphoreControl m_control;
+};
+
+/**
+ * @brief Software timer; the callback runs in the port's timer context (the kernel
+ *        tick interrupt on the target), so it must be short: give a semaphore or send
+ *        to a queue to hand work to a task.
+ */
+class Timer
+{
+  public:
+    Timer(TimerCallback t_callback, void* t_context);
+    ~Timer();
+
+    Timer(const Timer&)            = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    /** @brief (Re)start: first call after t_delayMs, then every t_periodMs if not 0. */
+    void start(std::uint32_t t_delayMs, std::uint32_t t_periodMs = 0);
+    void stop();
+    bool isActive() const;
+
+  private:
+    friend struct Port::Access;
+
+    Port::TimerControl m_control;
+};
+
+/**
+ * @brief Fixed-size FIFO of T between any tasks and interrupts.
+ */
+template <class T, std::size_t TSize>
+class Queue
+{
+    static_assert(TSize > 0, "A queue holds at least one item");
+
+  public:
+    Queue() = default;
+
+    Queue(const Queue&)            = delete;
+    Queue& operator=(const Queue&) = delete;
+
+    /** @brief Wait up to t_timeoutMs for space. Tasks only. */
+    bool send(const T& t_item, std::uint32_t t_timeoutMs = WAIT_FOREVER)
+    {
+        if (!m_slots.take(t_timeoutMs))
+        {
+            return false;
+        }
+        put(t_item);
+        return true;
+    }
+
+    /** @brief Send if there is space. Any context. */
+    bool trySend(const T& t_item)
+    {
+        if (!m_slots.tryTake())
+        {
+            return false;
+        }
+        put(t_item);
+        return true;
+    }
+
+    /** @brief Wait up to t_timeoutMs for an item. Tasks only. */
+    bool receive(T& t_item, std::uint32_t t_timeoutMs = WAIT_FOREVER)
+    {
+        if (!m_items.take(t_timeoutMs))
+        {
+            return false;
+        }
+        get(t_item);
+        return true;
+    }
+
+    /** @brief Receive if an item is queued. Any context. */
+    bool tryReceive(T& t_item)
+    {
+        if (!m_items.tryTake())
+        {
+            return false;
+        }
+        get(t_item);
+        return true;
+    }
+
+    std::size_t size() const { return m_items.count(); }
+
+  private:
+    void put(const T& t_item)
+    {
+        {
+            Lock lock;
+            m_buffer[m_tail] = t_item;
+            m_tail           = (m_tail + 1) % TSize;
+        }
+        m_items.give();
+    }
+
+    void get(T& t_item)
+    {
+        {
+            Lock lock;
+            t_item = m_buffer[m_head];
+            m_head = (m_head + 1) % TSize;
+        }
+        m_slots.give();
+    }
+
+    T           m_buffer[TSize]{};
+    std::size_t m_head{0};
+    std::size_t m_tail{0};
+    Semaphore   m_items{0, TSize};
+    Semaphore   m_slots{TSize, TSize};
+};
+
+/** @brief Start scheduling the started tasks; does not return on the target. */
+void run();
+
+/** @brief Block the calling task for t_ms 1 ms ticks (the first one partial); 0 yields. */
+void sleepMs(std::uint32_t t_ms);
+
+/** @brief Let other ready tasks of the same priority run. */
+void yield();
+
+/** @brief Milliseconds since run(). */
+std::uint32_t nowMs();
+
+/** @brief Visit every started task, e.g. for a console listing. */
+void forEachTask(void (*t_visit)(const Task& t_task, void* t_context), void* t_context);
+
+KernelStats kernelStats();
+void        resetKernelStats();
+
+} // namespace Os
+
+#endif // PIL_OS_HPP
@@ -0,0 +1,106 @@
+/**
+ ******************************************************************************
+ * @file        pil_timebase.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       Abstract monotonic timebase for platform-independent timing.
+ *
+ *              ITimebase gives 64-bit microseconds and core cycles since start-up,
+ *              so callers never handle counter wrap-around. Deadline wraps the usual
+ *              "start + timeout, poll until expired" pattern for debouncing, protocol
+ *              timeouts and periodic work. The STM32 implementation runs on TIM2 and
+ *              the DWT cycle counter; tests use a std::chrono::steady_clock one.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef PIL_TIMEBASE_HPP
+#define PIL_TIMEBASE_HPP
+
+#include <cstdint>
+
+class ITimebase
+{
+  public:
+    virtual std::uint64_t nowUs() const       = 0;
+    virtual std::uint64_t nowCycles() const   = 0;
+    virtual std::uint32_t cyclesPerUs() const = 0;
+    virtual ~ITimebase()                      = default;
+};
+
+namespace TimebaseMath
+{
+
+/**
+ * @brief 64-bit value of a 32-bit hardware counter. t_high counts the overflows seen by
+ *        the overflow interrupt; t_wrapPending is its flag still set while the interrupt
+ *        has not run yet (masked, or the reader has a higher priority). A small t_low
+ *        with the flag set means the wrap happened before the read.
+ */
+constexpr std::uint64_t extend(std::uint32_t t_high, std::uint32_t t_low, bool t_wrapPending)
+{
+    const std::uint32_t high = (t_wrapPending && (t_low < 0x80000000U)) ? (t_high + 1) : t_high;
+    return (static_cast<std::uint64_t>(high) << 32) | t_low;
+}
+
+/**
+ * @brief 64-bit cycle count from the 64-bit microsecond count and the free-running 32-bit
+ *        cycle counter, both started together from the same clock: the microseconds give
+ *        the high part, the cycle counter the exact low 32 bits.
+ */
+constexpr std::uint64_t cyclesFromUs(std::uint64_t t_us, std::uint32_t t_cyclesPerUs,
+                                     std::uint32_t t_cycles)
+{
+    const std::uint64_t estimate = t_us * t_cyclesPerUs;
+    const auto correction =
+        static_cast<std::int32_t>(t_cycles - static_cast<std::uint32_t>(estimate));
+    return estimate + static_cast<std::uint64_t>(static_cast<std::int64_t>(correction));
+}
+
+} // namespace TimebaseMath
+
+/**
+ * @brief Point in time on an ITimebase, e.g.
+ *        Deadline timeout(timebase, 2000000); while (!timeout.expired()) { ... }
+ */
+class Deadline
+{
+  public:
+    /** @brief Already expired; does not read the clock, so it can be a static object. */
+    explicit Deadline(const ITimebase& t_timebase) : m_timebase(&t_timebase), m_expiresUs(0) {}
+
+    Deadline(const ITimebase& t_timebase, std::uint64_t t_timeoutUs)
+        : m_timebase(&t_timebase), m_expiresUs(t_timebase.nowUs() + t_timeoutUs)
+    {
+    }
+
+    bool expired() const { return m_timebase->nowUs() >= m_expiresUs; }
+
+    std::uint64_t remainingUs() const
+    {
+        const std::uint64_t now = m_timebase->nowUs();
+        return (now >= m_expiresUs) ? 0 : (m_expiresUs - now);
+    }
+
+    /** @brief Restart from now, e.g. after every received byte. */
+    void restart(std::uint64_t t_timeoutUs) { m_expiresUs = m_timebase->nowUs() + t_timeoutUs; }
+
+    /** @brief Move on by one period without drift; skips periods already missed. */
+    void advance(std::uint64_t t_periodUs)
+    {
+        const std::uint64_t now = m_timebase->nowUs();
+        m_expiresUs += t_periodUs;
+        if (m_expiresUs <= now)
+        {
+            m_expiresUs = now + t_periodUs;
+        }
+    }
+
+  private:
+    const ITimebase* m_timebase;
+    std::uint64_t    m_expiresUs;
+};
+
+#endif // PIL_TIMEBASE_HPP
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file        pil_timer.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       Abstract hardware timer: periodic, one-shot, PWM and input capture.
+ *
+ *              A timer runs from a TimerPeriod: prescaler and reload computed by
+ *              TimerMath, normally in a constexpr from the clock profile of the
+ *              image, so a period the timer cannot produce fails to compile
+ *              instead of running at the wrong rate. Callbacks run in interrupt
+ *              context and must be short.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef PIL_TIMER_HPP
+#define PIL_TIMER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+using TimerCallback = void (*)(void* t_context);
+
+enum class TimerChannel : std::uint8_t
+{
+    Ch1 = 0,
+    Ch2,
+    Ch3,
+    Ch4
+};
+
+enum class CaptureEdge : std::uint8_t
+{
+    Rising,
+    Falling,
+    Both
+};
+
+/**
+ * @brief Counter setup: ticks at clock / (prescaler + 1), update every reload + 1 ticks.
+ */
+struct TimerPeriod
+{
+    std::uint32_t prescaler{0};
+    std::uint32_t reload{0};
+    bool          valid{false};
+};
+
+namespace TimerMath
+{
+
+constexpr std::uint32_t MAX_PRESCALER = 0xFFFF;
+
+/**
+ * @brief Finest tick that still fits the period in t_maxReload + 1 ticks. Invalid when
+ *        the period is shorter than one clock or longer than the timer can count.
+ */
+constexpr TimerPeriod fromTicks(std::uint64_t t_clockTicks, std::uint32_t t_maxReload)
+{
+    if (t_clockTicks == 0)
+    {
+        return {};
+    }
+
+    const std::uint64_t range     = std::uint64_t{t_maxReload} + 1;
+    const std::uint64_t prescaler = (t_clockTicks - 1) / range;
+    if (prescaler > MAX_PRESCALER)
+    {
+        return {};
+    }
+
+    // Round to the nearest tick of the prescaled clock
+    const std::uint64_t ticks = (t_clockTicks + (prescaler + 1) / 2) / (prescaler + 1);
+    return {static_cast<std::uint32_t>(prescaler), static_cast<std::uint32_t>(ticks - 1), true};
+}
+
+constexpr TimerPeriod fromMicroseconds(std::uint32_t t_clockHz, std::uint32_t t_periodUs,
+                                       std::uint32_t t_maxReload)
+{
+    return fromTicks(std::uint64_t{t_clockHz} * t_periodUs / 1000000U, t_maxReload);
+}
+
+constexpr TimerPeriod fromFrequency(std::uint32_t t_clockHz, std::uint32_t t_frequencyHz,
+                                    std::uint32_t t_maxReload)
+{
+    return (t_frequencyHz == 0) ? TimerPeriod{}
+                                : fromTicks(t_clockHz / t_frequencyHz, t_maxReload);
+}
+
+/** @brief Period actually produced, in nanoseconds (for checks against a tolerance). */
+constexpr std::uint64_t periodNs(std::uint32_t t_clockHz, const TimerPeriod& t_period)
+{
+    return (std::uint64_t{t_period.prescaler} + 1) * (std::uint64_t{t_period.reload} + 1) *
+           1000000000ULL / t_clockHz;
+}
+
+} // namespace TimerMath
+
+class ITimer
+{
+  public:
+    virtual ~ITimer() = default;
+
+    /** @brief t_callback(t_context) at every period until stop(). */
+    virtual bool startPeriodic(const TimerPeriod& t_period, TimerCallback t_callback,
+                               void* t_context) = 0;
+
+    /** @brief t_callback(t_context) once, one period from now. */
+    virtual bool startOneShot(const TimerPeriod& t_delay, TimerCallback t_callback,
+                              void* t_context) = 0;
+
+    /**
+     * @brief Run the counter for PWM; channels are switched on by setDuty(). The pins
+     *        must be in their timer alternate function.
+     */
+    virtual bool startPwm(const TimerPeriod& t_period) = 0;
+
+    /** @brief High for t_compare ticks of every period (0 .. reload + 1). */
+    virtual bool setDuty(TimerChannel t_channel, std::uint32_t t_compare) = 0;
+
+    /**
+     * @brief Capture the counter on t_edge into t_buffer by DMA, without an interrupt per
+     *        edge; t_callback(t_context) once t_count values are stored. The counter runs
+     *        free at the tick of t_tick (its reload is ignored, the full range is used).
+     *        On a transfer error the capture stops without a callback.
+     */
+    virtual bool startCapture(const TimerPeriod& t_tick, TimerChannel t_channel,
+                              CaptureEdge t_edge, std::uint32_t* t_buffer, std::size_t t_count,
+                              TimerCallback t_callback, void* t_context) = 0;
+
+    virtual void stop()            = 0;
+    virtual bool isRunning() const = 0;
+};
+
+#endif // PIL_TIMER_HPP
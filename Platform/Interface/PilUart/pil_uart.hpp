@@ -4,14 +4,20 @@
  * @brief     Declares the IConsoleUart interface for platform-independent UART communication.
  *            Enables portable console output and input handling across MCU targets.
  *
+ * @details   PlatformUart<TTraits> owns the TTraits::Uart driver by value and writes through
+ *            it directly, so a final driver's write() inlines at the call site. The driver
+ *            still implements IConsoleUart for consumers that take any console, such as
+ *            UartReceiver; getUart() hands that view out once initialize() has run.
+ *
  * @version   1.0
- * @date      2025-10-19
+ * @date      2026-10-18
  * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
  *            (c) 2025 ha-ctrl project authors.
  */
 #ifndef PIL_UART_HPP
 #define PIL_UART_HPP
 
+#include <concepts>
 #include "uart_id_stm32.hpp"
 
 class IConsoleUart
@@ -23,4 +29,43 @@ class IConsoleUart
     virtual ~IConsoleUart()                         = default;
 };
 
+template <class T>
+concept UartDriver = std::derived_from<T, IConsoleUart> && requires(T t_driver, const char* t_str) {
+    { t_driver.write(t_str) } -> std::same_as<void>;
+};
+
+template <class TTraits>
+    requires UartDriver<typename TTraits::Uart>
+class PlatformUart
+{
+  public:
+    void initialize(UartId t_id, uint32_t t_baudrate)
+    {
+        m_driver.init(t_id, t_baudrate);
+        m_ready = true;
+    }
+
+    void write(char t_c)
+    {
+        if (m_ready)
+        {
+            m_driver.write(t_c);
+        }
+    }
+
+    void write(const char* t_str)
+    {
+        if (m_ready)
+        {
+            m_driver.write(t_str);
+        }
+    }
+
+    IConsoleUart* getUart() { return m_ready ? &m_driver : nullptr; }
+
+  private:
+    typename TTraits::Uart m_driver{};
+    bool                   m_ready{false};
+};
+
 #endif
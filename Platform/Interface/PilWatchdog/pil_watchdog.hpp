@@ -3,13 +3,14 @@
  * @file        pil_watchdog.hpp
  * @author      it32bit
  * @version     1.0
- * @date        2025-10-17
- * @brief       Abstract watchdog interface for platform-independent implementation.
+ * @date        2026-10-18
+ * @brief       Platform-independent watchdog binding, resolved at compile time.
  *
- *              Defines the IWatchdog interface, which provides a virtual method
- *              for feeding a watchdog timer. Enables mocking for unit tests and
- *              allows platform-specific watchdog implementations to be swapped
- *              seamlessly in embedded systems.
+ *              WatchdogDriver is what a platform's watchdog must provide: start()
+ *              with a timeout and feed(). PlatformWatchdog<TTraits> owns the
+ *              TTraits::Watchdog driver by value and calls it directly, so on the
+ *              target feed() inlines to the reload-key store. Host tests pass
+ *              traits naming a fake driver instead.
  *
  * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
  *              (c) 2025 ha-ctrl project authors.
@@ -18,11 +19,32 @@
 #ifndef PIL_WATCHDOG_HPP
 #define PIL_WATCHDOG_HPP
 
-class IWatchdog
+#include <concepts>
+#include <cstdint>
+
+template <class T>
+concept WatchdogDriver = requires(T t_driver, std::uint32_t t_timeoutMs) {
+    { t_driver.start(t_timeoutMs) } -> std::same_as<void>;
+    { t_driver.feed() } -> std::same_as<void>;
+};
+
+template <class TTraits>
+    requires WatchdogDriver<typename TTraits::Watchdog>
+class PlatformWatchdog
 {
   public:
-    virtual void feed()  = 0;
-    virtual ~IWatchdog() = default;
+    /** @brief Start the watchdog with t_timeoutMs and feed it once. */
+    void initialize(std::uint32_t t_timeoutMs)
+    {
+        m_driver.start(t_timeoutMs);
+        m_driver.feed();
+    }
+
+    /** @brief Reload the counter; harmless before initialize(). */
+    void feed() { m_driver.feed(); }
+
+  private:
+    typename TTraits::Watchdog m_driver{};
 };
 
-#endif // I_WATCHDOG_HPP
+#endif // PIL_WATCHDOG_HPP
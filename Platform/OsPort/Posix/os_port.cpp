@@ -0,0 +1,422 @@
+/**
+ ******************************************************************************
+ * @file        os_port.cpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       PilOs on std::thread for Linux hosts, see os_port.hpp.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#include "pil_os.hpp"
+
+namespace Os::Port
+{
+
+struct Access
+{
+    static TaskControl&      of(Task& t_task) { return t_task.m_control; }
+    static SemaphoreControl& of(Semaphore& t_semaphore) { return t_semaphore.m_control; }
+    static TimerControl&     of(Timer& t_timer) { return t_timer.m_control; }
+};
+
+} // namespace Os::Port
+
+namespace
+{
+using Os::Port::Clock;
+using Os::Port::TaskControl;
+using Os::Port::TimerControl;
+
+std::recursive_mutex& lockMutex()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
+// Tasks started before run() wait here
+struct Gate
+{
+    std::mutex              mutex;
+    std::condition_variable opened;
+    bool                    open{false};
+    Clock::time_point       startedAt{Clock::now()};
+};
+
+Gate& gate()
+{
+    static Gate instance;
+    return instance;
+}
+
+TaskControl*    tasks{nullptr};
+Os::KernelStats stats{.cyclesPerUs = 1000};
+
+thread_local TaskControl* self{nullptr}; // The task running on this thread, if any
+
+void recordWake(Clock::time_point t_givenAt)
+{
+    const auto latency = static_cast<std::uint32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t_givenAt).count());
+
+    Os::Lock lock;
+    stats.wakeups++;
+    stats.wakeTotal += latency;
+    stats.wakeMax = (latency > stats.wakeMax) ? latency : stats.wakeMax;
+}
+
+// All timers run from one thread, in expiry order
+class TimerService
+{
+  public:
+    ~TimerService()
+    {
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_changed.notify_all();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    std::recursive_mutex& mutex() { return m_mutex; }
+
+    void add(TimerControl& t_timer)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+        t_timer.next = m_timers;
+        m_timers     = &t_timer;
+        if (!m_thread.joinable())
+        {
+            m_thread = std::thread([this] { serve(); });
+        }
+    }
+
+    void remove(TimerControl& t_timer)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+        for (TimerControl** link = &m_timers; *link != nullptr; link = &(*link)->next)
+        {
+            if (*link == &t_timer)
+            {
+                *link = t_timer.next;
+                break;
+            }
+        }
+    }
+
+    void changed() { m_changed.notify_all(); }
+
+  private:
+    void serve()
+    {
+        std::unique_lock<std::recursive_mutex> lock(m_mutex);
+        while (!m_stopping)
+        {
+            Clock::time_point next = Clock::time_point::max();
+            const auto        now  = Clock::now();
+            for (TimerControl* timer = m_timers; timer != nullptr; timer = timer->next)
+            {
+                if (!timer->active)
+                {
+                    continue;
+                }
+                if (timer->expires <= now)
+                {
+                    // Callbacks run with the service locked, so they may restart or stop
+                    // timers but a timer is never destroyed under them
+                    timer->active = (timer->periodMs != 0);
+                    timer->expires += std::chrono::milliseconds(timer->periodMs);
+                    timer->callback(timer->context);
+                }
+                if (timer->active && (timer->expires < next))
+                {
+                    next = timer->expires;
+                }
+            }
+            m_changed.wait_until(lock, next);
+        }
+    }
+
+    std::recursive_mutex        m_mutex;
+    std::condition_variable_any m_changed;
+    TimerControl*               m_timers{nullptr};
+    bool                        m_stopping{false};
+    std::thread                 m_thread;
+};
+
+TimerService& timerService()
+{
+    static TimerService service;
+    return service;
+}
+
+} // namespace
+
+namespace Os
+{
+
+Lock::Lock()
+{
+    lockMutex().lock();
+}
+
+Lock::~Lock()
+{
+    lockMutex().unlock();
+}
+
+Port::TaskControl::~TaskControl()
+{
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+
+    Lock lock;
+    for (TaskControl** link = &tasks; *link != nullptr; link = &(*link)->registered)
+    {
+        if (*link == this)
+        {
+            *link = registered;
+            break;
+        }
+    }
+}
+
+void Port::join(Task& t_task)
+{
+    TaskControl& control = Access::of(t_task);
+    if (control.thread.joinable())
+    {
+        control.thread.join();
+    }
+}
+
+Task::Task(const char* t_name, TaskEntry t_entry, void* t_argument, std::uint8_t t_priority,
+           std::span<StackWord>)
+    : m_control{.name     = t_name,
+                .entry    = t_entry,
+                .argument = t_argument,
+                .priority = t_priority,
+                .owner    = this}
+{
+}
+
+bool Task::start()
+{
+    if ((m_control.priority == 0) || (m_control.priority >= PRIORITIES))
+    {
+        return false;
+    }
+
+    Lock lock;
+    if (m_control.state != TaskState::Created)
+    {
+        return false;
+    }
+    m_control.state      = TaskState::Ready;
+    m_control.registered = tasks;
+    tasks                = &m_control;
+    m_control.thread     = std::thread(
+        [](TaskControl* t_control)
+        {
+            {
+                std::unique_lock<std::mutex> wait(gate().mutex);
+                gate().opened.wait(wait, [] { return gate().open; });
+            }
+            self = t_control;
+            t_control->entry(t_control->argument);
+            t_control->state = TaskState::Finished;
+        },
+        &m_control);
+    return true;
+}
+
+const char* Task::name() const
+{
+    return m_control.name;
+}
+
+std::uint8_t Task::priority() const
+{
+    return m_control.priority;
+}
+
+TaskState Task::state() const
+{
+    return m_control.state;
+}
+
+TaskStats Task::stats() const
+{
+    return {m_control.switchesIn, 0, 0};
+}
+
+Semaphore::Semaphore(std::uint32_t t_initial, std::uint32_t t_max)
+    : m_control{.count = (t_initial < t_max) ? t_initial : t_max, .max = t_max}
+{
+}
+
+bool Semaphore::take(std::uint32_t t_timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(m_control.mutex);
+    if ((m_control.count == 0) && (t_timeoutMs != 0))
+    {
+        const auto available = [this] { return m_control.count > 0; };
+
+        m_control.waiters++;
+        if (t_timeoutMs == WAIT_FOREVER)
+        {
+            m_control.changed.wait(lock, available);
+        }
+        else
+        {
+            m_control.changed.wait_for(lock, std::chrono::milliseconds(t_timeoutMs), available);
+        }
+        m_control.waiters--;
+
+        if (m_control.count > 0)
+        {
+            recordWake(m_control.givenAt);
+            if (self != nullptr)
+            {
+                self->switchesIn++;
+            }
+        }
+    }
+
+    if (m_control.count == 0)
+    {
+        return false;
+    }
+    m_control.count--;
+    return true;
+}
+
+bool Semaphore::tryTake()
+{
+    return take(0);
+}
+
+void Semaphore::give()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_control.mutex);
+        if (m_control.count >= m_control.max)
+        {
+            return;
+        }
+        m_control.count++;
+        if (m_control.waiters == 0)
+        {
+            return;
+        }
+        m_control.givenAt = Clock::now();
+    }
+    m_control.changed.notify_one();
+}
+
+std::uint32_t Semaphore::count() const
+{
+    std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(m_control.mutex));
+    return m_control.count;
+}
+
+Timer::Timer(TimerCallback t_callback, void* t_context)
+    : m_control{.callback = t_callback, .context = t_context}
+{
+    timerService().add(m_control);
+}
+
+Timer::~Timer()
+{
+    timerService().remove(m_control);
+}
+
+void Timer::start(std::uint32_t t_delayMs, std::uint32_t t_periodMs)
+{
+    {
+        std::lock_guard<std::recursive_mutex> lock(timerService().mutex());
+        m_control.expires  = Clock::now() + std::chrono::milliseconds(t_delayMs);
+        m_control.periodMs = t_periodMs;
+        m_control.active   = true;
+    }
+    timerService().changed();
+}
+
+void Timer::stop()
+{
+    std::lock_guard<std::recursive_mutex> lock(timerService().mutex());
+    m_control.active = false;
+}
+
+bool Timer::isActive() const
+{
+    std::lock_guard<std::recursive_mutex> lock(timerService().mutex());
+    return m_control.active;
+}
+
+void run()
+{
+    {
+        std::lock_guard<std::mutex> lock(gate().mutex);
+        if (!gate().open)
+        {
+            gate().open      = true;
+            gate().startedAt = Clock::now();
+        }
+    }
+    gate().opened.notify_all();
+}
+
+void sleepMs(std::uint32_t t_ms)
+{
+    if (t_ms == 0)
+    {
+        yield();
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(t_ms));
+}
+
+void yield()
+{
+    std::this_thread::yield();
+}
+
+std::uint32_t nowMs()
+{
+    std::lock_guard<std::mutex> lock(gate().mutex);
+    return static_cast<std::uint32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - gate().startedAt)
+            .count());
+}
+
+void forEachTask(void (*t_visit)(const Task& t_task, void* t_context), void* t_context)
+{
+    Lock lock;
+    for (const TaskControl* task = tasks; task != nullptr; task = task->registered)
+    {
+        t_visit(*task->owner, t_context);
+    }
+}
+
+KernelStats kernelStats()
+{
+    Lock lock;
+    return stats;
+}
+
+void resetKernelStats()
+{
+    Lock lock;
+    stats = {.cyclesPerUs = 1000};
+}
+
+} // namespace Os
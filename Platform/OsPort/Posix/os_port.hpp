@@ -0,0 +1,96 @@
+/**
+ ******************************************************************************
+ * @file        os_port.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       PilOs port for Linux hosts: one thread per task, mutex and condition
+ *              variable per semaphore, one thread for all timers.
+ *
+ *              For running and testing application tasks on the host; the
+ *              scheduling is Linux's, so priorities are recorded but not
+ *              enforced. Os::run() releases the tasks started so far and returns.
+ *              A "give from an interrupt" is a give from any other thread. Wake
+ *              latency is measured in nanoseconds (cyclesPerUs = 1000); context
+ *              switches are not visible here and stay 0.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef OS_PORT_HPP
+#define OS_PORT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace Os
+{
+
+class Task;
+
+namespace Port
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct TaskControl
+{
+    const char*                name;
+    TaskEntry                  entry;
+    void*                      argument;
+    std::uint8_t               priority;
+    std::atomic<TaskState>     state{TaskState::Created};
+    std::atomic<std::uint32_t> switchesIn{0}; // Wake-ups from a blocking take()
+    std::thread                thread{};
+    TaskControl*               registered{nullptr};
+    const Task*                owner;
+
+    ~TaskControl(); // Joins the thread: a Task must outlive its entry
+};
+
+struct SemaphoreControl
+{
+    std::mutex              mutex{};
+    std::condition_variable changed{};
+    std::uint32_t           count;
+    std::uint32_t           max;
+    std::uint32_t           waiters{0};
+    Clock::time_point       givenAt{}; // Last give() that found a waiter
+};
+
+struct TimerControl
+{
+    TimerCallback     callback;
+    void*             context;
+    Clock::time_point expires{};
+    std::uint32_t     periodMs{0};
+    bool              active{false};
+    TimerControl*     next{nullptr};
+};
+
+struct Access; // Defined by the port source
+
+/** @brief Host only: wait until t_task's entry has returned. */
+void join(Task& t_task);
+
+} // namespace Port
+
+/** @brief Serialises the port's shared state; a process-wide recursive mutex. */
+class Lock
+{
+  public:
+    Lock();
+    ~Lock();
+
+    Lock(const Lock&)            = delete;
+    Lock& operator=(const Lock&) = delete;
+};
+
+} // namespace Os
+
+#endif // OS_PORT_HPP
@@ -0,0 +1,590 @@
+/**
+ ******************************************************************************
+ * @file        os_port.cpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       PilOs kernel for the STM32F4 App: PendSV context switch, SysTick tick.
+ *
+ *              One FIFO ready queue per priority and a bitmap of non-empty
+ *              queues; the running task stays at the head of its queue. Anything
+ *              that readies a higher-priority task pends PendSV, which runs at
+ *              the lowest priority once every other handler has returned, saves
+ *              r4-r11 (and s16-s31 when the task's EXC_RETURN says it has an FP
+ *              frame, which also completes the lazy stacking of s0-s15) on the
+ *              task's PSP and restores the next task. Tasks that never touch the
+ *              FPU switch without FP registers.
+ *
+ *              SysTick at 1 kHz counts kernel ticks, ends timeouts, rotates
+ *              equal-priority tasks and runs Os::Timer callbacks. The idle task
+ *              sleeps in WFI and re-phases the cycle counter afterwards, as
+ *              IdleSleep_STM32 does for the event loop.
+ *
+ *              Linked into the App only with APP_RTOS, because it owns the
+ *              SysTick and PendSV handlers.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#include <bit>
+#include "pil_os.hpp"
+#include "irq_priority_stm32.hpp"
+#include "timebase_stm32.hpp"
+
+namespace Os::Port
+{
+
+struct Access
+{
+    static TaskControl&      of(Task& t_task) { return t_task.m_control; }
+    static SemaphoreControl& of(Semaphore& t_semaphore) { return t_semaphore.m_control; }
+    static TimerControl&     of(Timer& t_timer) { return t_timer.m_control; }
+};
+
+} // namespace Os::Port
+
+namespace
+{
+using Os::Port::SemaphoreControl;
+using Os::Port::TaskControl;
+using Os::Port::TimerControl;
+
+constexpr std::uint32_t STACK_FILL      = 0xA5A5A5A5U; // Never written: high-water mark
+constexpr std::uint32_t EXC_RETURN_PSP  = 0xFFFFFFFDU; // Thread mode, PSP, no FP frame
+constexpr std::uint32_t XPSR_THUMB      = 0x01000000U;
+constexpr std::uint32_t MIN_STACK_WORDS = 32; // 256 bytes: both frames plus a little
+constexpr std::uint32_t TICK_HZ         = 1000U;
+
+struct ReadyQueue
+{
+    TaskControl* head{nullptr};
+    TaskControl* tail{nullptr};
+};
+
+ReadyQueue      readyQueues[Os::PRIORITIES];
+std::uint32_t   readyMask{0};
+TaskControl*    current{nullptr};
+TaskControl*    tasks{nullptr};
+TimerControl*   timers{nullptr};
+std::uint32_t   ticks{0};
+bool            running{false};
+Os::KernelStats stats;
+
+void requestSwitch()
+{
+    if (running)
+    {
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    }
+}
+
+std::uint8_t highestReady()
+{
+    return static_cast<std::uint8_t>(31 - std::countl_zero(readyMask));
+}
+
+void pushReady(TaskControl& t_task)
+{
+    ReadyQueue& queue = readyQueues[t_task.priority];
+    t_task.next       = nullptr;
+    if (queue.tail == nullptr)
+    {
+        queue.head = &t_task;
+    }
+    else
+    {
+        queue.tail->next = &t_task;
+    }
+    queue.tail = &t_task;
+    readyMask |= 1U << t_task.priority;
+}
+
+void removeReady(TaskControl& t_task)
+{
+    ReadyQueue&  queue    = readyQueues[t_task.priority];
+    TaskControl* previous = nullptr;
+    for (TaskControl* each = queue.head; each != nullptr; previous = each, each = each->next)
+    {
+        if (each != &t_task)
+        {
+            continue;
+        }
+        (previous == nullptr ? queue.head : previous->next) = each->next;
+        if (queue.tail == each)
+        {
+            queue.tail = previous;
+        }
+        break;
+    }
+    if (queue.head == nullptr)
+    {
+        readyMask &= ~(1U << t_task.priority);
+    }
+    t_task.next = nullptr;
+}
+
+// Move the running task behind the others of its priority
+bool rotate()
+{
+    ReadyQueue& queue = readyQueues[current->priority];
+    if ((queue.head != current) || (current->next == nullptr))
+    {
+        return false;
+    }
+    queue.head       = current->next;
+    current->next    = nullptr;
+    queue.tail->next = current;
+    queue.tail       = current;
+    return true;
+}
+
+void makeReady(TaskControl& t_task)
+{
+    t_task.state = Os::TaskState::Ready;
+    t_task.timed = false;
+    pushReady(t_task);
+    if ((current != nullptr) && (t_task.priority > current->priority))
+    {
+        requestSwitch();
+    }
+}
+
+// Unlink the highest-priority waiter, first come first served among equals
+TaskControl* popWaiter(SemaphoreControl& t_semaphore)
+{
+    TaskControl** best = nullptr;
+    for (TaskControl** link = &t_semaphore.waiters; *link != nullptr; link = &(*link)->next)
+    {
+        if ((best == nullptr) || ((*link)->priority > (*best)->priority))
+        {
+            best = link;
+        }
+    }
+    if (best == nullptr)
+    {
+        return nullptr;
+    }
+    TaskControl* waiter = *best;
+    *best               = waiter->next;
+    waiter->next        = nullptr;
+    waiter->waitingOn   = nullptr;
+    return waiter;
+}
+
+void unlinkWaiter(TaskControl& t_task)
+{
+    for (TaskControl** link = &t_task.waitingOn->waiters; *link != nullptr; link = &(*link)->next)
+    {
+        if (*link == &t_task)
+        {
+            *link = t_task.next;
+            break;
+        }
+    }
+    t_task.next      = nullptr;
+    t_task.waitingOn = nullptr;
+}
+
+// Take the running task off the CPU until makeReady(); the switch happens when the
+// caller's Lock ends
+void blockCurrent(Os::TaskState t_state, std::uint32_t t_timeout)
+{
+    removeReady(*current);
+    current->state    = t_state;
+    current->timed    = (t_timeout != Os::WAIT_FOREVER);
+    current->wakeTick = ticks + t_timeout;
+    requestSwitch();
+}
+
+[[noreturn]] void taskExit()
+{
+    {
+        Os::Lock lock;
+        removeReady(*current);
+        current->state = Os::TaskState::Finished;
+        requestSwitch();
+    }
+    for (;;)
+    {
+    }
+}
+
+void startTask(TaskControl& t_task)
+{
+    auto* const words = reinterpret_cast<std::uint32_t*>(t_task.stack);
+    for (std::uint32_t i = 0; i < t_task.stackWords * 2; ++i)
+    {
+        words[i] = STACK_FILL;
+    }
+
+    // What PendSV restores: r4-r11 and EXC_RETURN, then the exception frame
+    // r0-r3, r12, lr, pc, xPSR; the entry returns into taskExit()
+    std::uint32_t* const sp = words + (t_task.stackWords * 2) - 17;
+    sp[8]                   = EXC_RETURN_PSP;
+    sp[9]                   = reinterpret_cast<std::uint32_t>(t_task.argument);
+    sp[14]                  = reinterpret_cast<std::uint32_t>(&taskExit);
+    sp[15]                  = reinterpret_cast<std::uint32_t>(t_task.entry) & ~1U;
+    sp[16]                  = XPSR_THUMB;
+    t_task.sp               = sp;
+
+    t_task.registered = tasks;
+    tasks             = &t_task;
+    makeReady(t_task);
+}
+
+void idleEntry(void*)
+{
+    for (;;)
+    {
+        __DSB();
+        __WFI();
+        timebase.resyncCycles();
+    }
+}
+
+Os::StackWord idleStack[MIN_STACK_WORDS * 2];
+Os::Task      idleTask("idle", &idleEntry, nullptr, 0, idleStack);
+
+} // namespace
+
+/**
+ * @brief Called by PendSV with the outgoing task's saved PSP (interrupts masked);
+ *        returns the PSP of the task to run
+ */
+extern "C" __attribute__((used)) std::uint32_t* OsPort_Switch(std::uint32_t* t_sp,
+                                                               std::uint32_t t_startCycles)
+{
+    if (current != nullptr)
+    {
+        current->sp = t_sp;
+    }
+
+    TaskControl* const  next = readyQueues[highestReady()].head;
+    const std::uint32_t now  = DWT->CYCCNT;
+    if (next != current)
+    {
+        const std::uint32_t cycles = now - t_startCycles;
+        next->switchesIn++;
+        stats.switches++;
+        stats.switchTotal += cycles;
+        stats.switchMax = (cycles > stats.switchMax) ? cycles : stats.switchMax;
+    }
+    if (next->woken)
+    {
+        const std::uint32_t latency = now - next->wokenAt;
+        next->woken                 = false;
+        stats.wakeups++;
+        stats.wakeTotal += latency;
+        stats.wakeMax = (latency > stats.wakeMax) ? latency : stats.wakeMax;
+    }
+
+    current = next;
+    return next->sp;
+}
+
+extern "C" __attribute__((naked)) void PendSV_Handler(void)
+{
+    __asm volatile("    ldr      r1, =0xE0001004 \n" // DWT->CYCCNT
+                   "    ldr      r1, [r1]        \n"
+                   "    mrs      r0, psp         \n"
+                   "    tst      lr, #0x10       \n" // EXC_RETURN bit 4 clear: FP frame
+                   "    it       eq              \n"
+                   "    vstmdbeq r0!, {s16-s31}  \n"
+                   "    stmdb    r0!, {r4-r11, lr}\n"
+                   "    cpsid    i               \n"
+                   "    bl       OsPort_Switch   \n"
+                   "    cpsie    i               \n"
+                   "    ldmia    r0!, {r4-r11, lr}\n"
+                   "    tst      lr, #0x10       \n"
+                   "    it       eq              \n"
+                   "    vldmiaeq r0!, {s16-s31}  \n"
+                   "    msr      psp, r0         \n"
+                   "    isb                      \n"
+                   "    bx       lr              \n"
+                   "    .ltorg                   \n");
+}
+
+extern "C" void SysTick_Handler(void)
+{
+    {
+        Os::Lock lock;
+        ticks++;
+
+        for (TaskControl* task = tasks; task != nullptr; task = task->registered)
+        {
+            if (!task->timed || (task->wakeTick != ticks))
+            {
+                continue;
+            }
+            if (task->state == Os::TaskState::Blocked)
+            {
+                unlinkWaiter(*task);
+                task->timedOut = true;
+            }
+            makeReady(*task);
+        }
+
+        if ((current != nullptr) && (current->state == Os::TaskState::Ready) && rotate())
+        {
+            requestSwitch();
+        }
+    }
+
+    for (TimerControl* timer = timers; timer != nullptr; timer = timer->next)
+    {
+        bool due = false;
+        {
+            Os::Lock lock;
+            if (timer->active && (timer->expires == ticks))
+            {
+                due            = true;
+                timer->active  = (timer->period != 0);
+                timer->expires = ticks + timer->period;
+            }
+        }
+        if (due)
+        {
+            timer->callback(timer->context);
+        }
+    }
+}
+
+namespace Os
+{
+
+Task::Task(const char* t_name, TaskEntry t_entry, void* t_argument, std::uint8_t t_priority,
+           std::span<StackWord> t_stack)
+    : m_control{.name       = t_name,
+                .entry      = t_entry,
+                .argument   = t_argument,
+                .stack      = t_stack.data(),
+                .stackWords = static_cast<std::uint32_t>(t_stack.size()),
+                .priority   = t_priority,
+                .owner      = this}
+{
+}
+
+bool Task::start()
+{
+    if ((m_control.priority == 0) || (m_control.priority >= PRIORITIES) ||
+        (m_control.stackWords * 2 < MIN_STACK_WORDS))
+    {
+        return false;
+    }
+
+    Lock lock;
+    if (m_control.state != TaskState::Created)
+    {
+        return false;
+    }
+    startTask(m_control);
+    return true;
+}
+
+const char* Task::name() const
+{
+    return m_control.name;
+}
+
+std::uint8_t Task::priority() const
+{
+    return m_control.priority;
+}
+
+TaskState Task::state() const
+{
+    return m_control.state;
+}
+
+TaskStats Task::stats() const
+{
+    const auto* const   words = reinterpret_cast<const std::uint32_t*>(m_control.stack);
+    const std::uint32_t total = m_control.stackWords * 2;
+
+    std::uint32_t untouched = 0;
+    while ((untouched < total) && (words[untouched] == STACK_FILL))
+    {
+        untouched++;
+    }
+    return {m_control.switchesIn, (total - untouched) * 4, total * 4};
+}
+
+Semaphore::Semaphore(std::uint32_t t_initial, std::uint32_t t_max)
+    : m_control{.count = (t_initial < t_max) ? t_initial : t_max, .max = t_max}
+{
+}
+
+bool Semaphore::take(std::uint32_t t_timeoutMs)
+{
+    TaskControl* self = nullptr;
+    {
+        Lock lock;
+        if (m_control.count > 0)
+        {
+            m_control.count--;
+            return true;
+        }
+        if ((t_timeoutMs == 0) || !running || (__get_IPSR() != 0))
+        {
+            return false;
+        }
+
+        self            = current;
+        self->timedOut  = false;
+        self->waitingOn = &m_control;
+        blockCurrent(TaskState::Blocked, t_timeoutMs);
+
+        // Wait list order does not matter: give() picks by priority
+        self->next        = m_control.waiters;
+        m_control.waiters = self;
+    }
+
+    // Runs again after give() handed over a count, or after the timeout
+    return !self->timedOut;
+}
+
+bool Semaphore::tryTake()
+{
+    Lock lock;
+    if (m_control.count == 0)
+    {
+        return false;
+    }
+    m_control.count--;
+    return true;
+}
+
+void Semaphore::give()
+{
+    Lock lock;
+    TaskControl* const waiter = popWaiter(m_control);
+    if (waiter == nullptr)
+    {
+        m_control.count += (m_control.count < m_control.max) ? 1 : 0;
+        return;
+    }
+    waiter->woken   = true;
+    waiter->wokenAt = DWT->CYCCNT;
+    makeReady(*waiter);
+}
+
+std::uint32_t Semaphore::count() const
+{
+    return m_control.count;
+}
+
+Timer::Timer(TimerCallback t_callback, void* t_context)
+    : m_control{.callback = t_callback, .context = t_context}
+{
+    Lock lock;
+    m_control.next = timers;
+    timers         = &m_control;
+}
+
+Timer::~Timer()
+{
+    Lock lock;
+    for (TimerControl** link = &timers; *link != nullptr; link = &(*link)->next)
+    {
+        if (*link == &m_control)
+        {
+            *link = m_control.next;
+            break;
+        }
+    }
+}
+
+void Timer::start(std::uint32_t t_delayMs, std::uint32_t t_periodMs)
+{
+    Lock lock;
+    m_control.expires = ticks + ((t_delayMs != 0) ? t_delayMs : 1);
+    m_control.period  = t_periodMs;
+    m_control.active  = true;
+}
+
+void Timer::stop()
+{
+    Lock lock;
+    m_control.active = false;
+}
+
+bool Timer::isActive() const
+{
+    return m_control.active;
+}
+
+void run()
+{
+    {
+        Lock lock;
+        startTask(Port::Access::of(idleTask));
+    }
+
+    // PendSV below every device interrupt, SysTick with it
+    NVIC_SetPriority(PendSV_IRQn, IrqPriority::SOFT_IRQ);
+    SysTick_Config(SystemCoreClock / TICK_HZ);
+    NVIC_SetPriority(SysTick_IRQn, IrqPriority::KERNEL);
+    stats.cyclesPerUs = SystemCoreClock / 1000000U;
+
+    // The first PendSV saves the caller's registers here and never comes back
+    static std::uint32_t discard[48];
+    __set_PSP(reinterpret_cast<std::uint32_t>(&discard[48]));
+
+    running = true;
+    requestSwitch();
+    __enable_irq();
+    __ISB();
+    for (;;)
+    {
+    }
+}
+
+void sleepMs(std::uint32_t t_ms)
+{
+    if (t_ms == 0)
+    {
+        yield();
+        return;
+    }
+    Lock lock;
+    blockCurrent(TaskState::Sleeping, t_ms);
+}
+
+void yield()
+{
+    Lock lock;
+    if (rotate())
+    {
+        requestSwitch();
+    }
+}
+
+std::uint32_t nowMs()
+{
+    return ticks;
+}
+
+void forEachTask(void (*t_visit)(const Task& t_task, void* t_context), void* t_context)
+{
+    for (const TaskControl* task = tasks; task != nullptr; task = task->registered)
+    {
+        t_visit(*task->owner, t_context);
+    }
+}
+
+KernelStats kernelStats()
+{
+    Lock lock;
+    return stats;
+}
+
+void resetKernelStats()
+{
+    Lock lock;
+    const std::uint32_t cyclesPerUs = stats.cyclesPerUs;
+    stats                           = {};
+    stats.cyclesPerUs               = cyclesPerUs;
+}
+
+} // namespace Os
@@ -0,0 +1,91 @@
+/**
+ ******************************************************************************
+ * @file        os_port.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       PilOs port for the STM32F4 App (Cortex-M4F): control blocks and Lock.
+ *
+ *              Kernel state is only touched with PRIMASK set (Os::Lock), so the
+ *              same code serves tasks, SysTick and device interrupts. Included by
+ *              pil_os.hpp; not meant to be included directly.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef OS_PORT_HPP
+#define OS_PORT_HPP
+
+#include <cstdint>
+#include "stm32f4xx.h"
+
+namespace Os
+{
+
+class Task;
+
+namespace Port
+{
+
+struct SemaphoreControl;
+
+struct TaskControl
+{
+    std::uint32_t*    sp{nullptr}; // Saved PSP while another task runs
+    const char*       name;
+    TaskEntry         entry;
+    void*             argument;
+    StackWord*        stack;
+    std::uint32_t     stackWords;
+    std::uint8_t      priority;
+    TaskState         state{TaskState::Created};
+    bool              timed{false};    // wakeTick applies
+    bool              timedOut{false}; // Left a semaphore by its timeout
+    bool              woken{false};    // wokenAt holds the give() that readied it
+    std::uint32_t     wakeTick{0};
+    std::uint32_t     wokenAt{0};
+    std::uint32_t     switchesIn{0};
+    SemaphoreControl* waitingOn{nullptr};
+    TaskControl*      next{nullptr};       // Ready queue or semaphore wait list
+    TaskControl*      registered{nullptr}; // List of all started tasks
+    const Task*       owner;
+};
+
+struct SemaphoreControl
+{
+    std::uint32_t count;
+    std::uint32_t max;
+    TaskControl*  waiters{nullptr};
+};
+
+struct TimerControl
+{
+    TimerCallback callback;
+    void*         context;
+    std::uint32_t expires{0};
+    std::uint32_t period{0};
+    bool          active{false};
+    TimerControl* next{nullptr};
+};
+
+struct Access; // Defined by the port source
+
+} // namespace Port
+
+class Lock
+{
+  public:
+    Lock() : m_primask(__get_PRIMASK()) { __disable_irq(); }
+    ~Lock() { __set_PRIMASK(m_primask); }
+
+    Lock(const Lock&)            = delete;
+    Lock& operator=(const Lock&) = delete;
+
+  private:
+    std::uint32_t m_primask;
+};
+
+} // namespace Os
+
+#endif // OS_PORT_HPP
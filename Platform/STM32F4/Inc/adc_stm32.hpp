@@ -1,7 +1,7 @@
 /**
  * @file      Platform/STM32F4/Inc/adc_stm32.hpp
  * @author    it32bit
- * @brief     Provides STM32F4-specific implementation of the IAdc interface.
+ * @brief     Provides the STM32F4 AdcDriver bound by PlatformAdc.
  *            Wraps internal ADC configuration and temperature sensor reading using LL drivers.
  *
  * @version   1.0
@@ -13,13 +13,11 @@
 #ifndef ADC_STM32_HPP
 #define ADC_STM32_HPP
 
-#include "pil_adc.hpp"
-
-class Adc_STM32 : public IAdc
+class Adc_STM32
 {
   public:
-    void  init() override;
-    float readTemperature() override;
+    void  init();
+    float readTemperature();
 };
 
 #endif
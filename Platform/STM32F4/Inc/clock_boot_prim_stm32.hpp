@@ -6,8 +6,8 @@
  * @date        2025-10-22
  * @brief       STM32F4 system clock configuration for Primary Bootloader
  *
- *              Declares the Clock_BootPrim class, which implements the IClockConfigurator
- *              interface and provides minimal system clock setup using the internal HSI oscillator.
+ *              Declares the Clock_BootPrim class, the ClockDriver of the Primary Bootloader,
+ *              which provides minimal system clock setup using the internal HSI oscillator.
  *              This configuration avoids PLL setup and uses default reset values for simplicity.
  *
  *              - System Clock Source            : HSI (internal 16 MHz)
@@ -31,12 +31,10 @@
 #ifndef CLOCK_BOOT_PRIM_STM32_HPP
 #define CLOCK_BOOT_PRIM_STM32_HPP
 
-#include "pil_clock_config.hpp"
-
-class Clock_BootPrim : public IClockConfigurator
+class Clock_BootPrim
 {
   public:
-    void configure(void (*handler)()) override;
+    void configure(void (*handler)());
 };
 
 #endif // CLOCK_BOOT_PRIM_STM32_HPP
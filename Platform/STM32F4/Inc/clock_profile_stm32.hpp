@@ -0,0 +1,47 @@
+/**
+ ******************************************************************************
+ * @file        clock_profile_stm32.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       Bus clocks of each clock configuration, for compile-time arithmetic.
+ *
+ *              Mirrors Clock_STM32F4 and Clock_BootPrim (keep them in sync) and is
+ *              selected the same way as in ClockManager: BOOT_PRIM picks the HSI
+ *              setup. Peripheral drivers derive prescalers from ACTIVE_CLOCK_PROFILE
+ *              in constexpr instead of reading RCC at run time.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef CLOCK_PROFILE_STM32_HPP
+#define CLOCK_PROFILE_STM32_HPP
+
+#include <stdint.h>
+
+struct ClockProfile
+{
+    uint32_t sysclkHz;
+    uint32_t hclkHz;
+    uint32_t pclk1Hz;
+    uint32_t pclk2Hz;
+
+    // Timers on a divided APB bus run at twice the bus clock
+    constexpr uint32_t apb1TimerHz() const { return (pclk1Hz == hclkHz) ? pclk1Hz : 2 * pclk1Hz; }
+    constexpr uint32_t apb2TimerHz() const { return (pclk2Hz == hclkHz) ? pclk2Hz : 2 * pclk2Hz; }
+};
+
+// HSE 8 MHz, PLL to 168 MHz, APB1 /4, APB2 /2 (Clock_STM32F4)
+inline constexpr ClockProfile CLOCK_PROFILE_PLL_168MHZ{168000000, 168000000, 42000000, 84000000};
+
+// HSI 16 MHz, no PLL, no dividers (Clock_BootPrim)
+inline constexpr ClockProfile CLOCK_PROFILE_HSI_16MHZ{16000000, 16000000, 16000000, 16000000};
+
+#ifdef BOOT_PRIM
+inline constexpr const ClockProfile& ACTIVE_CLOCK_PROFILE = CLOCK_PROFILE_HSI_16MHZ;
+#else
+inline constexpr const ClockProfile& ACTIVE_CLOCK_PROFILE = CLOCK_PROFILE_PLL_168MHZ;
+#endif
+
+#endif // CLOCK_PROFILE_STM32_HPP
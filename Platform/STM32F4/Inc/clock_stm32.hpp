@@ -6,8 +6,9 @@
  * @date        2025-10-18
  * @brief       STM32F4 system clock configuration interface.
  *
- *              Declares the Clock_STM32F4 class, which implements the IClockConfigurator
- *              interface and provides system clock setup using PLL with HSE as the source.
+ *              Declares the Clock_STM32F4 class, the ClockDriver of the Application
+ *              and Secondary Bootloader, which provides system clock setup using PLL
+ *              with HSE as the source.
  *              The configuration targets the following parameters:
  *
  *              - System Clock source            : PLL (HSE)
@@ -34,12 +35,10 @@
 #ifndef CLOCK_STM32_HPP
 #define CLOCK_STM32_HPP
 
-#include "pil_clock_config.hpp"
-
-class Clock_STM32F4 : public IClockConfigurator
+class Clock_STM32F4
 {
   public:
-    void configure(void (*handler)()) override;
+    void configure(void (*handler)());
 
   private:
     void configureSystemClock();
@@ -0,0 +1,34 @@
+/**
+ * @file      Platform/STM32F4/Inc/cycle_counter_stm32.hpp
+ * @author    it32bit
+ * @brief     DWT cycle counter for short interval profiling.
+ *
+ * @details   Cheap 32-bit reads for ISR timing. The counter is started by
+ *            Timebase_STM32::initialize(), which keeps it in phase with TIM2.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef CYCLE_COUNTER_STM32_HPP
+#define CYCLE_COUNTER_STM32_HPP
+
+#include <cstdint>
+#include "stm32f4xx.h"
+
+class CycleCounter
+{
+  public:
+    static std::uint32_t now() { return DWT->CYCCNT; }
+
+    // Wrap-safe for intervals below 2^32 cycles (~25 s at 168 MHz)
+    static std::uint32_t elapsed(std::uint32_t t_start) { return DWT->CYCCNT - t_start; }
+
+    static std::uint32_t toMicroseconds(std::uint32_t t_cycles)
+    {
+        return t_cycles / (SystemCoreClock / 1000000U);
+    }
+};
+
+#endif // CYCLE_COUNTER_STM32_HPP
@@ -0,0 +1,255 @@
+/**
+ ******************************************************************************
+ * @file        dma_stm32.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       DMA request routing, compile-time stream allocation and IDmaChannel
+ *              on the STM32F4 DMA1/DMA2 streams.
+ *
+ *              dmaRoutes() is the F4 request mapping (RM0090 tables 42/43): the
+ *              controller/stream/channel combinations that can serve a request. An
+ *              image lists every request it uses once, in one DmaAllocation:
+ *
+ *                  using AppDma = DmaAllocation<DmaRequest::Usart2Tx, DmaRequest::Adc1>;
+ *                  DmaStream_STM32 adcDma{AppDma::route<DmaRequest::Adc1>()};
+ *
+ *              which picks a stream for each request at compile time, trying the
+ *              alternatives, and fails to compile if two requests would need the
+ *              same stream. Drivers that pick a stream at run time (timer capture)
+ *              bind() it and get false while another owner holds it.
+ *
+ *              Each stream interrupt goes through one table lookup to its owner,
+ *              which clears the flags and calls the transfer's callback.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef DMA_STM32_HPP
+#define DMA_STM32_HPP
+
+#include <array>
+#include <cstddef>
+#include "pil_dma.hpp"
+#include "irq_priority_stm32.hpp"
+#include <stdint.h>
+
+enum class DmaRequest : uint8_t
+{
+    Spi3Rx,
+    Spi3Tx,
+    I2c1Rx,
+    I2c1Tx,
+    Spi2Rx,
+    Spi2Tx,
+    Usart3Rx,
+    Usart3Tx,
+    Uart4Rx,
+    Uart4Tx,
+    Usart2Rx,
+    Usart2Tx,
+    Tim3Ch1,
+    Tim3Ch2,
+    Tim3Ch3,
+    Tim3Ch4,
+    Tim4Ch1,
+    Tim4Ch2,
+    Tim4Ch3,
+    Tim5Ch1,
+    Tim5Ch2,
+    Tim5Ch3,
+    Tim5Ch4,
+    Adc1,
+    Spi1Rx,
+    Spi1Tx,
+    Usart1Rx,
+    Usart1Tx,
+    Usart6Rx,
+    Usart6Tx,
+    MemToMem
+};
+
+struct DmaRoute
+{
+    uint8_t controller{0}; // 1 or 2, 0 for none
+    uint8_t stream{0};
+    uint8_t channel{0};
+
+    constexpr bool valid() const { return controller != 0; }
+
+    constexpr bool sharesStream(const DmaRoute& t_other) const
+    {
+        return (controller == t_other.controller) && (stream == t_other.stream);
+    }
+
+    constexpr bool operator==(const DmaRoute&) const = default;
+};
+
+struct DmaRoutes
+{
+    std::array<DmaRoute, 8> options{};
+    size_t                  count{0};
+};
+
+constexpr DmaRoutes dmaRoutes(DmaRequest t_request)
+{
+    // clang-format off
+    switch (t_request)
+    {
+        case DmaRequest::Spi3Rx:   return {{{{1, 0, 0}, {1, 2, 0}}}, 2};
+        case DmaRequest::Spi3Tx:   return {{{{1, 5, 0}, {1, 7, 0}}}, 2};
+        case DmaRequest::I2c1Rx:   return {{{{1, 0, 1}, {1, 5, 1}}}, 2};
+        case DmaRequest::I2c1Tx:   return {{{{1, 6, 1}, {1, 7, 1}}}, 2};
+        case DmaRequest::Spi2Rx:   return {{{{1, 3, 0}}}, 1};
+        case DmaRequest::Spi2Tx:   return {{{{1, 4, 0}}}, 1};
+        case DmaRequest::Usart3Rx: return {{{{1, 1, 4}}}, 1};
+        case DmaRequest::Usart3Tx: return {{{{1, 3, 4}, {1, 4, 7}}}, 2};
+        case DmaRequest::Uart4Rx:  return {{{{1, 2, 4}}}, 1};
+        case DmaRequest::Uart4Tx:  return {{{{1, 4, 4}}}, 1};
+        case DmaRequest::Usart2Rx: return {{{{1, 5, 4}}}, 1};
+        case DmaRequest::Usart2Tx: return {{{{1, 6, 4}}}, 1};
+        case DmaRequest::Tim3Ch1:  return {{{{1, 4, 5}}}, 1};
+        case DmaRequest::Tim3Ch2:  return {{{{1, 5, 5}}}, 1};
+        case DmaRequest::Tim3Ch3:  return {{{{1, 7, 5}}}, 1};
+        case DmaRequest::Tim3Ch4:  return {{{{1, 2, 5}}}, 1};
+        case DmaRequest::Tim4Ch1:  return {{{{1, 0, 2}}}, 1};
+        case DmaRequest::Tim4Ch2:  return {{{{1, 3, 2}}}, 1};
+        case DmaRequest::Tim4Ch3:  return {{{{1, 7, 2}}}, 1};
+        case DmaRequest::Tim5Ch1:  return {{{{1, 2, 6}}}, 1};
+        case DmaRequest::Tim5Ch2:  return {{{{1, 4, 6}}}, 1};
+        case DmaRequest::Tim5Ch3:  return {{{{1, 0, 6}}}, 1};
+        case DmaRequest::Tim5Ch4:  return {{{{1, 1, 6}, {1, 3, 6}}}, 2};
+        case DmaRequest::Adc1:     return {{{{2, 0, 0}, {2, 4, 0}}}, 2};
+        case DmaRequest::Spi1Rx:   return {{{{2, 0, 3}, {2, 2, 3}}}, 2};
+        case DmaRequest::Spi1Tx:   return {{{{2, 3, 3}, {2, 5, 3}}}, 2};
+        case DmaRequest::Usart1Rx: return {{{{2, 2, 4}, {2, 5, 4}}}, 2};
+        case DmaRequest::Usart1Tx: return {{{{2, 7, 4}}}, 1};
+        case DmaRequest::Usart6Rx: return {{{{2, 1, 5}, {2, 2, 5}}}, 2};
+        case DmaRequest::Usart6Tx: return {{{{2, 6, 5}, {2, 7, 5}}}, 2};
+        case DmaRequest::MemToMem: // Only DMA2 can copy memory to memory, on any stream
+            return {{{{2, 0, 0}, {2, 1, 0}, {2, 2, 0}, {2, 3, 0}, {2, 4, 0}, {2, 5, 0},
+                      {2, 6, 0}, {2, 7, 0}}},
+                    8};
+    }
+    // clang-format on
+    return {};
+}
+
+/**
+ * @brief One stream per request, none shared; backtracks over the alternatives.
+ *        All routes are invalid when no such assignment exists.
+ */
+template <size_t N>
+constexpr std::array<DmaRoute, N> planDma(const std::array<DmaRequest, N>& t_requests)
+{
+    std::array<DmaRoute, N> plan{};
+    std::array<size_t, N>   choice{};
+    size_t                  index = 0;
+
+    while (index < N)
+    {
+        const DmaRoutes routes = dmaRoutes(t_requests[index]);
+        bool            placed = false;
+
+        for (; (choice[index] < routes.count) && !placed; ++choice[index])
+        {
+            const DmaRoute candidate = routes.options[choice[index]];
+            bool           free      = true;
+            for (size_t i = 0; i < index; ++i)
+            {
+                free = free && !plan[i].sharesStream(candidate);
+            }
+            if (free)
+            {
+                plan[index] = candidate;
+                placed      = true;
+            }
+        }
+
+        if (placed)
+        {
+            ++index;
+            continue;
+        }
+        if (index == 0)
+        {
+            return {};
+        }
+        choice[index] = 0; // Exhausted: try the next option of the previous request
+        --index;
+    }
+    return plan;
+}
+
+template <size_t N>
+constexpr bool isPlanValid(const std::array<DmaRoute, N>& t_plan)
+{
+    for (const DmaRoute& route : t_plan)
+    {
+        if (!route.valid())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <DmaRequest... Requests>
+class DmaAllocation
+{
+  public:
+    static constexpr std::array<DmaRequest, sizeof...(Requests)> requests{Requests...};
+    static constexpr std::array<DmaRoute, sizeof...(Requests)>   plan = planDma(requests);
+
+    static_assert(isPlanValid(plan), "DMA requests need the same stream; no allocation fits");
+
+    template <DmaRequest TRequest>
+    static constexpr DmaRoute route()
+    {
+        static_assert(((Requests == TRequest) + ... + 0) == 1,
+                      "Request must be listed exactly once in the allocation");
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            if (requests[i] == TRequest)
+            {
+                return plan[i];
+            }
+        }
+        return {};
+    }
+};
+
+class DmaStream_STM32 : public IDmaChannel
+{
+  public:
+    static constexpr uint32_t IRQ_PRIORITY = IrqPriority::DMA;
+
+    DmaStream_STM32() = default;
+    explicit DmaStream_STM32(DmaRoute t_route) { bind(t_route); }
+
+    /** @brief Take the stream; false while another DmaStream_STM32 owns it. */
+    bool bind(DmaRoute t_route);
+    void release();
+
+    bool          start(const DmaTransfer& t_transfer) override;
+    void          stop() override;
+    bool          isBusy() const override;
+    uint16_t      remaining() const override;
+    uint8_t       activeBuffer() const override;
+    const DmaRoute& route() const { return m_route; }
+
+    /** @brief Handle pending flags in the caller's context, for use with interrupts masked. */
+    void poll() { onInterrupt(); }
+
+    /** @brief Stream interrupt. */
+    void onInterrupt();
+
+  private:
+    DmaRoute    m_route{};
+    bool        m_bound{false};
+    DmaCallback m_callback{nullptr};
+    void*       m_context{nullptr};
+};
+
+#endif // DMA_STM32_HPP
@@ -0,0 +1,42 @@
+/**
+ * @file      Platform/STM32F4/Inc/fault_capture_stm32.hpp
+ * @author    it32bit
+ * @brief     Cortex-M4 fault capture into a .noinit RAM buffer.
+ *
+ * @details   HardFault/MemManage/BusFault/UsageFault branch to FaultCapture_Entry, which
+ *            picks the active stack (MSP/PSP) and hands the stacked frame to
+ *            FaultCapture_Save. The snapshot (stacked registers, fault status registers,
+ *            bounded stack copy, boot profile) lands in .noinit, which the linker places
+ *            in CCMRAM - memory the bootloaders never touch - and the MCU is reset at once
+ *            instead of waiting for the watchdog. After reset the application moves the
+ *            pending record to the error log (see Log::FlashLog).
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef FAULT_CAPTURE_STM32_HPP
+#define FAULT_CAPTURE_STM32_HPP
+
+#include <cstdint>
+#include "crash_record.hpp"
+
+class FaultCapture
+{
+  public:
+    static bool                    hasPending();
+    static const Log::CrashRecord& pending();
+    static void                    clear();
+
+  private:
+    FaultCapture() = delete;
+};
+
+extern "C"
+{
+    void FaultCapture_Entry(void);
+    void FaultCapture_Save(const std::uint32_t* t_frame, std::uint32_t t_exc_return);
+}
+
+#endif // FAULT_CAPTURE_STM32_HPP
@@ -32,7 +32,7 @@
     | Sector | Size   | Start Address  | End Address   | Notes                       (*)|
     |--------|--------|----------------|---------------|--------------------------------|
     | 0      | 16 KB  | 0x0800_0000    | 0x0800_3FFF   | Primary Bootloader             |
-    | 1      | 16 KB  | 0x0800_4000    | 0x0800_7FFF   | Private Certificate            |
+    | 1      | 16 KB  | 0x0800_4000    | 0x0800_7FFF   | Certificate (public key store) |
     | 2      | 16 KB  | 0x0800_8000    | 0x0800_BFFF   | Error Logs                     |
     | 3      | 16 KB  | 0x0800_C000    | 0x0800_FFFF   | Boot Flags + Configuration     |
     | 4      | 64 KB  | 0x0801_0000    | 0x0801_FFFF   | Secendary Bootloader           |
@@ -141,10 +141,13 @@ constexpr std::uintptr_t FLASH_END_ADDR   = 0x080FFFFF;
 constexpr std::uintptr_t BOOTLOADER1_START = 0x08000000;
 constexpr std::size_t    BOOTLOADER1_SIZE  = 16 * 1024;
 
-// Sector 1: Reserved for private certificate
+// Sector 1: Certificate store (Firmware::PublicKeyStore, provisioned once)
 constexpr std::uintptr_t CERT_PRIVATE_START = 0x08004000;
 constexpr std::size_t    CERT_PRIVATE_SIZE  = 16 * 1024;
 
+// Device secret (Firmware::DeviceSecret) keying the signature cache, provisioned once per device
+constexpr std::uintptr_t CERT_DEVICE_SECRET_START = CERT_PRIVATE_START + 0x100;
+
 // Sector 2: Error logs
 constexpr std::uintptr_t ERROR_LOG_START = 0x08008000;
 constexpr std::size_t    ERROR_LOG_SIZE  = 16 * 1024;
@@ -153,6 +156,14 @@ constexpr std::size_t    ERROR_LOG_SIZE  = 16 * 1024;
 constexpr std::uintptr_t CONFIG_START = 0x0800C000;
 constexpr std::size_t    CONFIG_SIZE  = 16 * 1024;
 
+// Verified-signature cache, appended after the boot flag (erased together with it)
+constexpr std::uintptr_t CONFIG_SIGNATURE_CACHE_START = CONFIG_START + 0x100;
+constexpr std::size_t    CONFIG_SIGNATURE_CACHE_SIZE  = 256;
+
+// "Region known erased" markers for the update slots, appended after the signature cache
+constexpr std::uintptr_t CONFIG_ERASED_MARKER_START = CONFIG_START + 0x200;
+constexpr std::size_t    CONFIG_ERASED_MARKER_SIZE  = 128;
+
 // Sector 4: Secondary Bootloader
 constexpr std::uintptr_t BOOTLOADER2_START = 0x08010000;
 constexpr std::size_t    BOOTLOADER2_SIZE  = 64 * 1024;
@@ -16,7 +16,7 @@
  *  #include "gpio_manager_stm32.hpp"
  *
  *  GpioManager gpio;
- *  gpio.initialize(gpioPinConfigs);
+ *  gpio.initialize(); // gpioPinConfigs, through gpioImage
  *  auto led = gpio.getPin(PinId::LD_RED);
  *
  *  led->set();
@@ -29,8 +29,8 @@
 #include <array>
 #include <string_view>
 #include "pil_pin_config.hpp"
-#include "gpio_pin_stm32.hpp"
 #include "pil_pin_id.hpp"
+#include "irq_priority_stm32.hpp"
 
 using enum PinConfig::Mode;
 using enum PinConfig::Pull;
@@ -49,7 +49,8 @@ constexpr std::size_t PIN_CONFIG_ARRAY_SIZE = static_cast<std::size_t>(PinId::CO
  *          without the need to populate structs in stack memory
  */
 constexpr std::array<PinConfig, PIN_CONFIG_ARRAY_SIZE> gpioPinConfigs = {
-    {{PinId::BUTTON, PortA, 0, Input, PullDown, PushPull, Low, ExtiIT, Rising, 0, 15},
+    {{PinId::BUTTON, PortA, 0, Input, PullDown, PushPull, Low, ExtiIT, Rising, 0,
+      IrqPriority::BUTTON},
      {PinId::CLI_TX, PortA, 2, Alternate, PullNone, PushPull, VeryHigh, ExtiNone, None, 7, 15},
      {PinId::CLI_RX, PortA, 3, Alternate, PullNone, PushPull, VeryHigh, ExtiNone, None, 7, 15},
      {PinId::LD_GRE, PortD, 12, Output, PullNone, PushPull, Low, ExtiNone, None, 0, 15},
@@ -24,6 +24,7 @@
 #include "pil_pin_config.hpp"
 #include "pil_pin_id.hpp"
 #include "gpio_config_stm32.hpp"
+#include "gpio_pin_stm32.hpp"
 #include <vector>
 #include <memory>
 #include <span>
@@ -35,6 +36,10 @@ class GpioManager : public IGPIOManager
   public:
     constexpr GpioManager() = default;
 
+    /** @brief Configure gpioPinConfigs from its precomputed gpioImage and bind its pins. */
+    void initialize();
+
+    /** @brief Configure t_configs pin by pin (tables not known at compile time). */
     void initialize(std::span<const PinConfig> t_configs);
 
     [[nodiscard]] IGPIOPin* getPin(PinId t_id) override;
@@ -54,6 +59,8 @@ class GpioManager : public IGPIOManager
     }
 
   private:
+    void bind(const PinConfig& t_config);
+
     std::array<GpioPin_STM32, PIN_CONFIG_ARRAY_SIZE>    m_pinPool{};
     std::array<IGPIOPin*, PIN_CONFIG_ARRAY_SIZE>        m_pinPtrs{};
     std::array<const PinConfig*, PIN_CONFIG_ARRAY_SIZE> m_configPtrs{};
@@ -0,0 +1,415 @@
+/**
+ ******************************************************************************
+ * @file        gpio_static_stm32.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       Compile-time GPIO register images, pin handles and pin groups generated
+ *              from gpioPinConfigs.
+ *
+ *              makeGpioImage() folds a pin configuration array into the final
+ *              register values: MODER, OTYPER, OSPEEDR, PUPDR and AFR[0..1] of
+ *              every port with the bits its pins own, the GPIO clock enables, and
+ *              the EXTI masks, edges and SYSCFG EXTICR routing of interrupt pins.
+ *              gpioApplyImage() (gpio_stm32.hpp) then writes each register once.
+ *              gpioImage is the image of gpioPinConfigs; building it also checks
+ *              the table: a port pin configured twice, or two interrupt pins on
+ *              the same EXTI line (one port per line), fail to compile.
+ *
+ *              StaticPin<PinId> takes its port and mask from the pin's entry in
+ *              gpioPinConfigs as constants, so each operation is one register
+ *              access on a literal address: set() and reset() are one BSRR write,
+ *              toggle() reads ODR once and writes BSRR once, read() reads IDR.
+ *              A BSRR write only changes the pins whose bits are set in it, so
+ *              interrupts may drive other pins of the same port concurrently
+ *              without a lock. Two contexts toggling the same pin still race.
+ *
+ *              PinGroup<TPorts, PinId...> drives several pins as one: the pins are
+ *              collapsed into a set/reset mask per port at compile time and each
+ *              port takes a single BSRR write, so the pins of one port change on
+ *              the same bus cycle and the ports follow each other back to back.
+ *              read() samples each IDR once and packs the levels in list order.
+ *
+ *              TPorts maps a port index to its register block: GpioPorts_STM32
+ *              on the target (see StaticPin_STM32 in gpio_stm32.hpp), a register
+ *              model in the host tests. The runtime IGPIOPin path of GpioManager
+ *              stays for pins chosen at run time.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef GPIO_STATIC_STM32_HPP
+#define GPIO_STATIC_STM32_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "gpio_config_stm32.hpp"
+
+inline constexpr std::uint8_t GPIO_PORT_COUNT_STM32 = 9; // GPIOA .. GPIOI
+inline constexpr std::uint8_t GPIO_EXTI_LINES_STM32 = 16;
+
+/**
+ * @brief Register values of one port. Only the fields of configured pins are
+ *        written: pins is their 1-bit mask, wide the 2-bit field mask (MODER,
+ *        OSPEEDR, PUPDR), afrMask the 4-bit fields of pins with an alternate function.
+ */
+struct GpioPortImage
+{
+    std::uint32_t                pins{0};
+    std::uint32_t                wide{0};
+    std::uint32_t                moder{0};
+    std::uint32_t                otyper{0};
+    std::uint32_t                ospeedr{0};
+    std::uint32_t                pupdr{0};
+    std::array<std::uint32_t, 2> afr{};
+    std::array<std::uint32_t, 2> afrMask{};
+};
+
+struct GpioExtiImage
+{
+    std::uint32_t                                   lines{0}; // Lines routed to a pin
+    std::uint32_t                                   imr{0};
+    std::uint32_t                                   emr{0};
+    std::uint32_t                                   rtsr{0};
+    std::uint32_t                                   ftsr{0};
+    std::array<std::uint32_t, 4>                    exticr{}; // SYSCFG EXTICR1..4
+    std::array<std::uint32_t, 4>                    exticrMask{};
+    std::array<std::uint8_t, GPIO_EXTI_LINES_STM32> priority{}; // NVIC, per line
+};
+
+struct GpioImage
+{
+    std::uint32_t                                    clocks{0}; // Bit n: port n, as in AHB1ENR
+    std::array<GpioPortImage, GPIO_PORT_COUNT_STM32> ports{};
+    GpioExtiImage                                    exti{};
+};
+
+/** @brief The pin is an EXTI interrupt or event source (gpioHalConfig's rule). */
+constexpr bool isExtiPin(const PinConfig& t_pin)
+{
+    return (t_pin.mode == PinConfig::Mode::Input) &&
+           (t_pin.iExti != PinConfig::InterruptExti::ExtiNone);
+}
+
+template <std::size_t N>
+constexpr bool gpioPinsInRange(const std::array<PinConfig, N>& t_configs)
+{
+    for (const PinConfig& pin : t_configs)
+    {
+        if ((pin.portIndex >= GPIO_PORT_COUNT_STM32) || (pin.pinNumber >= 16) ||
+            (pin.altFunction >= 16))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool gpioPinsDistinct(const std::array<PinConfig, N>& t_configs)
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t j = i + 1; j < N; ++j)
+        {
+            if ((t_configs[i].portIndex == t_configs[j].portIndex) &&
+                (t_configs[i].pinNumber == t_configs[j].pinNumber))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool gpioExtiLinesDistinct(const std::array<PinConfig, N>& t_configs)
+{
+    std::uint32_t lines = 0;
+    for (const PinConfig& pin : t_configs)
+    {
+        if (isExtiPin(pin))
+        {
+            const std::uint32_t line = 1U << pin.pinNumber;
+            if ((lines & line) != 0)
+            {
+                return false;
+            }
+            lines |= line;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+constexpr GpioImage makeGpioImage(const std::array<PinConfig, N>& t_configs)
+{
+    GpioImage image{};
+    for (const PinConfig& pin : t_configs)
+    {
+        GpioPortImage&      port  = image.ports[pin.portIndex];
+        const std::uint32_t n     = pin.pinNumber;
+        const std::uint32_t field = 2 * n;
+
+        image.clocks |= 1U << pin.portIndex;
+        port.pins    |= 1U << n;
+        port.wide    |= 3U << field;
+        port.moder   |= static_cast<std::uint32_t>(pin.mode) << field;
+        port.otyper  |= static_cast<std::uint32_t>(pin.type) << n;
+        port.ospeedr |= static_cast<std::uint32_t>(pin.speed) << field;
+        port.pupdr   |= static_cast<std::uint32_t>(pin.pull) << field;
+
+        // AF0 (SWD, MCO, ...) still owns its field: a reset or earlier value must be cleared
+        if (pin.mode == PinConfig::Mode::Alternate)
+        {
+            port.afr[n / 8]     |= pin.altFunction << (4 * (n % 8));
+            port.afrMask[n / 8] |= 0xFU << (4 * (n % 8));
+        }
+
+        if (isExtiPin(pin))
+        {
+            GpioExtiImage&      exti = image.exti;
+            const std::uint32_t line = 1U << n;
+            const bool rise = (pin.iTrigger == PinConfig::InterruptTrigger::Rising) ||
+                              (pin.iTrigger == PinConfig::InterruptTrigger::RisingFalling);
+            const bool fall = (pin.iTrigger == PinConfig::InterruptTrigger::Falling) ||
+                              (pin.iTrigger == PinConfig::InterruptTrigger::RisingFalling);
+
+            exti.lines             |= line;
+            exti.imr               |= (pin.iExti == PinConfig::InterruptExti::ExtiIT) ? line : 0U;
+            exti.emr               |= (pin.iExti == PinConfig::InterruptExti::ExtiEVT) ? line : 0U;
+            exti.rtsr              |= rise ? line : 0U;
+            exti.ftsr              |= fall ? line : 0U;
+            exti.exticr[n / 4]     |= std::uint32_t{pin.portIndex} << (4 * (n % 4));
+            exti.exticrMask[n / 4] |= 0xFU << (4 * (n % 4));
+            exti.priority[n]        = static_cast<std::uint8_t>(pin.iPriority);
+        }
+    }
+    return image;
+}
+
+static_assert(gpioPinsInRange(gpioPinConfigs), "gpioPinConfigs: port A..I, pin and AF 0..15");
+static_assert(gpioPinsDistinct(gpioPinConfigs), "gpioPinConfigs: a port pin is configured twice");
+static_assert(gpioExtiLinesDistinct(gpioPinConfigs),
+              "gpioPinConfigs: two interrupt pins share an EXTI line number");
+
+inline constexpr GpioImage gpioImage = makeGpioImage(gpioPinConfigs);
+
+template <PinId TId, class TPorts>
+class StaticPin
+{
+    static constexpr const PinConfig& CONFIG = getPinConfigIndexed(TId);
+
+    static_assert(CONFIG.id == TId, "gpioPinConfigs must list the pins in PinId order");
+    static_assert(CONFIG.portIndex < GPIO_PORT_COUNT_STM32, "No such GPIO port");
+    static_assert(CONFIG.pinNumber < 16, "GPIO pins are numbered 0..15");
+
+  public:
+    static constexpr std::uint8_t  PORT = CONFIG.portIndex;
+    static constexpr std::uint32_t MASK = 1U << CONFIG.pinNumber;
+
+    StaticPin() = delete;
+
+    static void set() { TPorts::port(PORT)->BSRR = MASK; }
+    static void reset() { TPorts::port(PORT)->BSRR = MASK << 16; }
+    static void write(bool t_high) { TPorts::port(PORT)->BSRR = t_high ? MASK : MASK << 16; }
+
+    static void toggle()
+    {
+        auto* const         port = TPorts::port(PORT);
+        const std::uint32_t odr  = port->ODR;
+
+        // Reset the pin if it is high, set it if it is low
+        port->BSRR = ((odr & MASK) << 16) | (~odr & MASK);
+    }
+
+    static bool read() { return (TPorts::port(PORT)->IDR & MASK) != 0; }
+};
+
+/**
+ * @brief Pins driven together; bit i of write() and read() is the i-th PinId of the list.
+ */
+template <class TPorts, PinId... TIds>
+class PinGroup
+{
+    static constexpr std::size_t COUNT = sizeof...(TIds);
+
+    static_assert((COUNT >= 1) && (COUNT <= 32), "1 to 32 pins, one bit each");
+
+    struct Pin
+    {
+        std::uint8_t port;
+        std::uint8_t number;
+    };
+
+    static constexpr std::array<Pin, COUNT> PINS{
+        Pin{StaticPin<TIds, TPorts>::PORT, getPinConfigIndexed(TIds).pinNumber}...};
+
+    static constexpr bool distinct()
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            for (std::size_t j = i + 1; j < COUNT; ++j)
+            {
+                if ((PINS[i].port == PINS[j].port) && (PINS[i].number == PINS[j].number))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static_assert(distinct(), "A pin is listed twice");
+
+    static constexpr std::size_t portCount()
+    {
+        std::size_t count = 0;
+        for (std::uint8_t port = 0; port < GPIO_PORT_COUNT_STM32; ++port)
+        {
+            for (const Pin& pin : PINS)
+            {
+                if (pin.port == port)
+                {
+                    ++count;
+                    break;
+                }
+            }
+        }
+        return count;
+    }
+
+    struct PortMask
+    {
+        std::uint8_t  port;
+        std::uint32_t mask;
+    };
+
+    static constexpr std::size_t PORTS = portCount();
+
+    static constexpr std::array<PortMask, PORTS> portMasks()
+    {
+        std::array<PortMask, PORTS> masks{};
+        std::size_t                 used = 0;
+        for (std::uint8_t port = 0; port < GPIO_PORT_COUNT_STM32; ++port)
+        {
+            std::uint32_t mask = 0;
+            for (const Pin& pin : PINS)
+            {
+                mask |= (pin.port == port) ? (1U << pin.number) : 0U;
+            }
+            if (mask != 0)
+            {
+                masks[used++] = {port, mask};
+            }
+        }
+        return masks;
+    }
+
+    static constexpr std::array<PortMask, PORTS> PORT_MASKS = portMasks();
+
+    // Index into PORT_MASKS of each pin's port
+    static constexpr std::array<std::size_t, COUNT> pinSlots()
+    {
+        std::array<std::size_t, COUNT> slots{};
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            while (PORT_MASKS[slots[i]].port != PINS[i].port)
+            {
+                ++slots[i];
+            }
+        }
+        return slots;
+    }
+
+    static constexpr std::array<std::size_t, COUNT> PIN_SLOTS = pinSlots();
+
+    // Port bits to set for t_bits on port slot TSlot: the rest of the slot's pins reset
+    template <std::size_t TSlot>
+    static std::uint32_t setBits(std::uint32_t t_bits)
+    {
+        // Unrolled over the pins so every shift and mask is a constant
+        return [t_bits]<std::size_t... TPins>(std::index_sequence<TPins...>)
+        {
+            return (((PINS[TPins].port == PORT_MASKS[TSlot].port)
+                         ? ((t_bits >> TPins) & 1U) << PINS[TPins].number
+                         : 0U) |
+                    ...);
+        }(std::make_index_sequence<COUNT>{});
+    }
+
+    template <std::size_t TSlot>
+    static void writeSlot(std::uint32_t t_bits)
+    {
+        const std::uint32_t set = setBits<TSlot>(t_bits);
+        TPorts::port(PORT_MASKS[TSlot].port)->BSRR = ((PORT_MASKS[TSlot].mask & ~set) << 16) | set;
+    }
+
+    template <std::size_t TSlot>
+    static void toggleSlot()
+    {
+        auto* const         port = TPorts::port(PORT_MASKS[TSlot].port);
+        const std::uint32_t odr  = port->ODR;
+        const std::uint32_t mask = PORT_MASKS[TSlot].mask;
+        port->BSRR               = ((odr & mask) << 16) | (~odr & mask);
+    }
+
+    template <typename TVisit>
+    static void forEachSlot(TVisit&& t_visit)
+    {
+        [&]<std::size_t... TSlots>(std::index_sequence<TSlots...>) {
+            (t_visit(std::integral_constant<std::size_t, TSlots>{}), ...);
+        }(std::make_index_sequence<PORTS>{});
+    }
+
+  public:
+    /** @brief BSRR writes per operation, one per port involved. */
+    static constexpr std::size_t WRITES = PORTS;
+
+    PinGroup() = delete;
+
+    static void set()
+    {
+        forEachSlot(
+            [](auto t_slot)
+            { TPorts::port(PORT_MASKS[t_slot].port)->BSRR = PORT_MASKS[t_slot].mask; });
+    }
+
+    static void reset()
+    {
+        forEachSlot(
+            [](auto t_slot)
+            { TPorts::port(PORT_MASKS[t_slot].port)->BSRR = PORT_MASKS[t_slot].mask << 16; });
+    }
+
+    /** @brief Pin i high if bit i of t_bits is set, low otherwise. */
+    static void write(std::uint32_t t_bits)
+    {
+        forEachSlot([t_bits](auto t_slot) { writeSlot<decltype(t_slot)::value>(t_bits); });
+    }
+
+    static void toggle()
+    {
+        forEachSlot([](auto t_slot) { toggleSlot<decltype(t_slot)::value>(); });
+    }
+
+    /** @brief Input levels, pin i in bit i. */
+    static std::uint32_t read()
+    {
+        std::array<std::uint32_t, PORTS> idr{};
+        forEachSlot([&idr](auto t_slot)
+                    { idr[t_slot] = TPorts::port(PORT_MASKS[t_slot].port)->IDR; });
+
+        std::uint32_t bits = 0;
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            bits |= ((idr[PIN_SLOTS[i]] >> PINS[i].number) & 1U) << i;
+        }
+        return bits;
+    }
+};
+
+#endif // GPIO_STATIC_STM32_HPP
@@ -25,6 +25,7 @@
 #include <cassert>
 #include "stm32f4xx_ll_gpio.h" // IWYU pragma: keep
 #include "pil_pin_config.hpp"
+#include "gpio_static_stm32.hpp"
 
 /**
  * @brief Configure a GPIO pin based on the provided PinConfig structure.
@@ -37,6 +38,15 @@
 */
 extern bool gpioHalConfig(const PinConfig& t_iodef);
 
+/**
+ * @brief Configure all pins of a precomputed image (see makeGpioImage), e.g. gpioImage.
+ * Enables the GPIO clocks in one write, gives each register of a used port one masked
+ * write (MODER last, so a pin changes mode already configured), then routes the EXTI
+ * lines through SYSCFG, sets their masks and edges and enables their NVIC lines.
+ * @param t_image The register image, normally a constexpr in flash.
+ */
+extern void gpioApplyImage(const GpioImage& t_image);
+
 /**
  * @brief Configure multiple GPIO pins based on a range of PinConfig structures.
  * This function iterates over the provided range and applies the configuration
@@ -121,4 +131,27 @@ constexpr std::array<GPIO_TypeDef*, 9> gpioPortsStm32 = {GPIOA, GPIOB, GPIOC, GP
     return t_index < gpioPortsStm32.size() ? gpioPortsStm32[t_index] : nullptr;
 }
 
+/**
+ * @brief Register blocks of the STM32F4 GPIO ports, for StaticPin.
+ * With the constant index of a StaticPin this folds to the port's base address.
+ */
+struct GpioPorts_STM32
+{
+    static GPIO_TypeDef* port(uint8_t t_index) { return gpioPortsStm32[t_index]; }
+};
+
+/**
+ * @brief Compile-time handle of a pin in gpioPinConfigs, e.g.
+ *        StaticPin_STM32<PinId::LD_GRE>::toggle().
+ */
+template <PinId TId>
+using StaticPin_STM32 = StaticPin<TId, GpioPorts_STM32>;
+
+/**
+ * @brief Pins of gpioPinConfigs switched together, one BSRR write per port, e.g.
+ *        PinGroup_STM32<PinId::LD_GRE, PinId::LD_RED>::write(0b01).
+ */
+template <PinId... TIds>
+using PinGroup_STM32 = PinGroup<GpioPorts_STM32, TIds...>;
+
 #endif // GPIO_STM32_HPP
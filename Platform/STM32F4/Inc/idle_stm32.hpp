@@ -0,0 +1,50 @@
+/**
+ * @file      Platform/STM32F4/Inc/idle_stm32.hpp
+ * @author    it32bit
+ * @brief     Idle policy for EventLoop: Sleep mode (WFI) unless an event is pending.
+ *
+ * @details   The pending check and the WFI run with PRIMASK set. An interrupt that fires
+ *            after the check still ends the WFI (a pending interrupt wakes the core even
+ *            when masked), so no post() can be missed between the check and the sleep.
+ *            The handler runs when PRIMASK is restored, before sleep() returns.
+ *
+ *            WFI rather than WFE: every event source here is an interrupt, and WFE would
+ *            also return on the event register left set by an earlier SEV or exception.
+ *            The App runs without the SysTick interrupt (its HAL tick reads the timebase),
+ *            so it wakes for device interrupts and programmed alarms, not every millisecond.
+ *
+ *            CYCCNT halts in Sleep mode; the timebase re-phases it before any interrupt
+ *            handler can read it.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef IDLE_STM32_HPP
+#define IDLE_STM32_HPP
+
+#include <atomic>
+#include <cstdint>
+#include "stm32f4xx.h"
+#include "timebase_stm32.hpp"
+
+struct IdleSleep_STM32
+{
+    static void sleep(const std::atomic<std::uint32_t>& t_pending)
+    {
+        const std::uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+
+        if (t_pending.load(std::memory_order_acquire) == 0)
+        {
+            __DSB();
+            __WFI();
+            timebase.resyncCycles();
+        }
+
+        __set_PRIMASK(primask);
+    }
+};
+
+#endif // IDLE_STM32_HPP
@@ -0,0 +1,57 @@
+/**
+ * @file      Platform/STM32F4/Inc/irq_priority_stm32.hpp
+ * @author    it32bit
+ * @brief     NVIC priority plan for every interrupt the firmware enables.
+ *
+ * @details   One table instead of a number in each driver, so the order can be read and
+ *            checked in one place. Lower values preempt higher ones; with the reset (and
+ *            HAL) priority grouping all four implemented bits are preemption bits.
+ *
+ *            CEILING splits the plan. A PriorityLock (priority_lock_stm32.hpp) sets
+ *            BASEPRI to it and so masks CEILING and everything less urgent, while the
+ *            interrupts above keep running during flash erases and other long sections.
+ *            Those handlers are therefore top halves only: they may touch lock-free state
+ *            (atomics, SPSC/MPSC queues, a post()) but never data a PriorityLock guards.
+ *
+ *            While the flash controller erases or programs, a fetch from flash stalls the
+ *            core; a handler above the ceiling is taken at once but makes progress only if
+ *            it runs from RAM. DMA streams keep moving data into SRAM either way.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef IRQ_PRIORITY_STM32_HPP
+#define IRQ_PRIORITY_STM32_HPP
+
+#include <cstdint>
+
+namespace IrqPriority
+{
+
+inline constexpr std::uint32_t LEVELS = 16; // __NVIC_PRIO_BITS = 4
+
+/* Above the ceiling: never masked by a PriorityLock */
+inline constexpr std::uint32_t TIMEBASE = 0; // TIM2 overflow and alarm: time must not slip
+inline constexpr std::uint32_t TIMER    = 1; // TIM3..TIM5 update and input capture (encoders)
+inline constexpr std::uint32_t DMA      = 2; // DMA streams, e.g. UART RX half/full
+inline constexpr std::uint32_t UART     = 3; // USART RX byte: read DR, post the bottom half
+
+/* Default BASEPRI ceiling of a PriorityLock */
+inline constexpr std::uint32_t CEILING = 4;
+
+/* At or below the ceiling: masked by a PriorityLock */
+inline constexpr std::uint32_t BUTTON   = 6;          // EXTI lines of the buttons
+inline constexpr std::uint32_t SOFT_IRQ = LEVELS - 1; // PendSV: bottom halves, task switch
+inline constexpr std::uint32_t KERNEL   = LEVELS - 1; // SysTick of the PilOs port
+
+static_assert((TIMEBASE < TIMER) && (TIMER < DMA) && (DMA < UART),
+              "Time-critical sources in urgency order");
+static_assert(UART < CEILING, "Time-critical sources stay above the lock ceiling");
+static_assert((CEILING > 0) && (CEILING <= BUTTON), "BASEPRI 0 would mask nothing");
+static_assert((BUTTON < SOFT_IRQ) && (SOFT_IRQ < LEVELS), "Bottom halves run last");
+
+} // namespace IrqPriority
+
+#endif // IRQ_PRIORITY_STM32_HPP
@@ -0,0 +1,114 @@
+/**
+ * @file      Platform/STM32F4/Inc/priority_lock_stm32.hpp
+ * @author    it32bit
+ * @brief     BASEPRI critical section with a priority ceiling and per-site timing.
+ *
+ * @details   PriorityLock<TCeiling> masks the interrupts of priority TCeiling and less
+ *            urgent (see irq_priority_stm32.hpp) instead of all of them as PRIMASK does.
+ *            It raises BASEPRI with BASEPRI_MAX, which never lowers it, so nested locks
+ *            and locks taken inside masked handlers keep the strictest ceiling; the
+ *            destructor restores the value it found.
+ *
+ *            Each lock names its LockSite, a static record of how often the section was
+ *            entered and its longest masked interval in DWT cycles (0 until the timebase
+ *            starts the cycle counter). LOCK_SITE("name") creates the record in place;
+ *            sites link themselves into one list on first use, for the console.
+ *
+ *            The ceiling only protects data against handlers at or below it: state shared
+ *            with a more urgent handler needs a lower TCeiling, or a lock-free design.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef PRIORITY_LOCK_STM32_HPP
+#define PRIORITY_LOCK_STM32_HPP
+
+#include <cstdint>
+#include "irq_priority_stm32.hpp"
+#include "stm32f4xx.h"
+
+struct LockSite
+{
+    const char*   name;
+    std::uint32_t entries{0};
+    std::uint32_t longest{0}; // Cycles with BASEPRI raised by this site
+    LockSite*     next{nullptr};
+    bool          registered{false};
+};
+
+namespace LockSites
+{
+
+inline LockSite* first{nullptr};
+
+inline void add(LockSite& t_site)
+{
+    const std::uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (!t_site.registered)
+    {
+        t_site.next       = first;
+        first             = &t_site;
+        t_site.registered = true;
+    }
+    __set_PRIMASK(primask);
+}
+
+inline void resetStats()
+{
+    for (LockSite* site = first; site != nullptr; site = site->next)
+    {
+        site->entries = 0;
+        site->longest = 0;
+    }
+}
+
+} // namespace LockSites
+
+// A static LockSite per expansion, constant-initialised so no guard variable is needed
+#define LOCK_SITE(t_name)                                                                          \
+    ([]() -> LockSite& {                                                                           \
+        static constinit LockSite site{t_name};                                                    \
+        return site;                                                                               \
+    }())
+
+template <std::uint32_t TCeiling = IrqPriority::CEILING>
+class PriorityLock
+{
+    static_assert((TCeiling > 0) && (TCeiling < IrqPriority::LEVELS),
+                  "BASEPRI 0 masks nothing, the ceiling must be 1..15");
+
+  public:
+    explicit PriorityLock(LockSite& t_site) : m_site(t_site), m_previous(__get_BASEPRI())
+    {
+        __set_BASEPRI_MAX(TCeiling << (8U - __NVIC_PRIO_BITS));
+        m_start = DWT->CYCCNT;
+    }
+
+    ~PriorityLock()
+    {
+        const std::uint32_t masked = DWT->CYCCNT - m_start;
+
+        // Still masked: the site's record is only written at or below the ceiling
+        m_site.entries++;
+        m_site.longest = (masked > m_site.longest) ? masked : m_site.longest;
+        if (!m_site.registered)
+        {
+            LockSites::add(m_site);
+        }
+
+        __set_BASEPRI(m_previous);
+    }
+
+    PriorityLock(const PriorityLock&)            = delete;
+    PriorityLock& operator=(const PriorityLock&) = delete;
+
+  private:
+    LockSite&     m_site;
+    std::uint32_t m_previous;
+    std::uint32_t m_start{0};
+};
+
+#endif // PRIORITY_LOCK_STM32_HPP
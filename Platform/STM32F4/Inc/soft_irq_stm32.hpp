@@ -0,0 +1,33 @@
+/**
+ * @file      Platform/STM32F4/Inc/soft_irq_stm32.hpp
+ * @author    it32bit
+ * @brief     Pend policy for SoftIrq: drain in PendSV at the lowest exception priority.
+ *
+ * @details   pend() is one store to ICSR. PendSV then runs when no other handler is
+ *            active, so every hardware interrupt preempts the bottom halves and none of
+ *            them waits on application work; several pends before it runs coalesce into
+ *            one drain. The application defines PendSV_Handler() to call drain().
+ *
+ *            Not for APP_RTOS builds: the PilOs port owns PendSV for its context switch
+ *            (see App/Inc/soft_irq_os.hpp).
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef SOFT_IRQ_STM32_HPP
+#define SOFT_IRQ_STM32_HPP
+
+#include "irq_priority_stm32.hpp"
+#include "stm32f4xx.h"
+
+struct SoftIrqPendSV_STM32
+{
+    /** @brief Give PendSV the lowest priority; before the first post(). */
+    static void initialize() { NVIC_SetPriority(PendSV_IRQn, IrqPriority::SOFT_IRQ); }
+
+    static void pend() { SCB->ICSR = SCB_ICSR_PENDSVSET_Msk; }
+};
+
+#endif // SOFT_IRQ_STM32_HPP
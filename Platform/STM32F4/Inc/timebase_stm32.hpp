@@ -0,0 +1,70 @@
+/**
+ ******************************************************************************
+ * @file        timebase_stm32.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       ITimebase on TIM2 (1 MHz, free-running 32-bit) and the DWT cycle counter.
+ *
+ *              TIM2 counts microseconds; its update interrupt counts the wraps
+ *              (every ~71.6 min) to extend the count to 64 bits. The DWT cycle
+ *              counter is started together with TIM2, so nowCycles() takes its high
+ *              part from the microseconds and its low 32 bits from CYCCNT.
+ *              There is one TIM2, so there is one instance: the global timebase.
+ *
+ *              TIM2 channel 1 compare is a one-shot alarm on the same count, for
+ *              tickless wake-ups (the App's software timers use it).
+ *
+ *              CYCCNT halts while the core sleeps (WFI), which shifts nowCycles()
+ *              against nowUs(). Whoever sleeps calls resyncCycles() on wake-up
+ *              (IdleSleep_STM32 does); CycleCounter intervals that span a sleep
+ *              or a resync are meaningless, so keep them to busy code.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef TIMEBASE_STM32_HPP
+#define TIMEBASE_STM32_HPP
+
+#include "pil_timebase.hpp"
+#include <stdint.h>
+
+using AlarmCallback = void (*)(void* t_context);
+
+class Timebase_STM32 : public ITimebase
+{
+  public:
+    /** @brief Start TIM2 and the cycle counter from zero; call after the clock setup. */
+    void initialize();
+
+    uint64_t nowUs() const override;
+    uint64_t nowCycles() const override;
+    uint32_t cyclesPerUs() const override { return m_cyclesPerUs; }
+
+    /** @brief Put CYCCNT back in phase with TIM2 (to 1 us) after it halted in a sleep. */
+    void resyncCycles();
+
+    /**
+     * @brief Call t_callback from the TIM2 interrupt (priority 0) at t_atUs, or at once if
+     *        that has passed; replaces a pending alarm. At most ~71 min ahead.
+     */
+    void setAlarm(uint64_t t_atUs, AlarmCallback t_callback, void* t_context);
+    void cancelAlarm();
+
+    /** @brief TIM2 update interrupt: the counter wrapped. */
+    void onOverflow() { m_overflows = m_overflows + 1; }
+
+    /** @brief TIM2 compare 1 interrupt: the alarm is due. */
+    void onAlarm();
+
+  private:
+    volatile uint32_t m_overflows{0};
+    uint32_t          m_cyclesPerUs{1};
+    AlarmCallback     m_alarmCallback{nullptr};
+    void*             m_alarmContext{nullptr};
+};
+
+extern Timebase_STM32 timebase;
+
+#endif // TIMEBASE_STM32_HPP
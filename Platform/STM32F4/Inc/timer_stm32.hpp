@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file        timer_stm32.hpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       ITimer on the STM32F4 general-purpose timers TIM3, TIM4 and TIM5.
+ *
+ *              TIM2 is taken by the timebase. TIM3/TIM4 are 16-bit, TIM5 is 32-bit;
+ *              all run from the APB1 timer clock, so periods are computed from
+ *              ACTIVE_CLOCK_PROFILE at compile time:
+ *
+ *                  constexpr TimerPeriod tick = Timer_STM32::period(TimerId::Tim3, 500000);
+ *                  static_assert(tick.valid);
+ *
+ *              Input capture moves the captured counter values with DMA1, binding a
+ *              stream of the channel's request at start; a channel without a DMA
+ *              request (TIM4 CH4) cannot capture.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#ifndef TIMER_STM32_HPP
+#define TIMER_STM32_HPP
+
+#include "pil_timer.hpp"
+#include "clock_profile_stm32.hpp"
+#include "dma_stm32.hpp"
+#include "irq_priority_stm32.hpp"
+#include <stdint.h>
+
+enum class TimerId : uint8_t
+{
+    Tim3 = 0,
+    Tim4,
+    Tim5
+};
+
+class Timer_STM32 : public ITimer
+{
+  public:
+    static constexpr uint32_t IRQ_PRIORITY = IrqPriority::TIMER;
+
+    static constexpr uint32_t maxReload(TimerId t_id)
+    {
+        return (t_id == TimerId::Tim5) ? 0xFFFFFFFFU : 0xFFFFU;
+    }
+
+    static constexpr uint32_t clockHz(TimerId) { return ACTIVE_CLOCK_PROFILE.apb1TimerHz(); }
+
+    static constexpr TimerPeriod period(TimerId t_id, uint32_t t_periodUs)
+    {
+        return TimerMath::fromMicroseconds(clockHz(t_id), t_periodUs, maxReload(t_id));
+    }
+
+    static constexpr TimerPeriod frequency(TimerId t_id, uint32_t t_frequencyHz)
+    {
+        return TimerMath::fromFrequency(clockHz(t_id), t_frequencyHz, maxReload(t_id));
+    }
+
+    explicit Timer_STM32(TimerId t_id);
+
+    bool startPeriodic(const TimerPeriod& t_period, TimerCallback t_callback,
+                       void* t_context) override;
+    bool startOneShot(const TimerPeriod& t_delay, TimerCallback t_callback,
+                      void* t_context) override;
+    bool startPwm(const TimerPeriod& t_period) override;
+    bool setDuty(TimerChannel t_channel, uint32_t t_compare) override;
+    bool startCapture(const TimerPeriod& t_tick, TimerChannel t_channel, CaptureEdge t_edge,
+                      uint32_t* t_buffer, size_t t_count, TimerCallback t_callback,
+                      void* t_context) override;
+    void stop() override;
+    bool isRunning() const override { return m_running; }
+
+    // Interrupt entry points
+    void onUpdate();
+    void onCaptureComplete(bool t_error);
+
+  private:
+    void configureCounter(uint32_t t_prescaler, uint32_t t_reload);
+    bool startCounting(const TimerPeriod& t_period, TimerCallback t_callback, void* t_context,
+                       bool t_oneShot);
+
+    TimerId         m_id;
+    TimerCallback   m_callback{nullptr};
+    void*           m_context{nullptr};
+    DmaStream_STM32 m_captureDma;
+    bool            m_capturing{false};
+    volatile bool   m_oneShot{false};
+    volatile bool   m_running{false};
+};
+
+#endif // TIMER_STM32_HPP
@@ -1,12 +1,17 @@
 /**
  * @file traits_stm32.hpp
  * @author it32bit
- * @brief GPIO Hardware Abstraction Layer traits for STM32 microcontrollers.
- *        Maps generic PIL interfaces to STM32-specific implementations,
+ * @brief Platform traits for STM32 microcontrollers.
+ *        Maps generic PIL bindings to STM32-specific drivers,
  *        enabling compile-time type resolution.
  *
+ *        PlatformWatchdog, PlatformAdc, PlatformClock and PlatformUart hold the driver
+ *        named here by value and call it without a vtable; host tests instantiate them
+ *        with traits naming fakes. The clock driver depends on the image: BOOT_PRIM
+ *        selects the HSI-only Clock_BootPrim, other images the PLL Clock_STM32F4.
+ *
  * @version 1.0
- * @date 2025-10-15
+ * @date 2026-10-18
  * @copyright Copyright (c) 2024–2025 it32bit
  * @license MIT License
  */
@@ -16,35 +21,45 @@
 #include "gpio_stm32.hpp"
 #include "gpio_pin_stm32.hpp"
 #include "gpio_manager_stm32.hpp"
+#include "watchdog_stm32.hpp"
+#include "adc_stm32.hpp"
+#include "uart_stm32.hpp"
+#ifdef BOOT_PRIM
+    #include "clock_boot_prim_stm32.hpp"
+#else
+    #include "clock_stm32.hpp"
+#endif
 
 struct STM32Traits
 {
     using PinType     = GpioPin_STM32;
     using ManagerType = GpioManager;
+    using Watchdog    = Watchdog_STM32;
+    using Adc         = Adc_STM32;
+    using Uart        = Uart_STM32;
+#ifdef BOOT_PRIM
+    using Clock = Clock_BootPrim;
+#else
+    using Clock = Clock_STM32F4;
+#endif
 
     // Provide a function to return port base from index
     static GPIO_TypeDef* portFromIndex(uint8_t idx) { return getPortStm32FromIndex(idx); }
-
-    // Provide other mappings needed (e.g. clock enable)
 };
 
 template <typename Traits>
 class PlatformGpio
 {
   public:
-    void init(std::span<const PinConfig> configs)
-    {
-        Traits::ManagerType manager;
-        manager.initialize(configs);
-    }
+    void init(std::span<const PinConfig> configs) { m_manager.initialize(configs); }
 
     typename Traits::PinType* getPin(PinId id)
     {
-        return static_cast<typename Traits::PinType*>(manager.getPin(id));
+        return static_cast<typename Traits::PinType*>(m_manager.getPin(id));
     }
 
   private:
-    typename Traits::ManagerType manager;
+    typename Traits::ManagerType m_manager;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -4,17 +4,26 @@
 #include <cstdint>
 #include <cstddef>
 #include "pil_uart.hpp"
+#include "pil_timebase.hpp"
 #include "flash_writer_stm32.hpp"
 
 class UartReceiver {
   public:
-    UartReceiver(IConsoleUart& uart, FlashWriterSTM32F4& writer);
+    // A transfer is abandoned when the host sends nothing for this long
+    static constexpr std::uint64_t BYTE_TIMEOUT_US = 3000000;
 
-    void receiveImage(std::uintptr_t flashDest, std::size_t imageSize);
+    UartReceiver(IConsoleUart& uart, FlashWriterSTM32F4& writer, const ITimebase& timebase);
+
+    // false: timed out, the destination holds a partial transfer
+    bool receiveImage(std::uintptr_t flashDest, std::size_t imageSize);
+    bool receiveBuffer(std::uint8_t* t_dest, std::size_t t_size);
 
   private:
+    bool readByte(std::uint8_t& t_byte);
+
     IConsoleUart& m_uart;
     FlashWriterSTM32F4& m_writer;
+    const ITimebase& m_timebase;
 };
 
 #endif // UART_RECEIVER_HPP
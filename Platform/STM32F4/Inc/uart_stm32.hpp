@@ -15,17 +15,28 @@
 #include "pil_uart.hpp"
 #include "stm32f4xx.h"
 
-
-
-
-class Uart_STM32 : public IConsoleUart
+// Final, so PlatformUart's calls bind directly and the TX loop inlines at the caller
+class Uart_STM32 final : public IConsoleUart
 {
   public:
     void init(UartId id, uint32_t baudrate) override;
     bool read(char& out) override;
-    void write(char c) override;
 
-    void write(const char* str);
+    void write(char c) override
+    {
+        while (!(m_usart->SR & USART_SR_TXE))
+        {
+        }
+        m_usart->DR = c;
+    }
+
+    void write(const char* str)
+    {
+        while (*str)
+        {
+            write(*str++);
+        }
+    }
 
   private:
     USART_TypeDef* m_usart = nullptr;
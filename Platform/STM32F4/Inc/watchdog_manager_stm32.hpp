@@ -3,13 +3,12 @@
  * @file        watchdog_manager.hpp
  * @author      it32bit
  * @version     1.0
- * @date        2025-10-17
- * @brief       High-level watchdog manager interface for STM32 platform.
+ * @date        2026-10-18
+ * @brief       High-level watchdog manager for STM32 platform.
  *
- *              Declares the WatchdogManager class, which encapsulates watchdog
- *              initialization and feeding logic. Internally constructs a platform-specific
- *              watchdog instance using placement new and exposes a uniform interface
- *              via the IWatchdog abstraction.
+ *              WatchdogManager is PlatformWatchdog bound to STM32Traits: it holds
+ *              a Watchdog_STM32 by value, so feed() compiles to the IWDG key store
+ *              at the call site.
  *
  * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
  *              (c) 2025 ha-ctrl project authors.
@@ -18,25 +17,9 @@
 #ifndef WATCHDOG_MANAGER_HPP
 #define WATCHDOG_MANAGER_HPP
 
-#include <stdint-gcc.h>
-#include <cstdint>
-#include <cstddef>
 #include "pil_watchdog.hpp"
+#include "traits_stm32.hpp"
 
-class WatchdogManager
-{
-public:
-    WatchdogManager();
-
-    void initialize(uint32_t timeout_ms);
-    void feed();
-
-private:
-    static constexpr std::size_t MaxWatchdogSize = sizeof(uint32_t) * 8; // enough for Watchdog_STM32
-    static constexpr std::size_t MaxWatchdogAlign = alignof(uint32_t);
-
-    alignas(MaxWatchdogAlign) std::byte m_storage[MaxWatchdogSize];
-    IWatchdog* m_watchdog = nullptr;
-};
+using WatchdogManager = PlatformWatchdog<STM32Traits>;
 
 #endif // WATCHDOG_MANAGER_HPP
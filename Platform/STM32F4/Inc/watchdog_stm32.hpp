@@ -6,9 +6,10 @@
  * @date        2025-10-17
  * @brief       Interface for STM32 Independent Watchdog (IWDG) driver.
  *
- *              Declares the Watchdog_STM32 class, which implements the IWatchdog
- *              interface and provides methods to configure and feed the IWDG peripheral.
- *              The watchdog timeout is calculated based on the LSI frequency and prescaler.
+ *              Declares the Watchdog_STM32 class, a WatchdogDriver that configures
+ *              and feeds the IWDG peripheral. The watchdog timeout is calculated based
+ *              on the LSI frequency and prescaler. feed() is defined here so that it
+ *              inlines to the single key-register store.
  *
  * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
  *              (c) 2025 ha-ctrl project authors.
@@ -17,18 +18,18 @@
 #ifndef WATCHDOG_STM32_HPP
 #define WATCHDOG_STM32_HPP
 
-#include "pil_watchdog.hpp"
 #include <stdint.h>
+#include "stm32f4xx_ll_iwdg.h"
 
-class Watchdog_STM32 : public IWatchdog
+class Watchdog_STM32
 {
   public:
-    explicit Watchdog_STM32(uint32_t t_timeout_ms);
-    void feed() override;
+    void start(uint32_t t_timeout_ms);
+    void feed() { LL_IWDG_ReloadCounter(IWDG); }
 
   private:
     void     waitReady();
-    uint32_t m_reload_value;
+    uint32_t m_reload_value{0};
 };
 
 #endif // WATCHDOG_STM32_HPP
@@ -1,8 +1,8 @@
 /**
- * @file      Platform/STM32F4/Src/adc_manager_stm32.cpp
+ * @file      Platform/STM32F4/Src/adc_stm32.cpp
  * @author    it32bit
- * @brief     Implements AdcManager for STM32F4 platform.
- *            Constructs Adc_STM32 in-place and delegates temperature reading via IAdc interface.
+ * @brief     Implements the STM32F4 ADC driver used by PlatformAdc.
+ *            Configures ADC1 and reads the internal temperature sensor via LL drivers.
  *
  * @version   1.0
  * @date      2025-10-19
@@ -0,0 +1,258 @@
+/**
+ ******************************************************************************
+ * @file        dma_stm32.cpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       IDmaChannel on the STM32F4 DMA1/DMA2 streams.
+ *
+ *              Registers only: the HAL DMA driver is not part of the build. All
+ *              sixteen stream interrupt handlers are defined here and forward to the
+ *              bound DmaStream_STM32.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#include "dma_stm32.hpp"
+#include "stm32f4xx.h"
+
+namespace
+{
+
+constexpr size_t STREAMS = 8;
+
+// Flags of stream n sit at these offsets of LISR/LIFCR (0-3) and HISR/HIFCR (4-7)
+constexpr uint8_t  FLAG_SHIFT[] = {0, 6, 16, 22};
+constexpr uint32_t FLAG_ALL     = 0x3DU;
+constexpr uint32_t FLAG_TC      = 0x20U;
+constexpr uint32_t FLAG_HT      = 0x10U;
+constexpr uint32_t FLAG_TE      = 0x08U;
+constexpr uint32_t FLAG_DME     = 0x04U;
+
+constexpr IRQn_Type STREAM_IRQS[2][STREAMS] = {
+    {DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+     DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn},
+    {DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+     DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn}};
+
+DmaStream_STM32* owners[2][STREAMS];
+
+DMA_TypeDef* controller(const DmaRoute& t_route)
+{
+    return (t_route.controller == 1) ? DMA1 : DMA2;
+}
+
+DMA_Stream_TypeDef* streamRegisters(const DmaRoute& t_route)
+{
+    const uintptr_t base = (t_route.controller == 1) ? DMA1_Stream0_BASE : DMA2_Stream0_BASE;
+    return reinterpret_cast<DMA_Stream_TypeDef*>(base + t_route.stream * 0x18U);
+}
+
+uint32_t readFlags(const DmaRoute& t_route)
+{
+    DMA_TypeDef*   dma    = controller(t_route);
+    const uint32_t status = (t_route.stream < 4) ? dma->LISR : dma->HISR;
+    return (status >> FLAG_SHIFT[t_route.stream % 4]) & FLAG_ALL;
+}
+
+void clearFlags(const DmaRoute& t_route, uint32_t t_flags)
+{
+    DMA_TypeDef*   dma  = controller(t_route);
+    const uint32_t mask = t_flags << FLAG_SHIFT[t_route.stream % 4];
+    if (t_route.stream < 4)
+    {
+        dma->LIFCR = mask;
+    }
+    else
+    {
+        dma->HIFCR = mask;
+    }
+}
+
+void dispatch(uint8_t t_controller, uint8_t t_stream)
+{
+    if (DmaStream_STM32* owner = owners[t_controller][t_stream]; owner != nullptr)
+    {
+        owner->onInterrupt();
+    }
+    else
+    {
+        clearFlags({static_cast<uint8_t>(t_controller + 1), t_stream, 0}, FLAG_ALL);
+    }
+}
+
+} // namespace
+
+bool DmaStream_STM32::bind(DmaRoute t_route)
+{
+    if (!t_route.valid() || (t_route.stream >= STREAMS))
+    {
+        return false;
+    }
+
+    DmaStream_STM32*& owner = owners[t_route.controller - 1][t_route.stream];
+    if ((owner != nullptr) && (owner != this))
+    {
+        return false;
+    }
+
+    release();
+    owner   = this;
+    m_route = t_route;
+    m_bound = true;
+    return true;
+}
+
+void DmaStream_STM32::release()
+{
+    if (m_bound)
+    {
+        stop();
+        owners[m_route.controller - 1][m_route.stream] = nullptr;
+        m_bound                                        = false;
+    }
+}
+
+bool DmaStream_STM32::start(const DmaTransfer& t_transfer)
+{
+    const bool memoryToMemory = (t_transfer.direction == DmaDirection::MemoryToMemory);
+    const bool doubleBuffer   = (t_transfer.memory1 != nullptr);
+
+    // Memory to memory is DMA2 only and can neither wrap nor switch buffers
+    if (!m_bound || isBusy() || (t_transfer.count == 0) ||
+        (memoryToMemory && ((m_route.controller != 2) || t_transfer.circular || doubleBuffer)))
+    {
+        return false;
+    }
+
+    RCC->AHB1ENR |= (m_route.controller == 1) ? RCC_AHB1ENR_DMA1EN : RCC_AHB1ENR_DMA2EN;
+    (void)RCC->AHB1ENR;
+
+    DMA_Stream_TypeDef* stream = streamRegisters(m_route);
+    const uint32_t      width  = static_cast<uint32_t>(t_transfer.width);
+
+    m_callback = t_transfer.callback;
+    m_context  = t_transfer.context;
+
+    clearFlags(m_route, FLAG_ALL);
+    stream->PAR  = reinterpret_cast<uint32_t>(t_transfer.peripheral);
+    stream->M0AR = reinterpret_cast<uint32_t>(t_transfer.memory);
+    stream->M1AR = reinterpret_cast<uint32_t>(t_transfer.memory1);
+    stream->NDTR = t_transfer.count;
+    stream->FCR  = memoryToMemory ? (DMA_SxFCR_DMDIS | DMA_SxFCR_FTH) : 0; // M2M needs the FIFO
+
+    uint32_t control = (static_cast<uint32_t>(m_route.channel) << DMA_SxCR_CHSEL_Pos) |
+                       (width << DMA_SxCR_MSIZE_Pos) | (width << DMA_SxCR_PSIZE_Pos) |
+                       DMA_SxCR_MINC | DMA_SxCR_TCIE | DMA_SxCR_TEIE | DMA_SxCR_DMEIE;
+
+    switch (t_transfer.direction)
+    {
+        case DmaDirection::PeripheralToMemory:
+            break;
+        case DmaDirection::MemoryToPeripheral:
+            control |= DMA_SxCR_DIR_0;
+            break;
+        case DmaDirection::MemoryToMemory:
+            control |= DMA_SxCR_DIR_1 | DMA_SxCR_PINC;
+            break;
+    }
+    if (t_transfer.circular || doubleBuffer)
+    {
+        control |= DMA_SxCR_CIRC;
+    }
+    if (doubleBuffer)
+    {
+        control |= DMA_SxCR_DBM;
+    }
+    if (t_transfer.halfComplete)
+    {
+        control |= DMA_SxCR_HTIE;
+    }
+
+    const IRQn_Type irq = STREAM_IRQS[m_route.controller - 1][m_route.stream];
+    NVIC_SetPriority(irq, IRQ_PRIORITY);
+    NVIC_EnableIRQ(irq);
+
+    stream->CR = control;
+    stream->CR = control | DMA_SxCR_EN;
+    return true;
+}
+
+void DmaStream_STM32::stop()
+{
+    if (!m_bound)
+    {
+        return;
+    }
+
+    DMA_Stream_TypeDef* stream = streamRegisters(m_route);
+    stream->CR &= ~(DMA_SxCR_EN | DMA_SxCR_TCIE | DMA_SxCR_HTIE | DMA_SxCR_TEIE | DMA_SxCR_DMEIE);
+    while ((stream->CR & DMA_SxCR_EN) != 0)
+    {
+        // The stream finishes the current item first
+    }
+    clearFlags(m_route, FLAG_ALL);
+}
+
+bool DmaStream_STM32::isBusy() const
+{
+    return m_bound && ((streamRegisters(m_route)->CR & DMA_SxCR_EN) != 0);
+}
+
+uint16_t DmaStream_STM32::remaining() const
+{
+    return m_bound ? static_cast<uint16_t>(streamRegisters(m_route)->NDTR) : 0;
+}
+
+uint8_t DmaStream_STM32::activeBuffer() const
+{
+    return (m_bound && ((streamRegisters(m_route)->CR & DMA_SxCR_CT) != 0)) ? 1 : 0;
+}
+
+void DmaStream_STM32::onInterrupt()
+{
+    const uint32_t flags = readFlags(m_route);
+    if (flags == 0)
+    {
+        return;
+    }
+    clearFlags(m_route, flags);
+
+    if (m_callback == nullptr)
+    {
+        return;
+    }
+    if ((flags & (FLAG_TE | FLAG_DME)) != 0)
+    {
+        m_callback(m_context, DmaEvent::Error);
+        return;
+    }
+    if ((flags & FLAG_HT) != 0)
+    {
+        m_callback(m_context, DmaEvent::HalfComplete);
+    }
+    if ((flags & FLAG_TC) != 0)
+    {
+        m_callback(m_context, DmaEvent::Complete);
+    }
+}
+
+// clang-format off
+extern "C" void DMA1_Stream0_IRQHandler(void) { dispatch(0, 0); }
+extern "C" void DMA1_Stream1_IRQHandler(void) { dispatch(0, 1); }
+extern "C" void DMA1_Stream2_IRQHandler(void) { dispatch(0, 2); }
+extern "C" void DMA1_Stream3_IRQHandler(void) { dispatch(0, 3); }
+extern "C" void DMA1_Stream4_IRQHandler(void) { dispatch(0, 4); }
+extern "C" void DMA1_Stream5_IRQHandler(void) { dispatch(0, 5); }
+extern "C" void DMA1_Stream6_IRQHandler(void) { dispatch(0, 6); }
+extern "C" void DMA1_Stream7_IRQHandler(void) { dispatch(0, 7); }
+extern "C" void DMA2_Stream0_IRQHandler(void) { dispatch(1, 0); }
+extern "C" void DMA2_Stream1_IRQHandler(void) { dispatch(1, 1); }
+extern "C" void DMA2_Stream2_IRQHandler(void) { dispatch(1, 2); }
+extern "C" void DMA2_Stream3_IRQHandler(void) { dispatch(1, 3); }
+extern "C" void DMA2_Stream4_IRQHandler(void) { dispatch(1, 4); }
+extern "C" void DMA2_Stream5_IRQHandler(void) { dispatch(1, 5); }
+extern "C" void DMA2_Stream6_IRQHandler(void) { dispatch(1, 6); }
+extern "C" void DMA2_Stream7_IRQHandler(void) { dispatch(1, 7); }
+// clang-format on
@@ -0,0 +1,147 @@
+/**
+ * @file      Platform/STM32F4/Src/fault_capture_stm32.cpp
+ * @author    it32bit
+ * @brief     Cortex-M4 fault capture into a .noinit RAM buffer.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#include "fault_capture_stm32.hpp"
+#include "shared_memory.hpp"
+#include "stm32f4xx.h"
+#include "stm32f4xx_hal.h"
+
+namespace
+{
+// Survives reset (never initialised by startup code); validated by magic + check word
+__attribute__((section(".noinit"))) Log::CrashRecord crashRecord;
+
+constexpr std::uintptr_t SRAM_START   = 0x20000000;
+constexpr std::uintptr_t SRAM_END     = 0x20020000;
+constexpr std::uintptr_t CCMRAM_START = 0x10000000;
+constexpr std::uintptr_t CCMRAM_END   = 0x10010000;
+
+constexpr std::size_t BASIC_FRAME_WORDS    = 8;
+constexpr std::size_t EXTENDED_FRAME_WORDS = 26; // + S0-S15, FPSCR, reserved
+
+std::uintptr_t regionEnd(std::uintptr_t t_address)
+{
+    if ((t_address >= SRAM_START) && (t_address < SRAM_END))
+    {
+        return SRAM_END;
+    }
+    if ((t_address >= CCMRAM_START) && (t_address < CCMRAM_END))
+    {
+        return CCMRAM_END;
+    }
+    return 0; // Not a RAM address, e.g. the stack overflowed out of RAM
+}
+
+} // namespace
+
+// Private stack for FaultCapture_Save: the faulting stack may be the reason we are here
+extern "C" __attribute__((section(".noinit"), used, aligned(8)))
+std::uint32_t faultCaptureStack[128];
+
+bool FaultCapture::hasPending()
+{
+    return (crashRecord.magic == Log::CRASH_MAGIC) &&
+           (crashRecord.check == Log::crashRecordCheck(crashRecord));
+}
+
+const Log::CrashRecord& FaultCapture::pending()
+{
+    return crashRecord;
+}
+
+void FaultCapture::clear()
+{
+    crashRecord.magic = 0;
+}
+
+extern "C" __attribute__((naked)) void FaultCapture_Entry(void)
+{
+    // EXC_RETURN bit 2 selects the stack the frame was pushed to. We never return,
+    // so MSP is moved to the private stack before any C++ code runs
+    __asm volatile("tst   lr, #4                      \n"
+                   "ite   eq                          \n"
+                   "mrseq r0, msp                     \n"
+                   "mrsne r0, psp                     \n"
+                   "mov   r1, lr                      \n"
+                   "ldr   r2, =faultCaptureStack + 512 \n"
+                   "msr   msp, r2                     \n"
+                   "b     FaultCapture_Save           \n");
+}
+
+extern "C" __attribute__((used)) void FaultCapture_Save(const std::uint32_t* t_frame,
+                                                        std::uint32_t        t_exc_return)
+{
+    Log::CrashRecord& record = crashRecord;
+
+    record.magic     = Log::CRASH_MAGIC;
+    record.exception = __get_IPSR() & IPSR_ISR_Msk;
+    record.excReturn = t_exc_return;
+
+    record.cfsr  = SCB->CFSR;
+    record.hfsr  = SCB->HFSR;
+    record.mmfar = SCB->MMFAR;
+    record.bfar  = SCB->BFAR;
+
+    record.uptimeMs         = HAL_GetTick();
+    record.signatureStatus  = static_cast<std::uint32_t>(Shared::bootProfile.signatureStatus);
+    record.signatureCheckUs = Shared::bootProfile.signatureCheckUs;
+
+    const auto     frame = reinterpret_cast<std::uintptr_t>(t_frame);
+    std::uintptr_t end   = regionEnd(frame);
+
+    if ((end != 0) && (frame + BASIC_FRAME_WORDS * sizeof(std::uint32_t) <= end))
+    {
+        record.r0   = t_frame[0];
+        record.r1   = t_frame[1];
+        record.r2   = t_frame[2];
+        record.r3   = t_frame[3];
+        record.r12  = t_frame[4];
+        record.lr   = t_frame[5];
+        record.pc   = t_frame[6];
+        record.xpsr = t_frame[7];
+
+        // Caller's SP: skip the frame (FP context when EXC_RETURN bit 4 is clear) and the
+        // alignment word the core inserts when xPSR bit 9 is set
+        std::size_t frameWords =
+            ((t_exc_return & (1U << 4)) == 0) ? EXTENDED_FRAME_WORDS : BASIC_FRAME_WORDS;
+        frameWords += ((record.xpsr & (1U << 9)) != 0) ? 1 : 0;
+        record.sp = frame + frameWords * sizeof(std::uint32_t);
+    }
+    else
+    {
+        record.r0 = record.r1 = record.r2 = record.r3 = record.r12 = 0;
+        record.lr = record.pc = record.xpsr = 0;
+        record.sp = frame;
+        end       = 0;
+    }
+
+    // Bounded copy of the caller's stack, clipped to the RAM region it lives in
+    std::size_t words = 0;
+    if (end > record.sp)
+    {
+        const auto* stack = reinterpret_cast<const std::uint32_t*>(record.sp);
+        while ((words < Log::CRASH_STACK_WORDS) &&
+               (record.sp + (words + 1) * sizeof(std::uint32_t) <= end))
+        {
+            record.stack[words] = stack[words];
+            ++words;
+        }
+    }
+    record.stackWords = words;
+    for (; words < Log::CRASH_STACK_WORDS; ++words)
+    {
+        record.stack[words] = 0;
+    }
+
+    record.check = Log::crashRecordCheck(record);
+
+    __DSB();
+    NVIC_SystemReset();
+}
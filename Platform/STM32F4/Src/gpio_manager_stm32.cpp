@@ -16,6 +16,19 @@
 #include "gpio_manager_stm32.hpp"
 #include "gpio_stm32.hpp"
 
+void GpioManager::initialize()
+{
+    reset();
+
+    // gpioImage was checked when it was built: every entry is valid
+    gpioApplyImage(gpioImage);
+
+    for (const auto& cfg : gpioPinConfigs)
+    {
+        bind(cfg);
+    }
+}
+
 void GpioManager::initialize(std::span<const PinConfig> t_configs)
 {
     reset();
@@ -37,14 +50,21 @@ void GpioManager::initialize(std::span<const PinConfig> t_configs)
         if (!gpioHalConfig(cfg))
             continue;
 
-        m_pinPool[idx]    = GpioPin_STM32(port, cfg.pinNumber);
-        m_pinPtrs[idx]    = &m_pinPool[idx];
-        m_configPtrs[idx] = &cfg;
-
-        ++m_pinCount;
+        bind(cfg);
     }
 }
 
+void GpioManager::bind(const PinConfig& t_config)
+{
+    auto idx = static_cast<std::size_t>(t_config.id);
+
+    m_pinPool[idx]    = GpioPin_STM32(getPortStm32FromIndex(t_config.portIndex), t_config.pinNumber);
+    m_pinPtrs[idx]    = &m_pinPool[idx];
+    m_configPtrs[idx] = &t_config;
+
+    ++m_pinCount;
+}
+
 IGPIOPin* GpioManager::getPin(PinId id)
 {
     auto idx = static_cast<std::size_t>(id);
@@ -20,7 +20,9 @@
 
 void GpioPin_STM32::toggle()
 {
-    LL_GPIO_TogglePin(m_port, m_pin_mask);
+    // One BSRR write instead of an ODR read-modify-write: other pins are never touched
+    const uint32_t odr = LL_GPIO_ReadOutputPort(m_port);
+    m_port->BSRR       = ((odr & m_pin_mask) << 16U) | (~odr & m_pin_mask);
 }
 
 void GpioPin_STM32::set()
@@ -12,6 +12,8 @@
  *
  * @note        - Designed for compile-time configuration via PinConfig
  *              - Supports EXTI interrupt setup with priority mapping
+ *              - gpioApplyImage() writes a compile-time image of a whole table,
+ *                one masked write per register per port
  *              - Assumes peripheral clocks are enabled as needed
  *
  * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
@@ -24,8 +26,9 @@
 #include "gpio_stm32.hpp"
 #include "pil_pin_config.hpp"
 
-static bool clockEnable(const GPIO_TypeDef* port);
+static void clockEnable(uint8_t t_portIndex);
 static bool gpioHalConfigInterrupt(const PinConfig& t_iodef);
+static void writeMasked(volatile uint32_t& t_register, uint32_t t_mask, uint32_t t_value);
 
 // clang-format off
 inline IRQn_Type exti_IRQ_0(void){ return EXTI0_IRQn; }
@@ -63,17 +66,14 @@ bool gpioHalConfig(const PinConfig& t_iodef)
     }
 
     // Enable clock for the port
-    if (clockEnable(port) == false)
-    {
-        return false;
-    }
+    clockEnable(t_iodef.portIndex);
 
     LL_GPIO_SetPinSpeed(port, getGpioPinMask(t_iodef.pinNumber), t_iodef.speed);
     LL_GPIO_SetPinOutputType(port, getGpioPinMask(t_iodef.pinNumber), t_iodef.type);
     LL_GPIO_SetPinPull(port, getGpioPinMask(t_iodef.pinNumber), t_iodef.pull);
     LL_GPIO_SetPinMode(port, getGpioPinMask(t_iodef.pinNumber), t_iodef.mode);
 
-    if ((t_iodef.mode == PinConfig::Mode::Alternate) && (t_iodef.altFunction != 0))
+    if (t_iodef.mode == PinConfig::Mode::Alternate) // AF0 is a valid function too
     {
         if (t_iodef.pinNumber < CONST_AFP_PIN_0_7_IS_LOWER)
         {
@@ -102,6 +102,69 @@ bool gpioHalConfig(const PinConfig& t_iodef)
     return true;
 }
 
+void gpioApplyImage(const GpioImage& t_image)
+{
+    RCC->AHB1ENR |= t_image.clocks;
+    (void)RCC->AHB1ENR; // Read back: the clocks run before the first port access
+
+    for (uint8_t index = 0; index < GPIO_PORT_COUNT_STM32; ++index)
+    {
+        const GpioPortImage& image = t_image.ports[index];
+        if (image.pins == 0)
+        {
+            continue;
+        }
+
+        GPIO_TypeDef* port = gpioPortsStm32[index];
+        writeMasked(port->OSPEEDR, image.wide, image.ospeedr);
+        writeMasked(port->OTYPER, image.pins, image.otyper);
+        writeMasked(port->PUPDR, image.wide, image.pupdr);
+        for (std::size_t half = 0; half < image.afr.size(); ++half)
+        {
+            if (image.afrMask[half] != 0)
+            {
+                writeMasked(port->AFR[half], image.afrMask[half], image.afr[half]);
+            }
+        }
+        writeMasked(port->MODER, image.wide, image.moder);
+    }
+
+    const GpioExtiImage& exti = t_image.exti;
+    if (exti.lines == 0)
+    {
+        return;
+    }
+
+    __HAL_RCC_SYSCFG_CLK_ENABLE(); // NOLINT
+    for (std::size_t reg = 0; reg < exti.exticr.size(); ++reg)
+    {
+        if (exti.exticrMask[reg] != 0)
+        {
+            writeMasked(SYSCFG->EXTICR[reg], exti.exticrMask[reg], exti.exticr[reg]); // NOLINT
+        }
+    }
+    writeMasked(EXTI->IMR, exti.lines, exti.imr);   // NOLINT
+    writeMasked(EXTI->EMR, exti.lines, exti.emr);   // NOLINT
+    writeMasked(EXTI->RTSR, exti.lines, exti.rtsr); // NOLINT
+    writeMasked(EXTI->FTSR, exti.lines, exti.ftsr); // NOLINT
+
+    for (std::size_t line = 0; line < GPIO_EXTI_LINES_STM32; ++line)
+    {
+        if ((exti.lines & (1U << line)) != 0)
+        {
+            auto irq = getExtiIrqFromPin[line]();
+            NVIC_ClearPendingIRQ(irq);
+            NVIC_SetPriority(irq, exti.priority[line]);
+            NVIC_EnableIRQ(irq);
+        }
+    }
+}
+
+static void writeMasked(volatile uint32_t& t_register, uint32_t t_mask, uint32_t t_value)
+{
+    t_register = (t_register & ~t_mask) | t_value;
+}
+
 /**
  * @brief Configures external interrupt for a given GPIO pin.
  *
@@ -166,51 +229,10 @@ static bool gpioHalConfigInterrupt(const PinConfig& t_iodef)
 /**
  * @brief Perypheral GPIO Clock Enable
  *
- * @note NOLINT: warning: avoid integer to pointer casts [performance-no-int-to-ptr]
+ * @note  GPIOAEN .. GPIOIEN are AHB1ENR bits 0 .. 8, in port index order.
  */
-// NOLINTNEXTLINE clang-tidyreadability-function-cognitive-complexity
-static bool clockEnable(const GPIO_TypeDef* port)
+static void clockEnable(uint8_t t_portIndex)
 {
-    if (port == GPIOA) // NOLINT
-    {
-        __HAL_RCC_GPIOA_CLK_ENABLE(); // NOLINT
-    }
-    else if (port == GPIOB) // NOLINT
-    {
-        __HAL_RCC_GPIOB_CLK_ENABLE(); // NOLINT
-    }
-    else if (port == GPIOC) // NOLINT
-    {
-        __HAL_RCC_GPIOC_CLK_ENABLE(); // NOLINT
-    }
-    else if (port == GPIOD) // NOLINT
-    {
-        __HAL_RCC_GPIOD_CLK_ENABLE(); // NOLINT
-    }
-    else if (port == GPIOE) // NOLINT
-    {
-        __HAL_RCC_GPIOE_CLK_ENABLE(); // NOLINT
-    }
-    else if (port == GPIOF) // NOLINT
-    {
-        __HAL_RCC_GPIOF_CLK_ENABLE(); // NOLINT
-    }
-    else if (port == GPIOG) // NOLINT
-    {
-        __HAL_RCC_GPIOG_CLK_ENABLE(); // NOLINT
-    }
-    else if (port == GPIOH) // NOLINT
-    {
-        __HAL_RCC_GPIOH_CLK_ENABLE(); // NOLINT
-    }
-    else if (port == GPIOI) // NOLINT
-    {
-        __HAL_RCC_GPIOI_CLK_ENABLE(); // NOLINT
-    }
-    else
-    {
-        return false;
-    }
-
-    return true;
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN << t_portIndex; // NOLINT
+    (void)RCC->AHB1ENR;                                // Read back, as __HAL_RCC_GPIOx_CLK_ENABLE
 }
@@ -0,0 +1,132 @@
+/**
+ ******************************************************************************
+ * @file        timebase_stm32.cpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       ITimebase on TIM2 (1 MHz, free-running 32-bit) and the DWT cycle counter.
+ *
+ *              Registers only: the HAL TIM driver is not part of the build. The
+ *              TIM2 interrupt handler lives here rather than in stm32f4xx_it.c
+ *              because the boot stages use the timebase too and do not compile it.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#include "timebase_stm32.hpp"
+#include "irq_priority_stm32.hpp"
+#include "stm32f4xx.h"
+#include "stm32f4xx_hal.h"
+
+Timebase_STM32 timebase;
+
+void Timebase_STM32::initialize()
+{
+    m_cyclesPerUs = SystemCoreClock / 1000000U;
+
+    // APB1 timers run at twice PCLK1 whenever the APB1 prescaler divides
+    uint32_t timerClock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+    {
+        timerClock *= 2;
+    }
+
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+    (void)RCC->APB1ENR;
+    RCC->APB1RSTR |= RCC_APB1RSTR_TIM2RST;
+    RCC->APB1RSTR &= ~RCC_APB1RSTR_TIM2RST;
+
+    TIM2->PSC  = (timerClock / 1000000U) - 1;
+    TIM2->ARR  = 0xFFFFFFFFU;
+    TIM2->EGR  = TIM_EGR_UG; // Load the prescaler, CNT = 0
+    TIM2->SR   = 0;
+    TIM2->DIER = TIM_DIER_UIE;
+    m_overflows = 0;
+
+    NVIC_SetPriority(TIM2_IRQn, IrqPriority::TIMEBASE);
+    NVIC_EnableIRQ(TIM2_IRQn);
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // Back to back, so the cycle count stays in phase with the microseconds
+    DWT->CYCCNT = 0;
+    TIM2->CR1   = TIM_CR1_CEN;
+}
+
+uint64_t Timebase_STM32::nowUs() const
+{
+    for (;;)
+    {
+        const uint32_t high    = m_overflows;
+        const uint32_t low     = TIM2->CNT;
+        const bool     pending = (TIM2->SR & TIM_SR_UIF) != 0;
+
+        // Retry if the interrupt ran between the reads
+        if (high == m_overflows)
+        {
+            return TimebaseMath::extend(high, low, pending);
+        }
+    }
+}
+
+uint64_t Timebase_STM32::nowCycles() const
+{
+    const uint32_t cycles = DWT->CYCCNT;
+    return TimebaseMath::cyclesFromUs(nowUs(), m_cyclesPerUs, cycles);
+}
+
+void Timebase_STM32::resyncCycles()
+{
+    DWT->CYCCNT = static_cast<uint32_t>(nowUs() * m_cyclesPerUs);
+}
+
+void Timebase_STM32::setAlarm(uint64_t t_atUs, AlarmCallback t_callback, void* t_context)
+{
+    TIM2->DIER &= ~TIM_DIER_CC1IE;
+    m_alarmCallback = t_callback;
+    m_alarmContext  = t_context;
+
+    TIM2->CCR1 = static_cast<uint32_t>(t_atUs); // Output compare, frozen: flag only
+    TIM2->SR   = ~TIM_SR_CC1IF;
+    TIM2->DIER |= TIM_DIER_CC1IE;
+
+    // The count may have passed CCR1 before it was written
+    if (nowUs() >= t_atUs)
+    {
+        TIM2->EGR = TIM_EGR_CC1G;
+    }
+}
+
+void Timebase_STM32::cancelAlarm()
+{
+    TIM2->DIER &= ~TIM_DIER_CC1IE;
+    TIM2->SR = ~TIM_SR_CC1IF;
+}
+
+void Timebase_STM32::onAlarm()
+{
+    TIM2->DIER &= ~TIM_DIER_CC1IE; // One shot
+
+    if (m_alarmCallback != nullptr)
+    {
+        m_alarmCallback(m_alarmContext);
+    }
+}
+
+extern "C" void TIM2_IRQHandler(void)
+{
+    const uint32_t status = TIM2->SR;
+
+    if ((status & TIM_SR_UIF) != 0)
+    {
+        TIM2->SR = ~TIM_SR_UIF;
+        timebase.onOverflow();
+    }
+    if (((status & TIM_SR_CC1IF) != 0) && ((TIM2->DIER & TIM_DIER_CC1IE) != 0))
+    {
+        TIM2->SR = ~TIM_SR_CC1IF;
+        timebase.onAlarm();
+    }
+}
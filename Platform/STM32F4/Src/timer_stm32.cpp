@@ -0,0 +1,292 @@
+/**
+ ******************************************************************************
+ * @file        timer_stm32.cpp
+ * @author      it32bit
+ * @version     1.0
+ * @date        2026-10-18
+ * @brief       ITimer on the STM32F4 general-purpose timers TIM3, TIM4 and TIM5.
+ *
+ *              Registers only, like the timebase: the HAL TIM/DMA drivers are not
+ *              part of the build. The timer interrupt handlers are defined here and
+ *              dispatch to the Timer_STM32 that owns them; capture completes through
+ *              the DMA service.
+ *
+ * @attention   This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *              (c) 2025 ha-ctrl project authors.
+ ******************************************************************************
+ */
+#include "timer_stm32.hpp"
+#include <iterator>
+#include "stm32f4xx.h"
+
+namespace
+{
+
+struct TimerHw
+{
+    uintptr_t  base;
+    uint32_t   rccEnable;
+    IRQn_Type  irq;
+    DmaRequest capture[4];
+    bool       hasCapture[4]; // TIM4 CH4 has no DMA request
+};
+
+constexpr TimerHw TIMERS[] = {
+    {TIM3_BASE,
+     RCC_APB1ENR_TIM3EN,
+     TIM3_IRQn,
+     {DmaRequest::Tim3Ch1, DmaRequest::Tim3Ch2, DmaRequest::Tim3Ch3, DmaRequest::Tim3Ch4},
+     {true, true, true, true}},
+    {TIM4_BASE,
+     RCC_APB1ENR_TIM4EN,
+     TIM4_IRQn,
+     {DmaRequest::Tim4Ch1, DmaRequest::Tim4Ch2, DmaRequest::Tim4Ch3, DmaRequest::Tim4Ch3},
+     {true, true, true, false}},
+    {TIM5_BASE,
+     RCC_APB1ENR_TIM5EN,
+     TIM5_IRQn,
+     {DmaRequest::Tim5Ch1, DmaRequest::Tim5Ch2, DmaRequest::Tim5Ch3, DmaRequest::Tim5Ch4},
+     {true, true, true, true}},
+};
+
+constexpr uint32_t CCMR_PWM_MODE1 = (6U << 4) | (1U << 3); // OCxM = 110, OCxPE
+constexpr uint32_t CCMR_INPUT_TI  = 1U;                    // CCxS = 01, ICx on TIx
+constexpr uint32_t CCER_ENABLE    = 1U << 0;
+constexpr uint32_t CCER_FALLING   = 1U << 1;
+constexpr uint32_t CCER_BOTH      = (1U << 1) | (1U << 3);
+
+Timer_STM32* timerOwners[std::size(TIMERS)];
+
+const TimerHw& hardware(TimerId t_id)
+{
+    return TIMERS[static_cast<uint8_t>(t_id)];
+}
+
+TIM_TypeDef* registers(TimerId t_id)
+{
+    return reinterpret_cast<TIM_TypeDef*>(hardware(t_id).base);
+}
+
+// Mode field of channel t_index in CCMR1 (CH1, CH2) or CCMR2 (CH3, CH4)
+void setChannelMode(TIM_TypeDef* t_tim, uint32_t t_index, uint32_t t_mode)
+{
+    volatile uint32_t& ccmr  = (t_index < 2) ? t_tim->CCMR1 : t_tim->CCMR2;
+    const uint32_t     shift = (t_index % 2) * 8;
+    ccmr = (ccmr & ~(0xFFU << shift)) | (t_mode << shift);
+}
+
+void captureDone(void* t_timer, DmaEvent t_event)
+{
+    static_cast<Timer_STM32*>(t_timer)->onCaptureComplete(t_event == DmaEvent::Error);
+}
+
+void dispatchTimer(TimerId t_id)
+{
+    TIM_TypeDef* tim = registers(t_id);
+    if ((tim->SR & TIM_SR_UIF) != 0)
+    {
+        tim->SR = ~TIM_SR_UIF;
+        if (Timer_STM32* owner = timerOwners[static_cast<uint8_t>(t_id)]; owner != nullptr)
+        {
+            owner->onUpdate();
+        }
+    }
+}
+
+} // namespace
+
+Timer_STM32::Timer_STM32(TimerId t_id) : m_id(t_id)
+{
+    timerOwners[static_cast<uint8_t>(t_id)] = this;
+}
+
+void Timer_STM32::configureCounter(uint32_t t_prescaler, uint32_t t_reload)
+{
+    TIM_TypeDef* tim = registers(m_id);
+
+    RCC->APB1ENR |= hardware(m_id).rccEnable;
+    (void)RCC->APB1ENR;
+
+    tim->CR1  = 0;
+    tim->DIER = 0;
+    tim->CCER = 0;
+    tim->PSC  = t_prescaler;
+    tim->ARR  = t_reload;
+    tim->EGR  = TIM_EGR_UG; // Load PSC/ARR now, CNT = 0
+    tim->SR   = 0;
+}
+
+bool Timer_STM32::startCounting(const TimerPeriod& t_period, TimerCallback t_callback,
+                                void* t_context, bool t_oneShot)
+{
+    if (!t_period.valid || (t_period.reload > maxReload(m_id)))
+    {
+        return false;
+    }
+
+    stop();
+    configureCounter(t_period.prescaler, t_period.reload);
+
+    m_callback = t_callback;
+    m_context  = t_context;
+    m_oneShot  = t_oneShot;
+    m_running  = true;
+
+    TIM_TypeDef* tim = registers(m_id);
+    tim->DIER        = TIM_DIER_UIE;
+    NVIC_SetPriority(hardware(m_id).irq, IRQ_PRIORITY);
+    NVIC_EnableIRQ(hardware(m_id).irq);
+    tim->CR1 = t_oneShot ? (TIM_CR1_OPM | TIM_CR1_CEN) : TIM_CR1_CEN;
+    return true;
+}
+
+bool Timer_STM32::startPeriodic(const TimerPeriod& t_period, TimerCallback t_callback,
+                                void* t_context)
+{
+    return startCounting(t_period, t_callback, t_context, false);
+}
+
+bool Timer_STM32::startOneShot(const TimerPeriod& t_delay, TimerCallback t_callback,
+                               void* t_context)
+{
+    return startCounting(t_delay, t_callback, t_context, true);
+}
+
+bool Timer_STM32::startPwm(const TimerPeriod& t_period)
+{
+    if (!t_period.valid || (t_period.reload > maxReload(m_id)))
+    {
+        return false;
+    }
+
+    stop();
+    configureCounter(t_period.prescaler, t_period.reload);
+    m_running = true;
+
+    // Buffered reload: a new period or duty takes effect at the next update, no glitch
+    registers(m_id)->CR1 = TIM_CR1_ARPE | TIM_CR1_CEN;
+    return true;
+}
+
+bool Timer_STM32::setDuty(TimerChannel t_channel, uint32_t t_compare)
+{
+    TIM_TypeDef*   tim   = registers(m_id);
+    const uint32_t index = static_cast<uint32_t>(t_channel);
+
+    if (!m_running || m_capturing)
+    {
+        return false;
+    }
+
+    (&tim->CCR1)[index] = t_compare;
+    if ((tim->CCER & (CCER_ENABLE << (4 * index))) == 0)
+    {
+        setChannelMode(tim, index, CCMR_PWM_MODE1);
+        tim->CCER |= CCER_ENABLE << (4 * index);
+    }
+    return true;
+}
+
+bool Timer_STM32::startCapture(const TimerPeriod& t_tick, TimerChannel t_channel,
+                               CaptureEdge t_edge, uint32_t* t_buffer, size_t t_count,
+                               TimerCallback t_callback, void* t_context)
+{
+    const TimerHw& hw    = hardware(m_id);
+    const uint32_t index = static_cast<uint32_t>(t_channel);
+
+    if (!t_tick.valid || !hw.hasCapture[index] || (t_buffer == nullptr) || (t_count == 0) ||
+        (t_count > 0xFFFFU))
+    {
+        return false;
+    }
+
+    stop();
+
+    // First stream of the request that nobody else holds
+    const DmaRoutes routes = dmaRoutes(hw.capture[index]);
+    bool            bound  = false;
+    for (size_t i = 0; (i < routes.count) && !bound; ++i)
+    {
+        bound = m_captureDma.bind(routes.options[i]);
+    }
+    if (!bound)
+    {
+        return false;
+    }
+
+    configureCounter(t_tick.prescaler, maxReload(m_id));
+
+    TIM_TypeDef* tim = registers(m_id);
+    setChannelMode(tim, index, CCMR_INPUT_TI);
+    const uint32_t polarity = (t_edge == CaptureEdge::Rising)    ? 0U
+                              : (t_edge == CaptureEdge::Falling) ? CCER_FALLING
+                                                                 : CCER_BOTH;
+    tim->CCER = (CCER_ENABLE | polarity) << (4 * index);
+
+    m_callback  = t_callback;
+    m_context   = t_context;
+    m_capturing = true;
+    m_running   = true;
+
+    const DmaTransfer transfer = DmaTransfer::fromPeripheral(
+        &tim->CCR1 + index, t_buffer, static_cast<uint16_t>(t_count), &captureDone, this);
+    if (!m_captureDma.start(transfer))
+    {
+        stop();
+        return false;
+    }
+
+    tim->DIER = TIM_DIER_CC1DE << index;
+    tim->CR1  = TIM_CR1_CEN;
+    return true;
+}
+
+void Timer_STM32::stop()
+{
+    TIM_TypeDef* tim = registers(m_id);
+    tim->CR1 &= ~TIM_CR1_CEN;
+    tim->DIER = 0;
+
+    if (m_capturing)
+    {
+        m_captureDma.release();
+        m_capturing = false;
+    }
+    m_running = false;
+}
+
+void Timer_STM32::onUpdate()
+{
+    if (m_oneShot)
+    {
+        m_running = false; // OPM has already stopped the counter
+    }
+    if (m_callback != nullptr)
+    {
+        m_callback(m_context);
+    }
+}
+
+void Timer_STM32::onCaptureComplete(bool t_error)
+{
+    stop();
+    if (!t_error && (m_callback != nullptr))
+    {
+        m_callback(m_context);
+    }
+}
+
+extern "C" void TIM3_IRQHandler(void)
+{
+    dispatchTimer(TimerId::Tim3);
+}
+
+extern "C" void TIM4_IRQHandler(void)
+{
+    dispatchTimer(TimerId::Tim4);
+}
+
+extern "C" void TIM5_IRQHandler(void)
+{
+    dispatchTimer(TimerId::Tim5);
+}
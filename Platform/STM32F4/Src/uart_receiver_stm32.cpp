@@ -1,11 +1,28 @@
 #include "uart_receiver_stm32.hpp"
 
-UartReceiver::UartReceiver(IConsoleUart& uart, FlashWriterSTM32F4& writer)
-    : m_uart(uart), m_writer(writer)
+UartReceiver::UartReceiver(IConsoleUart& uart, FlashWriterSTM32F4& writer,
+                           const ITimebase& timebase)
+    : m_uart(uart), m_writer(writer), m_timebase(timebase)
 {
 }
 
-void UartReceiver::receiveImage(std::uintptr_t flashDest, std::size_t imageSize)
+bool UartReceiver::readByte(std::uint8_t& t_byte)
+{
+    const Deadline timeout(m_timebase, BYTE_TIMEOUT_US);
+
+    while (!timeout.expired())
+    {
+        char byte;
+        if (m_uart.read(byte))
+        {
+            t_byte = static_cast<std::uint8_t>(byte);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool UartReceiver::receiveImage(std::uintptr_t flashDest, std::size_t imageSize)
 {
     std::uint8_t buffer[4];
     std::size_t  received = 0;
@@ -17,10 +34,9 @@ void UartReceiver::receiveImage(std::uintptr_t flashDest, std::size_t imageSize)
         // Read up to 4 bytes
         while (chunk < 4 && received + chunk < imageSize)
         {
-            char byte;
-            if (m_uart.read(byte))
+            if (!readByte(buffer[chunk++]))
             {
-                buffer[chunk++] = static_cast<std::uint8_t>(byte);
+                return false;
             }
         }
 
@@ -36,4 +52,17 @@ void UartReceiver::receiveImage(std::uintptr_t flashDest, std::size_t imageSize)
         flashDest += 4;
         received += chunk;
     }
+    return true;
+}
+
+bool UartReceiver::receiveBuffer(std::uint8_t* t_dest, std::size_t t_size)
+{
+    for (std::size_t received = 0; received < t_size; ++received)
+    {
+        if (!readByte(t_dest[received]))
+        {
+            return false;
+        }
+    }
+    return true;
 }
@@ -10,6 +10,7 @@
  *            (c) 2025 ha-ctrl project authors.
  */
 #include "uart_stm32.hpp"
+#include "irq_priority_stm32.hpp"
 #include "stm32f4xx_ll_rcc.h"
 
 static IRQn_Type resolveIrq(UartId id);
@@ -59,23 +60,8 @@ void Uart_STM32::init(UartId id, uint32_t baudrate)
     m_usart->BRR = brr;
     m_usart->CR1 |= USART_CR1_TE | USART_CR1_RE | USART_CR1_UE;
     m_usart->CR1 |= USART_CR1_RXNEIE; // Enable RX interrupt
-    NVIC_EnableIRQ(resolveIrq(id));      
-}
-
-void Uart_STM32::write(char c)
-{
-    while (!(m_usart->SR & USART_SR_TXE))
-    {
-    }
-    m_usart->DR = c;
-}
-
-void Uart_STM32::write(const char* str)
-{
-    while (*str)
-    {
-        write(*str++);
-    }
+    NVIC_SetPriority(resolveIrq(id), IrqPriority::UART);
+    NVIC_EnableIRQ(resolveIrq(id));
 }
 
 uint32_t Uart_STM32::getAPBClockFreq(UartId id)
@@ -16,9 +16,8 @@
  ******************************************************************************
  */
 #include "watchdog_stm32.hpp"
-#include "stm32f4xx_ll_iwdg.h"
 
-Watchdog_STM32::Watchdog_STM32(uint32_t t_timeout_ms)
+void Watchdog_STM32::start(uint32_t t_timeout_ms)
 {
     constexpr uint32_t prescaler    = 64;
     constexpr uint32_t lsi_freq     = 32000;
@@ -34,12 +33,6 @@ Watchdog_STM32::Watchdog_STM32(uint32_t t_timeout_ms)
     LL_IWDG_SetReloadCounter(IWDG, m_reload_value);
 
     waitReady();
-    feed();
-}
-
-void Watchdog_STM32::feed()
-{
-    LL_IWDG_ReloadCounter(IWDG);
 }
 
 void Watchdog_STM32::waitReady()
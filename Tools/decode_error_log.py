@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+
+# Decoder for the error log sector (Platform/Common/Log, sector 2 @ 0x08008000)
+#
+#   python3 decode_error_log.py --port /dev/ttyUSB0     # sends 'errlog' and decodes the reply
+#   python3 decode_error_log.py --file sector2.bin      # raw 16 KB sector read with ST-Link
+#   python3 decode_error_log.py --file dump.bin --serial-dump   # saved 'errlog' reply
+#
+# Page layout: {'LOGP', sequence} followed by records [sync:8|type:8|length:16] + payload.
+
+import argparse
+import struct
+import sys
+import time
+
+PAGE_MAGIC = 0x4C4F4750
+RECORD_SYNC = 0xA5
+PAGE_HEADER_SIZE = 8
+DEFAULT_PAGE_SIZE = 1024
+
+RECORD_CRASH = 0x01
+RECORD_EVENT = 0x02
+
+CRASH_MAGIC = 0x43525348
+CRASH_STACK_WORDS = 32
+CRASH_FIELDS = ['magic', 'exception', 'r0', 'r1', 'r2', 'r3', 'r12', 'lr', 'pc', 'xpsr',
+                'exc_return', 'sp', 'cfsr', 'hfsr', 'mmfar', 'bfar', 'uptime_ms',
+                'signature_status', 'signature_check_us', 'stack_words']
+CRASH_FORMAT = f'<{len(CRASH_FIELDS)}I{CRASH_STACK_WORDS}II'
+
+# AppEvent (App/Inc/app.hpp)
+EVENTS = {1: 'Boot', 2: 'CrashRecorded', 3: 'ButtonPressed'}
+
+RESET_FLAGS = {25: 'BOR', 26: 'PIN', 27: 'POR', 28: 'SFT', 29: 'IWDG', 30: 'WWDG', 31: 'LPWR'}
+
+EXCEPTIONS = {3: 'HardFault', 4: 'MemManage', 5: 'BusFault', 6: 'UsageFault'}
+
+CFSR_BITS = {
+    0: 'IACCVIOL', 1: 'DACCVIOL', 3: 'MUNSTKERR', 4: 'MSTKERR', 5: 'MLSPERR', 7: 'MMARVALID',
+    8: 'IBUSERR', 9: 'PRECISERR', 10: 'IMPRECISERR', 11: 'UNSTKERR', 12: 'STKERR',
+    13: 'LSPERR', 15: 'BFARVALID',
+    16: 'UNDEFINSTR', 17: 'INVSTATE', 18: 'INVPC', 19: 'NOCP', 24: 'UNALIGNED', 25: 'DIVBYZERO',
+}
+
+def decode_crash(payload):
+    values = struct.unpack_from(CRASH_FORMAT, payload)
+    crash = dict(zip(CRASH_FIELDS, values))
+    stack = values[len(CRASH_FIELDS):len(CRASH_FIELDS) + CRASH_STACK_WORDS]
+    check = values[-1]
+
+    computed = 0
+    for word in values[:-1]:
+        computed ^= word
+
+    flags = [name for bit, name in CFSR_BITS.items() if crash['cfsr'] & (1 << bit)]
+    print(f"  CRASH {EXCEPTIONS.get(crash['exception'], crash['exception'])} "
+          f"at uptime {crash['uptime_ms']} ms{'' if computed == check else '  [CHECK MISMATCH]'}")
+    print(f"    PC   0x{crash['pc']:08X}  LR  0x{crash['lr']:08X}  xPSR 0x{crash['xpsr']:08X}  "
+          f"SP 0x{crash['sp']:08X}  EXC_RETURN 0x{crash['exc_return']:08X}")
+    print(f"    R0   0x{crash['r0']:08X}  R1  0x{crash['r1']:08X}  R2   0x{crash['r2']:08X}  "
+          f"R3 0x{crash['r3']:08X}  R12 0x{crash['r12']:08X}")
+    print(f"    CFSR 0x{crash['cfsr']:08X} {' '.join(flags)}")
+    print(f"    HFSR 0x{crash['hfsr']:08X}  MMFAR 0x{crash['mmfar']:08X}  BFAR 0x{crash['bfar']:08X}")
+    print(f"    Boot: signature status {crash['signature_status']}, "
+          f"check {crash['signature_check_us']} us")
+    words = stack[:crash['stack_words']]
+    for i in range(0, len(words), 8):
+        print(f"    SP+{i * 4:03X}: " + ' '.join(f'{w:08X}' for w in words[i:i + 8]))
+    print(f"    addr2line -e ha-ctrl-app.elf 0x{crash['pc']:08X} 0x{crash['lr']:08X}")
+
+def decode_events(payload):
+    for offset in range(0, len(payload) - 11, 12):
+        timestamp, event_id, sequence, data = struct.unpack_from('<IHHI', payload, offset)
+        name = EVENTS.get(event_id, f'id {event_id}')
+        if event_id == 1:
+            detail = ' '.join(flag for bit, flag in RESET_FLAGS.items() if data & (1 << bit))
+        else:
+            detail = f'0x{data:08X}'
+        print(f"  [{sequence:5}] {timestamp:10} ms  {name:14} {detail}")
+
+DECODERS = {RECORD_CRASH: decode_crash, RECORD_EVENT: decode_events}
+
+def parse_pages(data, page_size):
+    pages = []
+    for offset in range(0, len(data) - page_size + 1, page_size):
+        magic, sequence = struct.unpack_from('<II', data, offset)
+        if magic == PAGE_MAGIC:
+            pages.append((sequence, data[offset:offset + page_size]))
+    pages.sort(key=lambda page: page[0])
+    return pages
+
+def decode(data, page_size):
+    pages = parse_pages(data, page_size)
+    if not pages:
+        print("Error log is empty")
+        return
+
+    print(f"{len(pages)} page(s), sequence {pages[0][0]}..{pages[-1][0]}")
+    for sequence, page in pages:
+        print(f"Page #{sequence}")
+        offset = PAGE_HEADER_SIZE
+        while offset + 4 <= page_size:
+            (header,) = struct.unpack_from('<I', page, offset)
+            if (header >> 24) != RECORD_SYNC:
+                break
+            record_type = (header >> 16) & 0xFF
+            length = header & 0xFFFF
+            payload = page[offset + 4:offset + 4 + length]
+            decoder = DECODERS.get(record_type)
+            if decoder:
+                decoder(payload)
+            else:
+                print(f"  type 0x{record_type:02X} ({length} B): {payload.hex()}")
+            offset += 4 + ((length + 3) & ~3)
+
+def parse_serial_dump(raw):
+    header_end = raw.index(b'\r\n')
+    tag, page_size, page_count = raw[:header_end].split()
+    if tag != b'ERRLOG':
+        raise ValueError("Not an 'errlog' reply")
+    page_size, page_count = int(page_size), int(page_count)
+    start = header_end + 2
+    return raw[start:start + page_size * page_count], page_size
+
+def read_serial(port, baud):
+    import serial  # pyserial, only needed for live retrieval
+
+    with serial.Serial(port, baud, timeout=2) as ser:
+        ser.reset_input_buffer()
+        ser.write(b"errlog\n")
+        time.sleep(0.1)
+
+        line = ser.read_until(b'ERRLOG')
+        if not line.endswith(b'ERRLOG'):
+            raise TimeoutError("No 'errlog' reply from device")
+        header = b'ERRLOG' + ser.read_until(b'\r\n')
+        _, page_size, page_count = header.split()
+        body = ser.read(int(page_size) * int(page_count))
+        return parse_serial_dump(header + body)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Decode the ha-ctrl error log")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--port', help="serial port of the device console")
+    source.add_argument('--file', help="raw sector image or saved 'errlog' reply")
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--serial-dump', action='store_true',
+                        help="--file holds an 'errlog' reply instead of a raw sector")
+    args = parser.parse_args()
+
+    if args.port:
+        data, page_size = read_serial(args.port, args.baud)
+    else:
+        with open(args.file, 'rb') as f:
+            raw = f.read()
+        data, page_size = parse_serial_dump(raw) if args.serial_dump else (raw, DEFAULT_PAGE_SIZE)
+
+    decode(data, page_size)
+    sys.exit(0)
@@ -0,0 +1,377 @@
+/**
+ * @file      Tools/defer_log_decode.cpp
+ * @author    it32bit
+ * @brief     Host decoder for deferred binary logs (App/Inc/defer_log.hpp).
+ *
+ * @details   Reads the "defer_log_strings" section of the App ELF, then renders the
+ *            console stream: plain text is passed through, 0x00-delimited COBS frames are
+ *            decoded and formatted with the same Fmt code the target uses in text mode.
+ *
+ *            Usage: defer_log_decode <ha-ctrl-app.elf> [capture|tty|-] [--clock-hz N]
+ *            For a live port configure it first, e.g. stty -F /dev/ttyACM0 115200 raw.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "defer_log.hpp"
+#include "fmt_log.hpp"
+
+namespace
+{
+
+struct StringTable
+{
+    std::vector<std::uint8_t> data; // Record id N is the entry at offset N - 1
+};
+
+template <typename T>
+T readLe(const std::vector<std::uint8_t>& t_file, std::uint64_t t_offset)
+{
+    T value{};
+    if (t_offset + sizeof(T) <= t_file.size())
+    {
+        std::memcpy(&value, t_file.data() + t_offset, sizeof(T)); // Host is little endian
+    }
+    return value;
+}
+
+bool loadStringTable(const char* t_path, StringTable& t_table)
+{
+    std::ifstream             input(t_path, std::ios::binary);
+    std::vector<std::uint8_t> elf((std::istreambuf_iterator<char>(input)),
+                                  std::istreambuf_iterator<char>());
+
+    if ((elf.size() < 64) || (std::memcmp(elf.data(), "\x7F" "ELF", 4) != 0) || (elf[5] != 1))
+    {
+        std::fprintf(stderr, "%s: not a little-endian ELF file\n", t_path);
+        return false;
+    }
+
+    const bool is64 = (elf[4] == 2);
+
+    // Offsets of e_shoff.. and of sh_offset/sh_size differ between ELF32 and ELF64
+    const auto word = [&](std::uint64_t t_offset32, std::uint64_t t_offset64) -> std::uint64_t
+    {
+        return is64 ? readLe<std::uint64_t>(elf, t_offset64)
+                    : readLe<std::uint32_t>(elf, t_offset32);
+    };
+
+    const std::uint64_t shoff     = word(0x20, 0x28);
+    const std::uint16_t shentsize = readLe<std::uint16_t>(elf, is64 ? 0x3A : 0x2E);
+    const std::uint16_t shnum     = readLe<std::uint16_t>(elf, is64 ? 0x3C : 0x30);
+    const std::uint16_t shstrndx  = readLe<std::uint16_t>(elf, is64 ? 0x3E : 0x32);
+
+    const auto header = [&](std::uint16_t t_index)
+    { return shoff + std::uint64_t{t_index} * shentsize; };
+    const std::uint64_t names = word(header(shstrndx) + 0x10, header(shstrndx) + 0x18);
+
+    for (std::uint16_t i = 0; i < shnum; ++i)
+    {
+        const std::uint64_t name   = names + readLe<std::uint32_t>(elf, header(i));
+        const std::uint64_t offset = word(header(i) + 0x10, header(i) + 0x18);
+        const std::uint64_t size   = word(header(i) + 0x14, header(i) + 0x20);
+
+        if ((name < elf.size()) && (offset + size <= elf.size()) &&
+            (std::strcmp(reinterpret_cast<const char*>(elf.data() + name),
+                         "defer_log_strings") == 0))
+        {
+            t_table.data.assign(elf.begin() + offset, elf.begin() + offset + size);
+            return true;
+        }
+    }
+
+    std::fprintf(stderr, "%s: no defer_log_strings section\n", t_path);
+    return false;
+}
+
+std::string g_line; // Rendered record
+
+void appendLine(const char* t_data, std::size_t t_size)
+{
+    g_line.append(t_data, t_size);
+}
+
+class Reader
+{
+  public:
+    Reader(const std::uint8_t* t_data, std::size_t t_size) : m_data(t_data), m_size(t_size) {}
+
+    bool varint(std::uint64_t& t_value)
+    {
+        t_value = 0;
+        for (unsigned shift = 0; (m_pos < m_size) && (shift < 64); shift += 7)
+        {
+            const std::uint8_t byte = m_data[m_pos++];
+            t_value |= std::uint64_t{byte & 0x7FU} << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool bytes(void* t_out, std::size_t t_count)
+    {
+        if (m_pos + t_count > m_size)
+        {
+            return false;
+        }
+        std::memcpy(t_out, m_data + m_pos, t_count);
+        m_pos += t_count;
+        return true;
+    }
+
+  private:
+    const std::uint8_t* m_data;
+    std::size_t         m_size;
+    std::size_t         m_pos{0};
+};
+
+// Render one argument at the placeholder t_text points to; advances past it
+bool renderArgument(Fmt::Writer& t_out, const char*& t_text, char t_type, Reader& t_args)
+{
+    t_text = Fmt::Detail::copyLiteral(t_out, t_text);
+
+    Fmt::Spec         spec;
+    const std::size_t end = Fmt::parseSpec(t_text, 0, spec);
+    if ((*t_text != '{') || (end == Fmt::BAD_SPEC))
+    {
+        return false;
+    }
+    t_text += end;
+
+    std::uint64_t raw = 0;
+    switch (t_type)
+    {
+        case 'u':
+            if (!t_args.varint(raw))
+                return false;
+            Fmt::Detail::formatArgument(t_out, raw, spec);
+            return true;
+        case 'i':
+        {
+            if (!t_args.varint(raw))
+                return false;
+            const std::int64_t value =
+                static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1); // zigzag
+            Fmt::Detail::formatArgument(t_out, value, spec);
+            return true;
+        }
+        case 'f':
+        {
+            float value;
+            if (!t_args.bytes(&value, sizeof(value)))
+                return false;
+            Fmt::Detail::formatArgument(t_out, value, spec);
+            return true;
+        }
+        case 'c':
+        {
+            char value;
+            if (!t_args.bytes(&value, 1))
+                return false;
+            Fmt::Detail::formatArgument(t_out, value, spec);
+            return true;
+        }
+        case 's':
+        {
+            char text[DeferLog::MAX_STRING + 1]{};
+            if (!t_args.varint(raw) || (raw > DeferLog::MAX_STRING) || !t_args.bytes(text, raw))
+                return false;
+            const char* value = text;
+            Fmt::Detail::formatArgument(t_out, value, spec);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+class Decoder
+{
+  public:
+    Decoder(const StringTable& t_table, double t_clockHz)
+        : m_table(t_table), m_clockHz(t_clockHz)
+    {
+    }
+
+    void feed(std::uint8_t t_byte)
+    {
+        if (!m_inFrame)
+        {
+            if (t_byte == 0x00)
+            {
+                m_inFrame = true;
+            }
+            else
+            {
+                std::fputc(t_byte, stdout);
+            }
+            return;
+        }
+
+        if (t_byte != 0x00)
+        {
+            m_frame.push_back(t_byte);
+            return;
+        }
+        if (m_frame.empty())
+        {
+            return; // "0x00 0x00": end of one frame and start of the next
+        }
+
+        if (decodeFrame())
+        {
+            m_inFrame = false;
+        }
+        else
+        {
+            // Joined the stream mid-frame: that was text, and this 0x00 opens a frame
+            std::fwrite(m_frame.data(), 1, m_frame.size(), stdout);
+        }
+        m_frame.clear();
+        std::fflush(stdout);
+    }
+
+  private:
+    bool decodeFrame()
+    {
+        std::vector<std::uint8_t> record(m_frame.size());
+        const std::size_t size =
+            DeferLog::cobsDecode(m_frame.data(), m_frame.size(), record.data());
+
+        Reader        in(record.data(), size);
+        std::uint64_t id, delta;
+        if ((size == 0) || !in.varint(id) || !in.varint(delta))
+        {
+            return false;
+        }
+
+        g_line.clear();
+        if (id == DeferLog::OVERFLOW_ID)
+        {
+            std::uint64_t dropped = 0;
+            if (!in.varint(dropped))
+            {
+                return false;
+            }
+            g_line = "<" + std::to_string(dropped) + " records dropped>";
+        }
+        else if (!render(id, in))
+        {
+            return false;
+        }
+
+        m_cycles += delta;
+        std::printf("[%12.6f] %s\n", static_cast<double>(m_cycles) / m_clockHz, g_line.c_str());
+        return true;
+    }
+
+    bool render(std::uint64_t t_id, Reader& t_args) const
+    {
+        const std::uint64_t offset = t_id - 1;
+        if ((offset >= m_table.data.size()) ||
+            (std::memchr(m_table.data.data() + offset, '\0', m_table.data.size() - offset) ==
+             nullptr))
+        {
+            return false;
+        }
+
+        // Entry: "<signature>\0<format>\0"
+        const char* signature = reinterpret_cast<const char*>(m_table.data.data() + offset);
+        const char* text      = signature + std::strlen(signature) + 1;
+
+        char        buffer[128];
+        Fmt::Writer out(buffer, sizeof(buffer), &appendLine);
+        for (const char* type = signature; *type != '\0'; ++type)
+        {
+            if (!renderArgument(out, text, *type, t_args))
+            {
+                return false;
+            }
+        }
+        Fmt::Detail::copyLiteral(out, text);
+        out.flush();
+
+        // One record per line, whatever line ending the format used
+        while (!g_line.empty() && ((g_line.back() == '\n') || (g_line.back() == '\r')))
+        {
+            g_line.pop_back();
+        }
+        return true;
+    }
+
+    const StringTable&        m_table;
+    double                    m_clockHz;
+    std::uint64_t             m_cycles{0};
+    bool                      m_inFrame{false};
+    std::vector<std::uint8_t> m_frame;
+};
+
+} // namespace
+
+void Fmt::write(const char* t_data, std::size_t t_size)
+{
+    std::fwrite(t_data, 1, t_size, stdout);
+}
+
+int main(int argc, char** argv)
+{
+    const char* elfPath   = nullptr;
+    const char* inputPath = "-";
+    double      clockHz   = 168e6; // SystemCoreClock of the App
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((std::strcmp(argv[i], "--clock-hz") == 0) && (i + 1 < argc))
+        {
+            clockHz = std::strtod(argv[++i], nullptr);
+        }
+        else if (elfPath == nullptr)
+        {
+            elfPath = argv[i];
+        }
+        else
+        {
+            inputPath = argv[i];
+        }
+    }
+
+    if (elfPath == nullptr)
+    {
+        std::fprintf(stderr, "usage: %s <ha-ctrl-app.elf> [capture|tty|-] [--clock-hz N]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    StringTable table;
+    if (!loadStringTable(elfPath, table))
+    {
+        return 1;
+    }
+
+    std::FILE* input = (std::strcmp(inputPath, "-") == 0) ? stdin : std::fopen(inputPath, "rb");
+    if (input == nullptr)
+    {
+        std::perror(inputPath);
+        return 1;
+    }
+
+    Decoder decoder(table, clockHz);
+    for (int byte = std::fgetc(input); byte != EOF; byte = std::fgetc(input))
+    {
+        decoder.feed(static_cast<std::uint8_t>(byte));
+    }
+    return 0;
+}
@@ -1,5 +1,9 @@
-# Tools/python3 serial_send_image.py
+# Tools/python3 serial_send_image.py [--components app|bootsec|bootsec,app] [--port PORT]
+#
+# Sends a UART update package (manifest + selected components) produced by
+# cmake/make_update_package.py. An app-only package programs only the app slot.
 
+import argparse
 import serial
 import time
 import os
@@ -7,15 +11,23 @@ import os
 PORT = "/dev/ttyUSB0"  # Correct the port name; remove extra descriptor
 BAUD = 115200
 
+parser = argparse.ArgumentParser(description="Send an update package to the device")
+parser.add_argument("--components", default="bootsec,app",
+                    help="package to send: bootsec,app (default), app or bootsec")
+parser.add_argument("--port", default=PORT)
+parser.add_argument("--package", default=None, help="explicit package path (overrides --components)")
+args = parser.parse_args()
+
 # Get the path to this script
 script_dir = os.path.dirname(os.path.abspath(__file__))
 
 # Build the path to the binary
-binary_path = os.path.join(script_dir, "..", "build", "bin", "ha-ctrl_combined_update_image.bin")
+package_name = "ha-ctrl_update_" + args.components.replace(",", "_") + ".bin"
+binary_path = args.package or os.path.join(script_dir, "..", "build", "bin", package_name)
 binary_path = os.path.normpath(binary_path)
 
 # Open the serial port
-ser = serial.Serial(PORT, BAUD, timeout=1)
+ser = serial.Serial(args.port, BAUD, timeout=1)
 time.sleep(2)  # allow MCU to reset if needed
 
 # 1. Send the command
@@ -29,7 +41,7 @@ time.sleep(1)
 # 3. Send the binary file
 with open(binary_path, "rb") as f:
     data = f.read()
-    print(f"Sending {len(data)} bytes...")
+    print(f"Sending {binary_path} ({len(data)} bytes)...")
     ser.write(data)
 
 ser.close()
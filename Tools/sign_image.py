@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+# Ed25519 signing of firmware metadata (see Firmware::Certificate / Firmware::PublicKeyStore)
+#
+#   python3 sign_image.py keygen   signing_key.pem
+#   python3 sign_image.py pubkey   signing_key.pem public_key_store.bin [key_id]
+#   python3 sign_image.py sign     signing_key.pem app_metadata.bin app_cert.bin [key_id]
+#   python3 sign_image.py secret   device_secret.bin
+#
+# This will produce:
+#   (+) public_key_store.bin: flash once at CERT_PRIVATE_START (sector 1) with ST-Link
+#   (+) device_secret.bin: new for every device, flash once at CERT_DEVICE_SECRET_START
+#       (CERT_PRIVATE_START + 0x100); keys the signature cache of BootSec
+#   (+) app_cert.bin: 512 B certificate placed at APP_CERT_START / NEW_APP_CERT_START
+#
+# The signature covers the 64 B metadata block, which carries the SHA-256 of the firmware.
+# Requires: pip install cryptography
+
+import os
+import sys
+import struct
+
+from cryptography.hazmat.primitives import serialization
+from cryptography.hazmat.primitives.asymmetric.ed25519 import Ed25519PrivateKey
+
+CERTIFICATE_MAGIC = 0x43455254  # 'CERT'
+PUBLIC_KEY_MAGIC = 0x504B4559   # 'PKEY'
+DEVICE_SECRET_MAGIC = 0x44534543  # 'DSEC'
+SIGNATURE_ALG_ED25519 = 1
+METADATA_SIZE = 64
+CERT_REGION_SIZE = 512
+
+def load_key(key_path):
+    with open(key_path, 'rb') as f:
+        return serialization.load_pem_private_key(f.read(), password=None)
+
+def keygen(key_path):
+    key = Ed25519PrivateKey.generate()
+    pem = key.private_bytes(serialization.Encoding.PEM,
+                            serialization.PrivateFormat.PKCS8,
+                            serialization.NoEncryption())
+    with open(key_path, 'wb') as f:
+        f.write(pem)
+    print(f"Signing key written to {key_path} - keep it off the build server")
+
+def pubkey(key_path, output_path, key_id):
+    public = load_key(key_path).public_key().public_bytes(serialization.Encoding.Raw,
+                                                          serialization.PublicFormat.Raw)
+    store = struct.pack('<IIII32s', PUBLIC_KEY_MAGIC, SIGNATURE_ALG_ED25519, key_id, 0, public)
+    with open(output_path, 'wb') as f:
+        f.write(store)
+    print(f"Public key store written to {output_path} (key id {key_id}): {public.hex()}")
+
+def secret(output_path):
+    record = struct.pack('<IIII32s', DEVICE_SECRET_MAGIC, 0, 0, 0, os.urandom(32))
+    with open(output_path, 'wb') as f:
+        f.write(record)
+    print(f"Device secret written to {output_path} - flash it to one device only, then delete it")
+
+def sign(key_path, metadata_path, output_path, key_id):
+    with open(metadata_path, 'rb') as f:
+        metadata = f.read()
+    if len(metadata) != METADATA_SIZE:
+        raise ValueError(f"Metadata must be {METADATA_SIZE} bytes, got {len(metadata)}")
+
+    signature = load_key(key_path).sign(metadata)
+    cert = struct.pack('<IIII64s', CERTIFICATE_MAGIC, SIGNATURE_ALG_ED25519, key_id, 0, signature)
+    cert += b'\xFF' * (CERT_REGION_SIZE - len(cert))
+
+    with open(output_path, 'wb') as f:
+        f.write(cert)
+    print(f"Certificate written to {output_path} (key id {key_id})")
+
+if __name__ == '__main__':
+    usage = ("Usage: sign_image.py keygen <key.pem>\n"
+             "       sign_image.py pubkey <key.pem> <public_key_store.bin> [key_id]\n"
+             "       sign_image.py sign <key.pem> <metadata.bin> <cert.bin> [key_id]\n"
+             "       sign_image.py secret <device_secret.bin>")
+
+    if len(sys.argv) < 3:
+        print(usage)
+        sys.exit(1)
+
+    command = sys.argv[1]
+    if command == 'keygen' and len(sys.argv) == 3:
+        keygen(sys.argv[2])
+    elif command == 'pubkey' and len(sys.argv) in (4, 5):
+        pubkey(sys.argv[2], sys.argv[3], int(sys.argv[4]) if len(sys.argv) == 5 else 1)
+    elif command == 'sign' and len(sys.argv) in (5, 6):
+        sign(sys.argv[2], sys.argv[3], sys.argv[4], int(sys.argv[5]) if len(sys.argv) == 6 else 1)
+    elif command == 'secret' and len(sys.argv) == 3:
+        secret(sys.argv[2])
+    else:
+        print(usage)
+        sys.exit(1)
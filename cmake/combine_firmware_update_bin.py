@@ -6,7 +6,8 @@
 #     boot_sec.bin \
 #     boot_sec_metadata.bin \
 #     Platform\Platform_MCU\Inc\flash_layout.hpp \
-#     combined_output.bin
+#     combined_output.bin \
+#     [app_cert.bin]
 
 # | Component            | Flash Address | Size   |
 # |----------------------|---------------|--------|
@@ -38,7 +39,7 @@ def pad_to_offset(f, target_offset):
         raise ValueError(f"Data exceeds target offset {target_offset}")
     f.write(b'\xFF' * (target_offset - current_size))
 
-def combine(app_bin, app_meta, sec_bin, sec_meta, header_path, output_path):
+def combine(app_bin, app_meta, sec_bin, sec_meta, header_path, output_path, app_cert=None):
 
     FLASH_BASE_ADDR = extract_address(header_path, 'FLASH_BASE_ADDR')
     BOOTLOADER2_OFFSET = extract_address(header_path, 'NEW_BOOTLOADER2_START') - FLASH_BASE_ADDR
@@ -47,6 +48,7 @@ def combine(app_bin, app_meta, sec_bin, sec_meta, header_path, output_path):
     SEC_META_OFFSET = extract_address(header_path, 'NEW_BOOTLOADER2_METADATA_START') - OFFSET
     APP_OFFSET = extract_address(header_path, 'NEW_APP_START') - OFFSET
     APP_META_OFFSET = extract_address(header_path, 'NEW_APP_METADATA_START') - OFFSET
+    APP_CERT_OFFSET = extract_address(header_path, 'NEW_APP_CERT_START') - OFFSET
 
     with open(app_bin, 'rb') as f_app, open(app_meta, 'rb') as f_app_meta, \
          open(sec_bin, 'rb') as f_sec, open(sec_meta, 'rb') as f_sec_meta, \
@@ -67,7 +69,13 @@ def combine(app_bin, app_meta, sec_bin, sec_meta, header_path, output_path):
         pad_to_offset(out, APP_META_OFFSET)
         out.write(f_app_meta.read())
 
-        # Pad to end of 1 KB metadata region (reserved for Public CERT)
+        # Write application certificate (Ed25519 signature over the metadata), if signed
+        if app_cert:
+            with open(app_cert, 'rb') as f_app_cert:
+                pad_to_offset(out, APP_CERT_OFFSET)
+                out.write(f_app_cert.read())
+
+        # Pad to end of 1 KB metadata region
         APP_META_END = APP_META_OFFSET + 1024
         pad_to_offset(out, APP_META_END)
 
@@ -75,8 +83,8 @@ def combine(app_bin, app_meta, sec_bin, sec_meta, header_path, output_path):
         print(f"Combined firmware written to {output_path} ({final_size / 1024:.2f} KB)")
 
 if __name__ == '__main__':
-    if len(sys.argv) != 7:
-        print("Usage: combine_firmware.py <app.bin> <app_metadata.bin> <sec.bin> <sec_metadata.bin> <output.bin> <flash_layout.hpp>")
+    if len(sys.argv) not in (7, 8):
+        print("Usage: combine_firmware.py <app.bin> <app_metadata.bin> <sec.bin> <sec_metadata.bin> <flash_layout.hpp> <output.bin> [app_cert.bin]")
         sys.exit(1)
 
     combine(*sys.argv[1:])
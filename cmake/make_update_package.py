@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+
+# python3 make_update_package.py \
+#     app.bin app_metadata.bin \
+#     boot_sec.bin boot_sec_metadata.bin \
+#     update_package.bin \
+#     [--components app,bootsec] [--app-cert app_cert.bin]
+#
+# UART update package consumed by BootSec (see Firmware::UpdateManifest):
+#
+# | Part                 | Size                | Present when          |
+# |----------------------|---------------------|-----------------------|
+# | UpdateManifest       | 32 B                | always                |
+# | BootSec firmware     | bootSecSize         | 'bootsec' in manifest |
+# | BootSec trailer      | 1 KB (meta + cert)  | 'bootsec' in manifest |
+# | App firmware         | appSize             | 'app' in manifest     |
+# | App trailer          | 1 KB (meta + cert)  | 'app' in manifest     |
+#
+# Only the firmware bytes are sent, not the 0xFF padding up to the metadata block,
+# so an app-only release transfers roughly the size of the app.
+
+import argparse
+import struct
+
+UPDATE_MANIFEST_MAGIC = 0x5550444D  # 'UPDM'
+UPDATE_MANIFEST_VERSION = 1
+COMPONENT_BOOTSEC = 1 << 0
+COMPONENT_APP = 1 << 1
+METADATA_REGION_SIZE = 512
+CERT_REGION_SIZE = 512
+
+COMPONENTS = {'bootsec': COMPONENT_BOOTSEC, 'app': COMPONENT_APP}
+
+def read(path):
+    with open(path, 'rb') as f:
+        return f.read()
+
+def pad(data, size):
+    if len(data) > size:
+        raise ValueError(f"Block of {len(data)} bytes exceeds {size} bytes")
+    return data + b'\xFF' * (size - len(data))
+
+def trailer(meta_path, cert_path=None):
+    cert = read(cert_path) if cert_path else b''
+    return pad(read(meta_path), METADATA_REGION_SIZE) + pad(cert, CERT_REGION_SIZE)
+
+def manifest(component_mask, boot_sec_size, app_size):
+    words = [UPDATE_MANIFEST_MAGIC, UPDATE_MANIFEST_VERSION, component_mask,
+             boot_sec_size, app_size, 0, 0]
+    check = 0
+    for word in words:
+        check ^= word
+    return struct.pack('<8I', *words, check)
+
+def make_package(args):
+    names = [name.strip() for name in args.components.split(',') if name.strip()]
+    unknown = [name for name in names if name not in COMPONENTS]
+    if not names or unknown:
+        raise ValueError(f"Components must be a list of {', '.join(COMPONENTS)}")
+
+    component_mask = 0
+    for name in names:
+        component_mask |= COMPONENTS[name]
+
+    sec = read(args.sec_bin) if component_mask & COMPONENT_BOOTSEC else b''
+    app = read(args.app_bin) if component_mask & COMPONENT_APP else b''
+
+    with open(args.output, 'wb') as out:
+        out.write(manifest(component_mask, len(sec), len(app)))
+
+        # Order is fixed: BootSec first, then App
+        if component_mask & COMPONENT_BOOTSEC:
+            out.write(sec)
+            out.write(trailer(args.sec_meta))
+        if component_mask & COMPONENT_APP:
+            out.write(app)
+            out.write(trailer(args.app_meta, args.app_cert))
+
+        print(f"Update package [{', '.join(names)}] written to {args.output} "
+              f"({out.tell() / 1024:.2f} KB)")
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Build a per-component UART update package")
+    parser.add_argument('app_bin')
+    parser.add_argument('app_meta')
+    parser.add_argument('sec_bin')
+    parser.add_argument('sec_meta')
+    parser.add_argument('output')
+    parser.add_argument('--components', default='bootsec,app',
+                        help="comma separated list: bootsec, app (default: both)")
+    parser.add_argument('--app-cert', default=None, help="app certificate from sign_image.py")
+
+    make_package(parser.parse_args())
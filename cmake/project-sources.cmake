@@ -33,24 +33,32 @@ set(sources_SRCS
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/gpio_pin_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/gpio_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/watchdog_stm32.cpp
-    ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/watchdog_manager_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/clock_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/clock_boot_prim_stm32.cpp
-    ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/clock_manager_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/adc_stm32.cpp
-    ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/adc_manager_stm32.cpp
-    ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/uart_manager_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/uart_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/uart_receiver_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/flash_writer_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/crc32_stm32.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/fault_capture_stm32.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/timebase_stm32.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/timer_stm32.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Src/dma_stm32.cpp
     ${CMAKE_SOURCE_DIR}/Platform/Common/Integrity/Src/crc32_check.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/Common/Integrity/Src/sha256.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/Common/Integrity/Src/hmac_sha256.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/Common/Integrity/Src/sha512.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/Common/Integrity/Src/ed25519_verify.cpp
     ${CMAKE_SOURCE_DIR}/Platform/Common/Image/Src/image_manager.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/Common/Image/Src/blank_check.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/Common/Image/Src/update_manifest.cpp
     ${CMAKE_SOURCE_DIR}/Platform/Common/Image/Src/shared_memory.cpp
+    ${CMAKE_SOURCE_DIR}/Platform/Common/Log/Src/flash_log.cpp
 
     ${CMAKE_SOURCE_DIR}/App/Src/app.cpp
     ${CMAKE_SOURCE_DIR}/App/Src/app_it.cpp
     ${CMAKE_SOURCE_DIR}/App/Src/console.cpp
+    ${CMAKE_SOURCE_DIR}/App/Src/console_tx.cpp
     ${CMAKE_SOURCE_DIR}/App/Src/uart_redirect.cpp
 
     ${CMAKE_SOURCE_DIR}/Boot/Src/boot.cpp
@@ -69,6 +77,7 @@ set(include_HEADERS_DIRS
     ${CMAKE_SOURCE_DIR}/Platform/Interface
     ${CMAKE_SOURCE_DIR}/Platform/Common/Integrity/Inc
     ${CMAKE_SOURCE_DIR}/Platform/Common/Image/Inc
+    ${CMAKE_SOURCE_DIR}/Platform/Common/Log/Inc
     ${CMAKE_SOURCE_DIR}/Platform/${PLATFORM_MCU}/Inc
     ${CMAKE_SOURCE_DIR}/Drivers/stm32f4xx-hal-driver/Inc
     ${CMAKE_SOURCE_DIR}/Drivers/cmsis-device-f4/Include
@@ -62,21 +62,58 @@ add_custom_command(
     COMMENT "Generating boot-sec metadata"
 )
 
+# Optional Ed25519 signing of the app metadata (Tools/sign_image.py)
+set(FIRMWARE_SIGNING_KEY "" CACHE FILEPATH "Ed25519 PEM key used to sign the application image")
+
+set(APP_CERT_BIN "")
+if(FIRMWARE_SIGNING_KEY)
+    set(APP_CERT_BIN ${CMAKE_BINARY_DIR_BIN}/app_cert.bin)
+    add_custom_command(
+        OUTPUT ${APP_CERT_BIN}
+        COMMAND python3 ${CMAKE_SOURCE_DIR}/Tools/sign_image.py sign
+                ${FIRMWARE_SIGNING_KEY}
+                ${CMAKE_BINARY_DIR_BIN}/app_metadata.bin
+                ${APP_CERT_BIN}
+        DEPENDS ${CMAKE_BINARY_DIR_BIN}/app_metadata.bin
+        COMMENT "Signing app metadata"
+    )
+endif()
+
 if(NOT TARGET generate_metadata)
     add_custom_target(generate_metadata ALL
         DEPENDS ${CMAKE_BINARY_DIR_BIN}/app_metadata.bin
                 ${CMAKE_BINARY_DIR_BIN}/bootsec_metadata.bin
+                ${APP_CERT_BIN}
     )
 endif()
 
+# =========================================================================
+# Firmware Images
+# =========================================================================
+
+# One rule per image: the packaging commands depend on the .bin instead of running objcopy
+# themselves, so parallel builds never truncate an image another command is reading
+function(add_firmware_bin target)
+    set(FIRMWARE_BIN "${CMAKE_BINARY_DIR_BIN}/${target}.bin")
+
+    if(NOT TARGET ${target}_bin)
+        add_custom_command(
+            OUTPUT ${FIRMWARE_BIN}
+            COMMAND ${CMAKE_OBJCOPY} -O binary $<TARGET_FILE:${target}> ${FIRMWARE_BIN}
+            DEPENDS ${target}
+            COMMENT "Generating ${target}.bin"
+        )
+
+        # Users add_dependencies() on this target, so the rule runs once per build
+        add_custom_target(${target}_bin DEPENDS ${FIRMWARE_BIN})
+    endif()
+endfunction()
+
 # =========================================================================
 # Combined Binary Creation
 # =========================================================================
 
 function(add_combined_firmware_with_metadata target_app target_bsec app_meta_bin sec_meta_bin flash_layout output_name)
-    set(APP_ELF       $<TARGET_FILE:${target_app}>)
-    set(BOOT_SEC_ELF  $<TARGET_FILE:${target_bsec}>)
-
     set(APP_BIN       "${CMAKE_BINARY_DIR_BIN}/${target_app}.bin")
     set(BOOT_SEC_BIN  "${CMAKE_BINARY_DIR_BIN}/${target_bsec}.bin")
     set(APP_META_BIN  "${CMAKE_BINARY_DIR_BIN}/${app_meta_bin}")
@@ -84,10 +121,11 @@ function(add_combined_firmware_with_metadata target_app target_bsec app_meta_bin
     set(COMBINED_BIN  "${CMAKE_BINARY_DIR_BIN}/${output_name}.bin")
     set(FLASH_LAYOUT  "${flash_layout}")
 
+    add_firmware_bin(${target_app})
+    add_firmware_bin(${target_bsec})
+
     add_custom_command(
         OUTPUT ${COMBINED_BIN}
-        COMMAND ${CMAKE_OBJCOPY} -O binary ${APP_ELF}      ${APP_BIN}
-        COMMAND ${CMAKE_OBJCOPY} -O binary ${BOOT_SEC_ELF} ${BOOT_SEC_BIN}
         COMMAND ${CMAKE_COMMAND} -E echo "Combining firmware with metadata..."
         COMMAND ${CMAKE_COMMAND} -E env PYTHONPATH=${CMAKE_SOURCE_DIR}/cmake
                 python3 ${CMAKE_SOURCE_DIR}/cmake/combine_firmware_update_bin.py
@@ -97,13 +135,60 @@ function(add_combined_firmware_with_metadata target_app target_bsec app_meta_bin
                 ${SEC_META_BIN}
                 ${FLASH_LAYOUT}
                 ${COMBINED_BIN}
-        DEPENDS generate_metadata ${target_app} ${target_bsec}
+                ${APP_CERT_BIN}
+        DEPENDS generate_metadata ${APP_BIN} ${BOOT_SEC_BIN}
         COMMENT "Creating combined firmware binary with metadata: ${output_name}.bin"
     )
 
     add_custom_target(${output_name}_combined ALL
         DEPENDS ${COMBINED_BIN}
     )
+    add_dependencies(${output_name}_combined ${target_app}_bin ${target_bsec}_bin)
+endfunction()
+
+# =========================================================================
+# UART Update Packages (manifest + selected components)
+# =========================================================================
+
+function(add_update_packages target_app target_bsec app_meta_bin sec_meta_bin project_name)
+    set(APP_BIN       "${CMAKE_BINARY_DIR_BIN}/${target_app}.bin")
+    set(BOOT_SEC_BIN  "${CMAKE_BINARY_DIR_BIN}/${target_bsec}.bin")
+    set(APP_META_BIN  "${CMAKE_BINARY_DIR_BIN}/${app_meta_bin}")
+    set(SEC_META_BIN  "${CMAKE_BINARY_DIR_BIN}/${sec_meta_bin}")
+
+    add_firmware_bin(${target_app})
+    add_firmware_bin(${target_bsec})
+
+    set(APP_CERT_ARGS "")
+    if(APP_CERT_BIN)
+        set(APP_CERT_ARGS --app-cert ${APP_CERT_BIN})
+    endif()
+
+    set(PACKAGES "")
+    foreach(components IN ITEMS "bootsec,app" "app" "bootsec")
+        string(REPLACE "," "_" suffix "${components}")
+        set(PACKAGE_BIN "${CMAKE_BINARY_DIR_BIN}/${project_name}_update_${suffix}.bin")
+
+        add_custom_command(
+            OUTPUT ${PACKAGE_BIN}
+            COMMAND python3 ${CMAKE_SOURCE_DIR}/cmake/make_update_package.py
+                    ${APP_BIN}
+                    ${APP_META_BIN}
+                    ${BOOT_SEC_BIN}
+                    ${SEC_META_BIN}
+                    ${PACKAGE_BIN}
+                    --components ${components}
+                    ${APP_CERT_ARGS}
+            DEPENDS generate_metadata ${APP_BIN} ${BOOT_SEC_BIN}
+            COMMENT "Creating UART update package [${components}]"
+        )
+        list(APPEND PACKAGES ${PACKAGE_BIN})
+    endforeach()
+
+    add_custom_target(${project_name}_update_packages ALL
+        DEPENDS ${PACKAGES}
+    )
+    add_dependencies(${project_name}_update_packages ${target_app}_bin ${target_bsec}_bin)
 endfunction()
 
 # =========================================================================
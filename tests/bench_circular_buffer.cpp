@@ -0,0 +1,209 @@
+// Throughput of CircularBuffer against the previous volatile/modulo ring and its
+// std::function observer hook.
+// Host only, not part of run_tests: build the bench_circular_buffer target and run it.
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include "circular_buffer.hpp"
+
+namespace
+{
+// Previous implementation: volatile indices, '%' on every access, one slot unused
+template <class T, std::size_t TSize>
+class LegacyCircularBuffer
+{
+  public:
+    bool push(const T t_item)
+    {
+        auto next = (m_head + 1) % TSize;
+        if (next == m_tail)
+        {
+            return false;
+        }
+        m_buff[m_head] = t_item;
+        m_head         = next;
+        return true;
+    }
+
+    bool pop(T& t_item)
+    {
+        if (m_head == m_tail)
+        {
+            return false;
+        }
+        t_item = m_buff[m_tail];
+        m_tail = (m_tail + 1) % TSize;
+        return true;
+    }
+
+  private:
+    std::array<T, TSize> m_buff{};
+    volatile std::size_t m_head = 0;
+    volatile std::size_t m_tail = 0;
+};
+
+// Previous observer hook: std::function table filled at run time, called on every push
+template <class T, std::size_t TSize, std::size_t TObserverCount>
+class LegacyObservedBuffer : public LegacyCircularBuffer<T, TSize>
+{
+  public:
+    bool push(const T t_item)
+    {
+        if (LegacyCircularBuffer<T, TSize>::push(t_item) == false)
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < m_observer_count; ++i)
+        {
+            observers[i](t_item);
+        }
+        return true;
+    }
+
+    void registerObserver(std::function<void(T)> callback) { observers[m_observer_count++] = callback; }
+
+  private:
+    std::size_t            m_observer_count{};
+    std::function<void(T)> observers[TObserverCount];
+};
+
+volatile std::uint32_t observed = 0;
+
+void observerA(std::uint8_t t_item) { observed = observed + t_item; }
+void observerB(std::uint8_t t_item) { observed = observed ^ t_item; }
+void observerC(std::uint8_t) { observed = observed + 1; }
+void observerD(std::uint8_t t_item) { observed = observed - t_item; }
+
+constexpr std::size_t   SIZE   = 256;
+constexpr std::size_t   BATCH  = 128;
+constexpr std::uint64_t ROUNDS = 200000;
+
+template <typename Body>
+void run(const char* t_name, Body&& t_body)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto sum   = t_body();
+    const auto ns    = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+    const double bytes = static_cast<double>(ROUNDS * BATCH);
+    std::printf("%-28s %8.1f MB/s  %6.2f ns/byte  (checksum %llu)\n", t_name,
+                bytes / ns.count() * 1000.0, ns.count() / bytes,
+                static_cast<unsigned long long>(sum));
+}
+
+} // namespace
+
+int main()
+{
+    static LegacyCircularBuffer<std::uint8_t, SIZE> legacy;
+    static CircularBuffer<std::uint8_t, SIZE>       ring;
+
+    run("legacy push/pop per byte",
+        []
+        {
+            std::uint64_t sum = 0;
+            for (std::uint64_t r = 0; r < ROUNDS; ++r)
+            {
+                for (std::size_t i = 0; i < BATCH; ++i)
+                {
+                    legacy.push(static_cast<std::uint8_t>(i));
+                }
+                std::uint8_t item;
+                while (legacy.pop(item))
+                {
+                    sum += item;
+                }
+            }
+            return sum;
+        });
+
+    run("spsc push/pop per byte",
+        []
+        {
+            std::uint64_t sum = 0;
+            for (std::uint64_t r = 0; r < ROUNDS; ++r)
+            {
+                for (std::size_t i = 0; i < BATCH; ++i)
+                {
+                    ring.push(static_cast<std::uint8_t>(i));
+                }
+                std::uint8_t item;
+                while (ring.pop(item))
+                {
+                    sum += item;
+                }
+            }
+            return sum;
+        });
+
+    run("spsc bulk push/pop",
+        []
+        {
+            std::array<std::uint8_t, BATCH> in;
+            std::array<std::uint8_t, BATCH> out;
+            for (std::size_t i = 0; i < BATCH; ++i)
+            {
+                in[i] = static_cast<std::uint8_t>(i);
+            }
+
+            std::uint64_t sum = 0;
+            for (std::uint64_t r = 0; r < ROUNDS; ++r)
+            {
+                ring.push(std::span<const std::uint8_t>(in));
+                const std::size_t count = ring.pop(std::span<std::uint8_t>(out));
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    sum += out[i];
+                }
+            }
+            return sum;
+        });
+
+    // push() fan-out to 0, 1 and 4 observers
+    static LegacyObservedBuffer<std::uint8_t, SIZE, 4> legacy0;
+    static LegacyObservedBuffer<std::uint8_t, SIZE, 4> legacy1;
+    static LegacyObservedBuffer<std::uint8_t, SIZE, 4> legacy4;
+    legacy1.registerObserver(observerA);
+    legacy4.registerObserver(observerA);
+    legacy4.registerObserver(observerB);
+    legacy4.registerObserver(observerC);
+    legacy4.registerObserver(observerD);
+
+    static CircularBuffer<std::uint8_t, SIZE>                                     static0;
+    static CircularBuffer<std::uint8_t, SIZE, StaticObservers<observerA>>         static1;
+    static CircularBuffer<std::uint8_t, SIZE,
+                          StaticObservers<observerA, observerB, observerC, observerD>>
+        static4;
+
+    auto pushPop = [](auto& t_buffer)
+    {
+        return [&t_buffer]
+        {
+            std::uint64_t sum = 0;
+            for (std::uint64_t r = 0; r < ROUNDS; ++r)
+            {
+                for (std::size_t i = 0; i < BATCH; ++i)
+                {
+                    t_buffer.push(static_cast<std::uint8_t>(i));
+                }
+                std::uint8_t item;
+                while (t_buffer.pop(item))
+                {
+                    sum += item;
+                }
+            }
+            return sum;
+        };
+    };
+
+    run("legacy std::function, 0 obs", pushPop(legacy0));
+    run("legacy std::function, 1 obs", pushPop(legacy1));
+    run("legacy std::function, 4 obs", pushPop(legacy4));
+    run("static observers, 0 obs", pushPop(static0));
+    run("static observers, 1 obs", pushPop(static1));
+    run("static observers, 4 obs", pushPop(static4));
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Console dispatch cost against command count: previous linear strncmp scan versus the
+// sorted-table binary search of console_commands.hpp.
+// Host only, not part of run_tests: build the bench_console_dispatch target and run it.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "console_commands.hpp"
+
+namespace
+{
+volatile unsigned calls = 0;
+
+void handler(const char*)
+{
+    calls = calls + 1;
+}
+
+// Previous Console::process: first prefix match wins
+const ConsoleCommand* linearFind(const std::vector<ConsoleCommand>& t_table, const char* t_line)
+{
+    for (const auto& cmd : t_table)
+    {
+        if (std::strncmp(t_line, cmd.name, std::strlen(cmd.name)) == 0)
+        {
+            return &cmd;
+        }
+    }
+    return nullptr;
+}
+
+constexpr int LOOKUPS = 2000000;
+
+template <typename Find>
+double nsPerLookup(const std::vector<std::string>& t_lines, Find&& t_find)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < LOOKUPS; ++i)
+    {
+        const ConsoleCommand* cmd = t_find(t_lines[i % t_lines.size()].c_str());
+        if (cmd != nullptr)
+        {
+            cmd->handler("");
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+               .count() /
+           LOOKUPS;
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%8s %14s %14s\n", "commands", "linear [ns]", "binary [ns]");
+
+    for (std::size_t count : {8u, 16u, 32u, 64u, 128u})
+    {
+        std::vector<std::string> names;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            names.push_back("cmd_" + std::to_string(i * 7919 % 10007));
+        }
+        std::sort(names.begin(), names.end());
+
+        std::vector<ConsoleCommand> table;
+        std::vector<std::string>    lines;
+        for (const auto& name : names)
+        {
+            table.push_back({name.c_str(), &handler, "", name.size()});
+            lines.push_back(name + " 1");
+        }
+
+        const double linear = nsPerLookup(lines, [&](const char* t_line)
+                                          { return linearFind(table, t_line); });
+        const double binary = nsPerLookup(lines,
+                                          [&](const char* t_line)
+                                          {
+                                              return ConsoleCommands::find(
+                                                  table, t_line, std::strcspn(t_line, " "));
+                                          });
+
+        std::printf("%8zu %14.1f %14.1f\n", count, linear, binary);
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+// Cost and wire size of one log line: text formatting (Fmt::format, the text mode of
+// LOG_*) versus a deferred binary record (DLOG_*, COBS framed).
+// Host only, not part of run_tests: build the bench_defer_log target and run it.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include "defer_log.hpp"
+
+namespace
+{
+constexpr int LINES = 2000000;
+
+volatile std::size_t wireBytes = 0;
+std::uint64_t        cycles    = 0;
+
+LOG_MODULE(BenchLog, Info);
+
+void deferredButton(int i)
+{
+    DLOG_INFO(BenchLog, "[{}:{}]:{3}:Temperature: {3.2}[*C]\n\r", "app.cpp", 246, i & 0xFF,
+              20.0f + static_cast<float>(i & 0x3FF) * 0.01f);
+}
+
+void deferredTrace(int i)
+{
+    DLOG_INFO(BenchLog, "ADC channel {} raw {} filtered {.1} mV\r\n",
+              static_cast<std::uint32_t>(i & 0xF), static_cast<std::uint32_t>(i & 0xFFF),
+              static_cast<float>(i & 0xFFF) * 0.805f);
+}
+
+void deferredCounters(int i)
+{
+    DLOG_INFO(BenchLog, "RX bytes: {} dropped: {} overruns: {}\r\n", static_cast<std::uint32_t>(i),
+              static_cast<std::uint32_t>(i >> 4), static_cast<std::uint32_t>(i >> 8));
+}
+
+std::size_t textButton(char* b, std::size_t n, int i)
+{
+    return Fmt::format(b, n, "[{}:{}]:{3}:Temperature: {3.2}[*C]\n\r", "app.cpp", 246, i & 0xFF,
+                       20.0f + static_cast<float>(i & 0x3FF) * 0.01f);
+}
+
+std::size_t textTrace(char* b, std::size_t n, int i)
+{
+    return Fmt::format(b, n, "ADC channel {} raw {} filtered {.1} mV\r\n",
+                       static_cast<std::uint32_t>(i & 0xF), static_cast<std::uint32_t>(i & 0xFFF),
+                       static_cast<float>(i & 0xFFF) * 0.805f);
+}
+
+std::size_t textCounters(char* b, std::size_t n, int i)
+{
+    return Fmt::format(b, n, "RX bytes: {} dropped: {} overruns: {}\r\n",
+                       static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i >> 4),
+                       static_cast<std::uint32_t>(i >> 8));
+}
+
+struct Result
+{
+    double ns;
+    double bytes;
+};
+
+template <typename Log>
+Result measure(Log&& t_log)
+{
+    wireBytes = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < LINES; ++i)
+    {
+        t_log(i);
+    }
+    const double ns =
+        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return {ns / LINES, static_cast<double>(wireBytes) / LINES};
+}
+
+template <typename Text>
+Result measureText(Text t_text)
+{
+    return measure(
+        [t_text](int i)
+        {
+            char buffer[96];
+            wireBytes = wireBytes + t_text(buffer, sizeof(buffer), i);
+        });
+}
+
+} // namespace
+
+bool DeferLog::writeFrame(const std::uint8_t*, std::size_t t_size)
+{
+    wireBytes = wireBytes + t_size;
+    return true;
+}
+
+std::uint64_t DeferLog::timestamp()
+{
+    return cycles += 1680; // One record every 10 us at 168 MHz
+}
+
+void Fmt::write(const char*, std::size_t) {}
+
+int main()
+{
+    std::printf("%-22s %10s %10s %10s %10s %8s\n", "line", "text [ns]", "text [B]", "dlog [ns]",
+                "dlog [B]", "bytes");
+
+    const auto report = [](const char* t_name, Result t_text, Result t_deferred)
+    {
+        std::printf("%-22s %10.1f %10.1f %10.1f %10.1f %7.1fx\n", t_name, t_text.ns, t_text.bytes,
+                    t_deferred.ns, t_deferred.bytes, t_text.bytes / t_deferred.bytes);
+    };
+
+    report("button (string arg)", measureText(textButton), measure(deferredButton));
+    report("adc trace", measureText(textTrace), measure(deferredTrace));
+    report("counters", measureText(textCounters), measure(deferredCounters));
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Cost of one console log line: snprintf with %f (what printf pulled in through
+// _printf_float) versus the compile-time checked Fmt::format of fmt_log.hpp.
+// Host only, not part of run_tests: build the bench_fmt_log target and run it.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include "fmt_log.hpp"
+
+void Fmt::write(const char*, std::size_t) {}
+
+namespace
+{
+constexpr int LINES = 2000000;
+
+volatile std::size_t sink = 0;
+
+template <typename Format>
+double nsPerLine(Format&& t_format)
+{
+    char buffer[96];
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < LINES; ++i)
+    {
+        sink = sink + t_format(buffer, sizeof(buffer), i);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+               .count() /
+           LINES;
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%-28s %14s %14s %8s\n", "line", "snprintf [ns]", "Fmt [ns]", "ratio");
+
+    const auto report = [](const char* t_name, double t_legacy, double t_fmt)
+    { std::printf("%-28s %14.1f %14.1f %7.1fx\n", t_name, t_legacy, t_fmt, t_legacy / t_fmt); };
+
+    report(
+        "button: file, line, temp",
+        nsPerLine(
+            [](char* b, std::size_t n, int i)
+            {
+                return static_cast<std::size_t>(std::snprintf(
+                    b, n, "[%s:%d]:%3d:Temperature: %3.2f[*C]\n\r", "app.cpp", 246, i & 0xFF,
+                    20.0f + static_cast<float>(i & 0x3FF) * 0.01f));
+            }),
+        nsPerLine(
+            [](char* b, std::size_t n, int i)
+            {
+                return Fmt::format(b, n, "[{}:{}]:{3}:Temperature: {3.2}[*C]\n\r", "app.cpp",
+                                   246, i & 0xFF, 20.0f + static_cast<float>(i & 0x3FF) * 0.01f);
+            }));
+
+    report(
+        "crash: hex registers",
+        nsPerLine(
+            [](char* b, std::size_t n, int i)
+            {
+                return static_cast<std::size_t>(std::snprintf(
+                    b, n, "Crash captured: exception %lu PC 0x%08lX CFSR 0x%08lX\n\r",
+                    static_cast<unsigned long>(i & 0xF), static_cast<unsigned long>(0x08020000 + i),
+                    static_cast<unsigned long>(i)));
+            }),
+        nsPerLine(
+            [](char* b, std::size_t n, int i)
+            {
+                return Fmt::format(b, n, "Crash captured: exception {} PC 0x{08X} CFSR 0x{08X}\n\r",
+                                   static_cast<std::uint32_t>(i & 0xF),
+                                   static_cast<std::uint32_t>(0x08020000 + i),
+                                   static_cast<std::uint32_t>(i));
+            }));
+
+    report(
+        "counters: three integers",
+        nsPerLine(
+            [](char* b, std::size_t n, int i)
+            {
+                return static_cast<std::size_t>(
+                    std::snprintf(b, n, "RX bytes: %lu dropped: %lu overruns: %lu\r\n",
+                                  static_cast<unsigned long>(i), static_cast<unsigned long>(i >> 4),
+                                  static_cast<unsigned long>(i >> 8)));
+            }),
+        nsPerLine(
+            [](char* b, std::size_t n, int i)
+            {
+                return Fmt::format(b, n, "RX bytes: {} dropped: {} overruns: {}\r\n",
+                                   static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i >> 4),
+                                   static_cast<std::uint32_t>(i >> 8));
+            }));
+
+    return 0;
+}
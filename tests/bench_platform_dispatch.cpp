@@ -0,0 +1,143 @@
+// Manager call cost: previous placement-new driver behind a virtual interface, called
+// through an out-of-line manager, versus the traits-bound Platform* templates.
+// The drivers write a volatile word in place of the IWDG KR and USART DR registers.
+// Host only, not part of run_tests: build the bench_platform_dispatch target and run it.
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include "pil_uart.hpp"
+#include "pil_watchdog.hpp"
+
+namespace
+{
+volatile std::uint32_t keyRegister  = 0;
+volatile std::uint32_t dataRegister = 0;
+
+// Previous binding: interface, driver constructed in the manager's buffer
+class IWatchdog
+{
+  public:
+    virtual void feed()  = 0;
+    virtual ~IWatchdog() = default;
+};
+
+class VirtualWatchdog : public IWatchdog
+{
+  public:
+    void feed() override { keyRegister = 0xAAAA; }
+};
+
+class VirtualUart : public IConsoleUart
+{
+  public:
+    void init(UartId, uint32_t) override {}
+    bool read(char&) override { return false; }
+    void write(char t_c) override { dataRegister = static_cast<std::uint8_t>(t_c); }
+};
+
+// Manager methods lived in their own translation unit: noinline stands in for that
+class OldWatchdogManager
+{
+  public:
+    __attribute__((noinline)) void initialize() { m_watchdog = new (m_storage) VirtualWatchdog; }
+
+    __attribute__((noinline)) void feed()
+    {
+        if (m_watchdog)
+        {
+            m_watchdog->feed();
+        }
+    }
+
+  private:
+    alignas(std::uint32_t) std::byte m_storage[sizeof(std::uint32_t) * 8];
+    IWatchdog* m_watchdog = nullptr;
+};
+
+class OldUartManager
+{
+  public:
+    __attribute__((noinline)) void initialize() { m_uart = new (m_storage) VirtualUart; }
+
+    __attribute__((noinline)) void write(char t_c)
+    {
+        if (m_uart)
+        {
+            m_uart->write(t_c);
+        }
+    }
+
+  private:
+    alignas(VirtualUart) std::byte m_storage[sizeof(VirtualUart)];
+    IConsoleUart* m_uart = nullptr;
+};
+
+// Current binding
+struct RegisterWatchdog
+{
+    void start(std::uint32_t) {}
+    void feed() { keyRegister = 0xAAAA; }
+};
+
+class RegisterUart final : public IConsoleUart
+{
+  public:
+    void init(UartId, uint32_t) override {}
+    bool read(char&) override { return false; }
+    void write(char t_c) override { dataRegister = static_cast<std::uint8_t>(t_c); }
+
+    void write(const char* t_str)
+    {
+        while (*t_str)
+        {
+            write(*t_str++);
+        }
+    }
+};
+
+struct BenchTraits
+{
+    using Watchdog = RegisterWatchdog;
+    using Uart     = RegisterUart;
+};
+
+constexpr int CALLS = 100000000;
+
+template <typename Call>
+double nsPerCall(Call&& t_call)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < CALLS; ++i)
+    {
+        t_call(i);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+               .count() /
+           CALLS;
+}
+
+OldWatchdogManager            oldWatchdog;
+OldUartManager                oldUart;
+PlatformWatchdog<BenchTraits> watchdog;
+PlatformUart<BenchTraits>     uart;
+
+} // namespace
+
+int main()
+{
+    oldWatchdog.initialize();
+    oldUart.initialize();
+    watchdog.initialize(1000);
+    uart.initialize(UartId::Uart2, 115200);
+
+    std::printf("%-16s %14s %14s\n", "call", "virtual [ns]", "template [ns]");
+    std::printf("%-16s %14.3f %14.3f\n", "watchdog.feed()",
+                nsPerCall([](int) { oldWatchdog.feed(); }),
+                nsPerCall([](int) { watchdog.feed(); }));
+    std::printf("%-16s %14.3f %14.3f\n", "uart.write(c)",
+                nsPerCall([](int t_i) { oldUart.write(static_cast<char>(t_i)); }),
+                nsPerCall([](int t_i) { uart.write(static_cast<char>(t_i)); }));
+    return 0;
+}
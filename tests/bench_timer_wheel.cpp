@@ -0,0 +1,154 @@
+// Per-tick cost of TimerWheel against a linear scan of every timer, from 100 to 10k
+// periodic timers (1 tick = 1 ms). With periods of 10 ms to 60 s more timers also fire
+// more often; periods of count * 3 .. 6 ms keep the firing rate constant and show
+// what the number of pending timers alone costs.
+// Host only, not part of run_tests: build the bench_timer_wheel target and run it.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "timer_wheel.hpp"
+
+namespace
+{
+constexpr std::uint32_t TICKS = 200000; // 200 s of wheel time
+
+volatile std::uint32_t fired = 0;
+
+void onFire(void*)
+{
+    fired = fired + 1;
+}
+
+// What a flat timer table costs: every tick looks at every timer
+class ScanTimers
+{
+  public:
+    void add(std::uint32_t t_expires, std::uint32_t t_period)
+    {
+        m_timers.push_back({t_expires, t_period});
+    }
+
+    void tick(std::uint32_t t_now)
+    {
+        for (Entry& timer : m_timers)
+        {
+            if (timer.expires == t_now)
+            {
+                timer.expires += timer.period;
+                onFire(nullptr);
+            }
+        }
+    }
+
+  private:
+    struct Entry
+    {
+        std::uint32_t expires;
+        std::uint32_t period;
+    };
+
+    std::vector<Entry> m_timers;
+};
+
+std::vector<std::uint32_t> periods(std::size_t t_count, std::uint32_t t_shortest,
+                                   std::uint32_t t_longest)
+{
+    std::mt19937                                 random(7);
+    std::uniform_int_distribution<std::uint32_t> period(t_shortest, t_longest);
+
+    std::vector<std::uint32_t> result(t_count);
+    for (std::uint32_t& each : result)
+    {
+        each = period(random);
+    }
+    return result;
+}
+
+template <class TBody>
+double nsPerTick(TBody t_body)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint32_t tick = 1; tick <= TICKS; ++tick)
+    {
+        t_body(tick);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / TICKS;
+}
+
+struct Result
+{
+    double wheelNs;
+    double scanNs;
+    double startStopNs;
+    double firedPerTick;
+    double wakeups; // Tickless: advanceTo() calls needed, as a share of TICKS
+};
+
+Result measure(std::size_t t_count, std::uint32_t t_shortest, std::uint32_t t_longest)
+{
+    const std::vector<std::uint32_t> period = periods(t_count, t_shortest, t_longest);
+
+    TimerWheel<4>          wheel;
+    std::vector<SoftTimer> timers(t_count);
+    ScanTimers             scan;
+    for (std::size_t i = 0; i < t_count; ++i)
+    {
+        wheel.startAt(timers[i], period[i], &onFire, nullptr, period[i]);
+        scan.add(period[i], period[i]);
+    }
+
+    Result result{};
+    fired               = 0;
+    result.wheelNs      = nsPerTick([&wheel](std::uint32_t t_tick) { wheel.advanceTo(t_tick); });
+    result.firedPerTick = static_cast<double>(fired) / TICKS;
+    result.scanNs       = nsPerTick([&scan](std::uint32_t t_tick) { scan.tick(t_tick); });
+
+    // Restart each timer in place: unlink plus link
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < t_count; ++i)
+    {
+        wheel.start(timers[i], period[i], &onFire, nullptr, period[i]);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    result.startStopNs = std::chrono::duration<double, std::nano>(elapsed).count() / t_count;
+
+    // Tickless: jump from one event to the next for the same span of time
+    const std::uint32_t end     = wheel.now() + TICKS;
+    std::uint32_t       wakeups = 0;
+    while (static_cast<std::int32_t>(end - wheel.now()) > 0)
+    {
+        const std::uint32_t step = wheel.ticksToNextEvent();
+        wheel.advanceTo(wheel.now() + ((step < end - wheel.now()) ? step : end - wheel.now()));
+        wakeups++;
+    }
+    result.wakeups = static_cast<double>(wakeups) / TICKS;
+    return result;
+}
+
+} // namespace
+
+int main()
+{
+    const auto table = [](const char* t_title, bool t_scaled)
+    {
+        std::printf("%s\n%8s %12s %12s %14s %12s %10s\n", t_title, "timers", "wheel [ns]",
+                    "scan [ns]", "restart [ns]", "fired/tick", "wakeups");
+
+        for (const std::size_t count : {100, 1000, 10000})
+        {
+            const auto   shortest = static_cast<std::uint32_t>(t_scaled ? count * 3 : 10);
+            const auto   longest  = static_cast<std::uint32_t>(t_scaled ? count * 6 : 60000);
+            const Result result   = measure(count, shortest, longest);
+            std::printf("%8zu %12.1f %12.1f %14.1f %12.3f %9.1f%%\n", count, result.wheelNs,
+                        result.scanNs, result.startStopNs, result.firedPerTick,
+                        result.wakeups * 100);
+        }
+    };
+
+    table("Periods 10 ms .. 60 s", false);
+    table("Periods count * 3 .. 6 ms (constant firing rate)", true);
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file      tests/coro_host.hpp
+ * @author    it32bit
+ * @brief     Host executor for coroutine tests: frame pool, manual timer wheel and a loop.
+ *
+ * @details   CoroHost plays the App's part: its Executor's wake hook counts wakeups where
+ *            the target posts LoopEvent::Coroutines, runUntilIdle() stands in for the
+ *            event loop, and advance() moves a TimerWheel that Coro::Delay starts its
+ *            timers on (CoroHost::startTimer matches StartSoftTimer).
+ *
+ *            The frame allocator hooks are defined here, so include this header from one
+ *            translation unit per executable.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef CORO_HOST_HPP
+#define CORO_HOST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "coro_task.hpp"
+#include "timer_wheel.hpp"
+
+class CoroHost
+{
+  public:
+    using Frames = Coro::FramePool<8, 512>;
+
+    CoroHost() : executor(&CoroHost::onWake, this) { s_current = this; }
+    ~CoroHost() { s_current = nullptr; }
+
+    CoroHost(const CoroHost&)            = delete;
+    CoroHost& operator=(const CoroHost&) = delete;
+
+    /** @brief Resume ready coroutines until none is left; returns the resumptions. */
+    std::size_t runUntilIdle()
+    {
+        std::size_t resumed = 0;
+        while (executor.hasReady())
+        {
+            resumed += executor.runReady();
+        }
+        return resumed;
+    }
+
+    /** @brief Move the wheel t_ticks ahead, then let woken coroutines run. */
+    void advance(std::uint32_t t_ticks)
+    {
+        wheel.advanceTo(wheel.now() + t_ticks);
+        runUntilIdle();
+    }
+
+    static void startTimer(SoftTimer& t_timer, std::uint32_t t_delay,
+                           SoftTimerCallback t_callback, void* t_context, std::uint32_t t_period)
+    {
+        s_current->wheel.start(t_timer, t_delay, t_callback, t_context, t_period);
+    }
+
+    static Frames& frames() { return s_frames; }
+
+    Coro::Executor executor;
+    TimerWheel<4>  wheel;
+    std::size_t    wakeups{0};
+
+  private:
+    static void onWake(void* t_host) { static_cast<CoroHost*>(t_host)->wakeups++; }
+
+    static inline CoroHost* s_current{nullptr};
+    static inline Frames    s_frames;
+};
+
+void* Coro::allocateFrame(std::size_t t_size)
+{
+    return CoroHost::frames().allocate(t_size);
+}
+
+void Coro::releaseFrame(void* t_frame)
+{
+    CoroHost::frames().release(t_frame);
+}
+
+#endif // CORO_HOST_HPP
@@ -0,0 +1,111 @@
+/**
+ * @file      tests/dma_host.hpp
+ * @author    it32bit
+ * @brief     IDmaChannel that completes transfers synchronously, for host tests.
+ *
+ * @details   start() moves the data at once and calls back before returning. The
+ *            "peripheral" is a plain variable: memory to peripheral transfers also
+ *            append every item written to it to written(), so a test can check what a
+ *            UART would have sent. Circular and double-buffer transfers run one pass
+ *            per start()/nextPass() and stay busy until stop().
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef DMA_HOST_HPP
+#define DMA_HOST_HPP
+
+#include <cstring>
+#include <vector>
+#include "pil_dma.hpp"
+
+class DmaChannelHost : public IDmaChannel
+{
+  public:
+    bool start(const DmaTransfer& t_transfer) override
+    {
+        if (m_busy || (t_transfer.count == 0) ||
+            ((t_transfer.direction == DmaDirection::MemoryToMemory) &&
+             (t_transfer.circular || (t_transfer.memory1 != nullptr))))
+        {
+            return false;
+        }
+        m_transfer = t_transfer;
+        m_busy     = true;
+        m_buffer   = 0;
+        ++m_starts;
+        nextPass();
+        return true;
+    }
+
+    void stop() override { m_busy = false; }
+    bool isBusy() const override { return m_busy; }
+    std::uint16_t remaining() const override { return m_busy ? m_transfer.count : 0; }
+    std::uint8_t  activeBuffer() const override { return m_buffer; }
+
+    /** @brief Run the next pass of a circular or double-buffer transfer. */
+    void nextPass()
+    {
+        if (!m_busy)
+        {
+            return;
+        }
+
+        const bool  repeats = m_transfer.circular || (m_transfer.memory1 != nullptr);
+        const auto  size    = std::size_t{1} << static_cast<unsigned>(m_transfer.width);
+        auto* const memory  = static_cast<std::uint8_t*>(
+            ((m_buffer == 1) && (m_transfer.memory1 != nullptr)) ? m_transfer.memory1
+                                                                 : m_transfer.memory);
+        auto* const peripheral =
+            static_cast<std::uint8_t*>(const_cast<void*>(m_transfer.peripheral));
+
+        for (std::size_t i = 0; i < m_transfer.count; ++i)
+        {
+            switch (m_transfer.direction)
+            {
+                case DmaDirection::PeripheralToMemory:
+                    std::memcpy(memory + i * size, peripheral, size);
+                    break;
+                case DmaDirection::MemoryToPeripheral:
+                    std::memcpy(peripheral, memory + i * size, size);
+                    m_written.insert(m_written.end(), memory + i * size, memory + (i + 1) * size);
+                    break;
+                case DmaDirection::MemoryToMemory:
+                    std::memcpy(memory + i * size, peripheral + i * size, size);
+                    break;
+            }
+        }
+
+        // As on the target: at completion the DMA already fills the other buffer
+        if (m_transfer.memory1 != nullptr)
+        {
+            m_buffer ^= 1;
+        }
+        m_busy = repeats;
+        notify(DmaEvent::HalfComplete);
+        notify(DmaEvent::Complete);
+    }
+
+    const std::vector<std::uint8_t>& written() const { return m_written; }
+    std::size_t                      starts() const { return m_starts; }
+
+  private:
+    void notify(DmaEvent t_event)
+    {
+        if ((m_transfer.callback != nullptr) &&
+            ((t_event != DmaEvent::HalfComplete) || m_transfer.halfComplete))
+        {
+            m_transfer.callback(m_transfer.context, t_event);
+        }
+    }
+
+    DmaTransfer               m_transfer{};
+    bool                      m_busy{false};
+    std::uint8_t              m_buffer{0};
+    std::size_t               m_starts{0};
+    std::vector<std::uint8_t> m_written;
+};
+
+#endif // DMA_HOST_HPP
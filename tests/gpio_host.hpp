@@ -0,0 +1,113 @@
+/**
+ * @file      tests/gpio_host.hpp
+ * @author    it32bit
+ * @brief     Register model of the STM32F4 GPIO ports for host builds of StaticPin and PinGroup.
+ *
+ * @details   Only the registers StaticPin touches. BSRR behaves as on the part: its low
+ *            half sets ODR bits, its high half resets them, and set wins when both are
+ *            given. Every access is counted so tests can assert the register traffic.
+ *            IDR mirrors ODR unless a test drives it through inputs.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef GPIO_HOST_HPP
+#define GPIO_HOST_HPP
+
+#include <array>
+#include <cstdint>
+#include "gpio_static_stm32.hpp"
+
+class HostGpioPort
+{
+  public:
+    class Odr
+    {
+      public:
+        explicit Odr(HostGpioPort& t_port) : m_port(t_port) {}
+
+        operator std::uint32_t() const
+        {
+            m_port.reads++;
+            return m_port.odr;
+        }
+
+      private:
+        HostGpioPort& m_port;
+    };
+
+    class Idr
+    {
+      public:
+        explicit Idr(HostGpioPort& t_port) : m_port(t_port) {}
+
+        operator std::uint32_t() const
+        {
+            m_port.reads++;
+            return (m_port.odr & ~m_port.inputMask) | (m_port.inputs & m_port.inputMask);
+        }
+
+      private:
+        HostGpioPort& m_port;
+    };
+
+    class Bsrr
+    {
+      public:
+        explicit Bsrr(HostGpioPort& t_port) : m_port(t_port) {}
+
+        Bsrr& operator=(std::uint32_t t_value)
+        {
+            m_port.writes++;
+            m_port.odr = (m_port.odr & ~(t_value >> 16)) | (t_value & 0xFFFFU);
+            return *this;
+        }
+
+      private:
+        HostGpioPort& m_port;
+    };
+
+    HostGpioPort() = default;
+
+    HostGpioPort(const HostGpioPort&)            = delete;
+    HostGpioPort& operator=(const HostGpioPort&) = delete;
+
+    Odr  ODR{*this};
+    Idr  IDR{*this};
+    Bsrr BSRR{*this};
+
+    std::uint32_t odr{0};
+    std::uint32_t inputs{0};    // Levels driven from outside on inputMask pins
+    std::uint32_t inputMask{0};
+    int           reads{0};
+    int           writes{0};
+};
+
+struct HostGpioPorts
+{
+    static HostGpioPort* port(std::uint8_t t_index) { return &ports[t_index]; }
+
+    static void clear()
+    {
+        for (HostGpioPort& port : ports)
+        {
+            port.odr       = 0;
+            port.inputs    = 0;
+            port.inputMask = 0;
+            port.reads     = 0;
+            port.writes    = 0;
+        }
+    }
+
+    static inline std::array<HostGpioPort, GPIO_PORT_COUNT_STM32> ports{};
+};
+
+template <PinId TId>
+using HostPin = StaticPin<TId, HostGpioPorts>;
+
+template <PinId... TIds>
+using HostPinGroup = PinGroup<HostGpioPorts, TIds...>;
+
+#endif // GPIO_HOST_HPP
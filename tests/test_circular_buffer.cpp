@@ -0,0 +1,163 @@
+#include <array>
+#include <cstdint>
+#include <thread>
+#include "CppUTest/TestHarness.h"
+#include "circular_buffer.hpp"
+
+namespace
+{
+int observedSum   = 0;
+int observedCalls = 0;
+
+void sumObserver(int t_item)
+{
+    observedSum += t_item;
+}
+
+void countObserver(int)
+{
+    ++observedCalls;
+}
+} // namespace
+
+TEST_GROUP(CircularBuffer){};
+
+TEST(CircularBuffer, UsesEverySlotAndReportsFull)
+{
+    CircularBuffer<std::uint8_t, 4> buffer;
+
+    for (std::uint8_t i = 0; i < 4; ++i)
+    {
+        CHECK_TRUE(buffer.push(i));
+    }
+    CHECK_TRUE(buffer.full());
+    CHECK_FALSE(buffer.push(4));
+
+    std::uint8_t item = 0;
+    CHECK_TRUE(buffer.pop(item));
+    LONGS_EQUAL(0, item);
+    CHECK_FALSE(buffer.full());
+    CHECK_TRUE(buffer.push(4));
+
+    buffer.reset();
+    CHECK_TRUE(buffer.empty());
+    CHECK_FALSE(buffer.pop(item));
+}
+
+TEST(CircularBuffer, BulkPushAndPopWrapAround)
+{
+    CircularBuffer<int, 8> buffer;
+    std::array<int, 6>     in{1, 2, 3, 4, 5, 6};
+    std::array<int, 6>     out{};
+
+    LONGS_EQUAL(6, buffer.push(std::span<const int>(in)));
+    LONGS_EQUAL(6, buffer.pop(std::span<int>(out)));
+
+    // Head and tail now sit at index 6: the next push wraps, and only 8 fit
+    std::array<int, 10> more{10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    LONGS_EQUAL(8, buffer.push(std::span<const int>(more)));
+
+    std::array<int, 10> back{};
+    LONGS_EQUAL(8, buffer.pop(std::span<int>(back)));
+    LONGS_EQUAL(10, back[0]);
+    LONGS_EQUAL(17, back[7]);
+}
+
+TEST(CircularBuffer, PeekContiguousStopsAtArrayEnd)
+{
+    CircularBuffer<std::uint8_t, 8> buffer;
+    std::array<std::uint8_t, 6>     fill{};
+
+    buffer.push(std::span<const std::uint8_t>(fill));
+    buffer.commit(buffer.peekContiguous().size());
+
+    std::array<std::uint8_t, 4> data{'a', 'b', 'c', 'd'};
+    buffer.push(std::span<const std::uint8_t>(data));
+
+    auto first = buffer.peekContiguous();
+    LONGS_EQUAL(2, first.size());
+    BYTES_EQUAL('a', first[0]);
+    buffer.commit(first.size());
+
+    auto second = buffer.peekContiguous();
+    LONGS_EQUAL(2, second.size());
+    BYTES_EQUAL('c', second[0]);
+    buffer.commit(second.size());
+    CHECK_TRUE(buffer.empty());
+
+    auto slots = buffer.prepareContiguous();
+    LONGS_EQUAL(6, slots.size()); // Index 2 up to the array end
+    slots[0] = 'x';
+    buffer.publish(1);
+    LONGS_EQUAL(1, buffer.size());
+}
+
+TEST(CircularBuffer, ThreadedProducerConsumerKeepsOrder)
+{
+    constexpr std::uint32_t COUNT = 1000000;
+
+    static CircularBuffer<std::uint32_t, 64> buffer;
+    buffer.reset();
+
+    std::thread producer(
+        []
+        {
+            std::array<std::uint32_t, 5> chunk;
+            std::uint32_t                next = 0;
+            while (next < COUNT)
+            {
+                if (buffer.full())
+                {
+                    std::this_thread::yield(); // Keeps single-core hosts moving
+                    continue;
+                }
+                if ((next % 3) == 0)
+                {
+                    next += buffer.push(next) ? 1 : 0;
+                    continue;
+                }
+                std::size_t n = 0;
+                for (; (n < chunk.size()) && (next + n < COUNT); ++n)
+                {
+                    chunk[n] = next + static_cast<std::uint32_t>(n);
+                }
+                next += static_cast<std::uint32_t>(
+                    buffer.push(std::span<const std::uint32_t>(chunk.data(), n)));
+            }
+        });
+
+    std::uint32_t expected = 0;
+    bool          ordered  = true;
+    while (expected < COUNT)
+    {
+        auto view = buffer.peekContiguous();
+        if (view.empty())
+        {
+            std::this_thread::yield();
+        }
+        for (std::uint32_t value : view)
+        {
+            ordered = ordered && (value == expected++);
+        }
+        buffer.commit(view.size());
+    }
+    producer.join();
+
+    CHECK_TRUE(ordered);
+    CHECK_TRUE(buffer.empty());
+}
+
+TEST(CircularBuffer, StaticObserversSeeEveryPushedItem)
+{
+    CircularBuffer<int, 4, StaticObservers<sumObserver, countObserver>> buffer;
+    observedSum   = 0;
+    observedCalls = 0;
+
+    CHECK_TRUE(buffer.push(5));
+    std::array<int, 4> items{1, 2, 3, 4};
+    LONGS_EQUAL(3, buffer.push(std::span<const int>(items)));
+    CHECK_FALSE(buffer.push(9)); // Rejected items are not reported
+
+    LONGS_EQUAL(11, observedSum);
+    LONGS_EQUAL(4, observedCalls);
+}
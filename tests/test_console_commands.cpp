@@ -0,0 +1,49 @@
+#include <cstring>
+#include "CppUTest/TestHarness.h"
+#include "console_commands.hpp"
+
+namespace
+{
+void handler(const char*) {}
+
+// Same order the linker produces with SORT_BY_NAME(.console_cmd.*)
+constexpr ConsoleCommand TABLE[] = {
+    {"echo", &handler, "", 4},      {"errlog", &handler, "", 6}, {"fw_update", &handler, "", 9},
+    {"help", &handler, "", 4},      {"temp", &handler, "", 4},   {"temp_x", &handler, "", 6},
+    {"watchdog", &handler, "", 8},
+};
+
+static_assert(ConsoleCommands::isValid(TABLE));
+
+const ConsoleCommand* lookup(const char* t_token)
+{
+    return ConsoleCommands::find(TABLE, t_token, std::strlen(t_token));
+}
+} // namespace
+
+TEST_GROUP(ConsoleCommands){};
+
+TEST(ConsoleCommands, FindsEveryEntryByExactToken)
+{
+    for (const auto& command : TABLE)
+    {
+        POINTERS_EQUAL(&command, lookup(command.name));
+    }
+}
+
+TEST(ConsoleCommands, PrefixesDoNotMatch)
+{
+    POINTERS_EQUAL(nullptr, lookup("tem"));
+    POINTERS_EQUAL(nullptr, lookup("temperature_x"));
+    POINTERS_EQUAL(nullptr, lookup(""));
+    STRCMP_EQUAL("temp_x", lookup("temp_x")->name);
+}
+
+TEST(ConsoleCommands, DuplicatesAndDisorderAreRejected)
+{
+    constexpr ConsoleCommand duplicate[] = {{"help", &handler, "", 4}, {"help", &handler, "", 4}};
+    constexpr ConsoleCommand unsorted[]  = {{"temp", &handler, "", 4}, {"echo", &handler, "", 4}};
+
+    CHECK_FALSE(ConsoleCommands::isValid(duplicate));
+    CHECK_FALSE(ConsoleCommands::isValid(unsorted));
+}
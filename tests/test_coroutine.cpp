@@ -0,0 +1,231 @@
+#include <cstdint>
+#include <vector>
+#include "coro_host.hpp"
+#include "dma_host.hpp"
+#include "CppUTest/TestHarness.h"
+
+namespace
+{
+struct Trace
+{
+    std::vector<int> steps;
+};
+
+Coro::Task waitTwice(Coro::Event& t_event, Trace& t_trace)
+{
+    t_trace.steps.push_back(1);
+    co_await t_event;
+    t_trace.steps.push_back(2);
+    co_await t_event;
+    t_trace.steps.push_back(3);
+}
+
+Coro::Task sleepThenMark(std::uint32_t t_ticks, Trace& t_trace)
+{
+    co_await Coro::Delay(&CoroHost::startTimer, t_ticks);
+    t_trace.steps.push_back(static_cast<int>(t_ticks));
+}
+
+template <std::size_t TSize>
+Coro::Task readBytes(Coro::Channel<std::uint8_t, TSize>& t_channel, int t_count, Trace& t_trace)
+{
+    for (int i = 0; i < t_count; ++i)
+    {
+        t_trace.steps.push_back(co_await t_channel.receive());
+    }
+}
+
+Coro::Task copyByDma(IDmaChannel& t_channel, DmaTransfer t_transfer, DmaEvent& t_result)
+{
+    t_result = co_await Coro::DmaAwait(t_channel, t_transfer);
+}
+} // namespace
+
+TEST_GROUP(Coroutine)
+{
+    CoroHost host;
+    Trace    trace;
+
+    void teardown() override
+    {
+        CHECK_EQUAL(0u, CoroHost::frames().used()); // Every flow ran to completion
+    }
+};
+
+TEST(Coroutine, SpawnStartsOnTheNextRunAndReleasesTheFrameAtTheEnd)
+{
+    Coro::Event event;
+    CHECK_TRUE(host.executor.spawn(waitTwice(event, trace)));
+    CHECK_TRUE(trace.steps.empty());
+    CHECK_EQUAL(1u, CoroHost::frames().used());
+
+    host.runUntilIdle();
+    CHECK_EQUAL(1u, trace.steps.size());
+
+    event.set();
+    host.runUntilIdle();
+    event.set();
+    host.runUntilIdle();
+    CHECK_EQUAL(3u, trace.steps.size());
+}
+
+TEST(Coroutine, SetResumesThroughTheExecutorNotInline)
+{
+    Coro::Event event;
+    host.executor.spawn(waitTwice(event, trace));
+    host.runUntilIdle();
+    const std::size_t wakeups = host.wakeups;
+
+    event.set(); // As from an ISR: queues and wakes the loop
+    CHECK_EQUAL(1u, trace.steps.size());
+    CHECK_EQUAL(wakeups + 1, host.wakeups);
+
+    CHECK_EQUAL(1u, host.executor.runReady());
+    CHECK_EQUAL(2, trace.steps.back());
+
+    event.set();
+    host.runUntilIdle();
+}
+
+TEST(Coroutine, SetBeforeTheAwaitIsLatched)
+{
+    Coro::Event event;
+    event.set();
+    event.set(); // Binary: still one
+    CHECK_TRUE(event.isSet());
+
+    host.executor.spawn(waitTwice(event, trace));
+    host.runUntilIdle();
+    CHECK_EQUAL(2u, trace.steps.size()); // First await passed without suspending
+    CHECK_FALSE(event.isSet());
+
+    event.set();
+    host.runUntilIdle();
+    CHECK_EQUAL(3u, trace.steps.size());
+}
+
+TEST(Coroutine, DelayResumesAfterItsTicks)
+{
+    host.executor.spawn(sleepThenMark(30, trace));
+    host.executor.spawn(sleepThenMark(10, trace));
+    host.runUntilIdle();
+
+    host.advance(9);
+    CHECK_TRUE(trace.steps.empty());
+    host.advance(1);
+    CHECK_EQUAL(1u, trace.steps.size());
+    host.advance(100);
+
+    CHECK_EQUAL(2u, trace.steps.size());
+    CHECK_EQUAL(10, trace.steps[0]);
+    CHECK_EQUAL(30, trace.steps[1]);
+}
+
+TEST(Coroutine, ChannelDeliversBytesInOrder)
+{
+    Coro::Channel<std::uint8_t, 8> channel;
+    channel.push(1); // Before the reader runs
+    channel.push(2);
+
+    host.executor.spawn(readBytes(channel, 4, trace));
+    host.runUntilIdle();
+    CHECK_EQUAL(2u, trace.steps.size());
+
+    channel.push(3);
+    channel.push(4);
+    host.runUntilIdle();
+
+    CHECK_EQUAL(4u, trace.steps.size());
+    for (int i = 0; i < 4; ++i)
+    {
+        CHECK_EQUAL(i + 1, trace.steps[i]);
+    }
+}
+
+TEST(Coroutine, DmaAwaitReturnsTheCompletion)
+{
+    DmaChannelHost     dma;
+    const std::uint8_t source[4] = {1, 2, 3, 4};
+    std::uint8_t       destination[4]{};
+    DmaEvent           result = DmaEvent::HalfComplete;
+
+    host.executor.spawn(copyByDma(
+        dma, DmaTransfer::memoryToMemory(source, destination, 4, nullptr, nullptr), result));
+    host.runUntilIdle();
+
+    CHECK_TRUE(result == DmaEvent::Complete);
+    CHECK_EQUAL(4, static_cast<int>(destination[3]));
+}
+
+TEST(Coroutine, DmaAwaitReportsARefusedStart)
+{
+    DmaChannelHost dma;
+    std::uint8_t   buffer[4]{};
+    DmaEvent       result = DmaEvent::Complete;
+
+    host.executor.spawn(copyByDma(
+        dma, DmaTransfer::memoryToMemory(buffer, buffer, 0, nullptr, nullptr), result));
+    host.runUntilIdle();
+
+    CHECK_TRUE(result == DmaEvent::Error);
+}
+
+TEST(Coroutine, SubjectEventWakesOnMatchingNotifications)
+{
+    Subject            edges;
+    Coro::SubjectEvent pressed(edges, 0x1);
+
+    host.executor.spawn(waitTwice(pressed, trace));
+    host.runUntilIdle();
+
+    edges.notifyObservers(0x2); // Another pin
+    host.runUntilIdle();
+    CHECK_EQUAL(1u, trace.steps.size());
+
+    edges.notifyObservers(0x1);
+    host.runUntilIdle();
+    edges.notifyObservers(0x1);
+    host.runUntilIdle();
+    CHECK_EQUAL(3u, trace.steps.size());
+}
+
+TEST(Coroutine, ExhaustedPoolFailsTheSpawnWithoutHeap)
+{
+    Coro::Event events[CoroHost::Frames::capacity() + 1];
+    Trace       traces[CoroHost::Frames::capacity() + 1];
+
+    for (std::size_t i = 0; i < CoroHost::Frames::capacity(); ++i)
+    {
+        CHECK_TRUE(host.executor.spawn(waitTwice(events[i], traces[i])));
+    }
+    const std::size_t failed = CoroHost::frames().failed();
+    CHECK_FALSE(host.executor.spawn(waitTwice(events[CoroHost::Frames::capacity()],
+                                              traces[CoroHost::Frames::capacity()])));
+    CHECK_EQUAL(failed + 1, CoroHost::frames().failed());
+
+    for (int round = 0; round < 3; ++round)
+    {
+        host.runUntilIdle();
+        for (std::size_t i = 0; i < CoroHost::Frames::capacity(); ++i)
+        {
+            events[i].set();
+        }
+    }
+    host.runUntilIdle();
+    CHECK_EQUAL(3u, traces[0].steps.size());
+}
+
+TEST(Coroutine, SetsBeforeTheResumeQueueTheWaiterOnce)
+{
+    Coro::Event event;
+    host.executor.spawn(waitTwice(event, trace));
+    host.runUntilIdle();
+    const std::size_t wakeups = host.wakeups;
+
+    event.set();
+    event.set(); // Latched for the next await
+    CHECK_EQUAL(wakeups + 1, host.wakeups);
+
+    CHECK_EQUAL(1u, host.executor.runReady());
+    CHECK_EQUAL(3u, trace.steps.size()); // The latch let the second await through
+}
@@ -0,0 +1,199 @@
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "CppUTest/TestHarness.h"
+#include "defer_log.hpp"
+
+namespace
+{
+std::vector<std::vector<std::uint8_t>> frames;
+bool                                   sinkFull = false;
+std::uint64_t                          clock    = 0;
+
+struct Record
+{
+    std::vector<std::uint8_t> bytes;
+    std::size_t               pos{0};
+
+    std::uint64_t varint()
+    {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0;; shift += 7)
+        {
+            const std::uint8_t byte = bytes.at(pos++);
+            value |= std::uint64_t{byte & 0x7FU} << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+    }
+};
+
+void checkDelimiters(const std::vector<std::uint8_t>& t_frame)
+{
+    CHECK(t_frame.size() >= 3);
+    CHECK_EQUAL(0, t_frame.front());
+    CHECK_EQUAL(0, t_frame.back());
+    CHECK(std::memchr(t_frame.data() + 1, 0, t_frame.size() - 2) == nullptr);
+}
+
+// Strip the delimiters and undo COBS
+Record decoded(const std::vector<std::uint8_t>& t_frame)
+{
+    checkDelimiters(t_frame);
+
+    Record record;
+    record.bytes.resize(t_frame.size());
+    record.bytes.resize(
+        DeferLog::cobsDecode(t_frame.data() + 1, t_frame.size() - 2, record.bytes.data()));
+    return record;
+}
+
+LOG_MODULE(TraceLog, Info);
+
+void logSample(std::uint32_t t_count, int t_delta, float t_value)
+{
+    DLOG_INFO(TraceLog, "count {} delta {} value {.1}\n", t_count, t_delta, t_value);
+    DLOG_DEBUG(TraceLog, "compiled out {}", t_count);
+}
+
+void logText(const char* t_text)
+{
+    DLOG_INFO(TraceLog, "text '{}' {}", t_text, 'c');
+}
+} // namespace
+
+bool DeferLog::writeFrame(const std::uint8_t* t_frame, std::size_t t_size)
+{
+    if (sinkFull)
+    {
+        return false;
+    }
+    frames.emplace_back(t_frame, t_frame + t_size);
+    return true;
+}
+
+std::uint64_t DeferLog::timestamp()
+{
+    return clock;
+}
+
+TEST_GROUP(DeferLog)
+{
+    void setup() override
+    {
+        frames.clear();
+        sinkFull = false;
+        clock    = 0;
+        DeferLog::Detail::state = {};
+    }
+};
+
+TEST(DeferLog, CobsRoundTripWithZerosAndLongRuns)
+{
+    std::vector<std::uint8_t> data(600);
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<std::uint8_t>((i % 97 == 0) ? 0 : i);
+    }
+
+    for (std::size_t size : {0u, 1u, 96u, 253u, 254u, 255u, 600u})
+    {
+        std::vector<std::uint8_t> frame(size + size / 254 + 3);
+        const std::size_t         length = DeferLog::cobsFrame(data.data(), size, frame.data());
+        frame.resize(length);
+
+        const Record record = decoded(frame);
+        CHECK_EQUAL(size, record.bytes.size());
+        CHECK(std::equal(record.bytes.begin(), record.bytes.end(), data.begin()));
+    }
+}
+
+TEST(DeferLog, EntryHoldsSignatureAndFormat)
+{
+    constexpr auto entry = DeferLog::makeEntry(
+        decltype(DeferLog::typesOf(1u, -1, 1.0f, 'c', "s", std::int64_t{0})){}, "{}{}{}{}{}{}");
+
+    STRCMP_EQUAL("uifcsi", entry.data());
+    STRCMP_EQUAL("{}{}{}{}{}{}", entry.data() + 7);
+}
+
+TEST(DeferLog, RecordCarriesIdTimestampDeltaAndArguments)
+{
+    clock = 1000;
+    logSample(300, -3, 2.5f);
+    clock = 1200;
+    logSample(1, 2, 0.0f);
+
+    CHECK_EQUAL(2, frames.size()); // The debug record is compiled out
+
+    Record first = decoded(frames[0]);
+    const std::uint64_t id = first.varint();
+    CHECK(id != DeferLog::OVERFLOW_ID);
+    STRCMP_EQUAL("uif", DeferLog::__start_defer_log_strings + id - 1);
+    CHECK_EQUAL(1000, first.varint());
+    CHECK_EQUAL(300, first.varint());
+    CHECK_EQUAL(5, first.varint()); // zigzag(-3)
+
+    float value;
+    std::memcpy(&value, first.bytes.data() + first.pos, sizeof(value));
+    CHECK_EQUAL(2.5f, value);
+    CHECK_EQUAL(first.pos + 4, first.bytes.size());
+
+    Record second = decoded(frames[1]);
+    CHECK_EQUAL(id, second.varint());
+    CHECK_EQUAL(200, second.varint());
+}
+
+TEST(DeferLog, DeltaSpansMoreThanOneCycleCounterPeriod)
+{
+    // 30 s apart at 168 MHz: past the wrap of a 32-bit CYCCNT, and of 2^32 itself
+    constexpr std::uint64_t GAP = 30ULL * 168000000ULL;
+
+    clock = 0xFFFFFF00;
+    logSample(1, 1, 1.0f);
+    clock += GAP;
+    logSample(2, 2, 2.0f);
+
+    Record second = decoded(frames[1]);
+    second.varint();
+    CHECK(GAP == second.varint());
+}
+
+TEST(DeferLog, StringsAreLengthPrefixedAndBounded)
+{
+    logText("0123456789012345678901234567890123456789");
+
+    Record record = decoded(frames[0]);
+    record.varint();
+    record.varint();
+    CHECK_EQUAL(DeferLog::MAX_STRING, record.varint());
+    record.pos += DeferLog::MAX_STRING;
+    CHECK_EQUAL('c', record.bytes.at(record.pos));
+}
+
+TEST(DeferLog, DroppedRecordsAreReportedOnce)
+{
+    sinkFull = true;
+    clock    = 10;
+    logSample(1, 1, 1.0f);
+    logSample(2, 2, 2.0f);
+    CHECK_EQUAL(2, DeferLog::dropped());
+
+    sinkFull = false;
+    clock    = 50;
+    logSample(3, 3, 3.0f);
+
+    CHECK_EQUAL(2, frames.size());
+    Record overflow = decoded(frames[0]);
+    CHECK_EQUAL(DeferLog::OVERFLOW_ID, overflow.varint());
+    CHECK_EQUAL(50, overflow.varint()); // Dropped records do not advance the time base
+    CHECK_EQUAL(2, overflow.varint());
+
+    Record record = decoded(frames[1]);
+    record.varint();
+    CHECK_EQUAL(0, record.varint());
+    CHECK_EQUAL(3, record.varint());
+    CHECK_EQUAL(0, DeferLog::dropped());
+}
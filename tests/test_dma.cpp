@@ -0,0 +1,203 @@
+#include <array>
+#include <cstdint>
+#include <string>
+#include "CppUTest/TestHarness.h"
+#include "dma_host.hpp"
+#include "dma_stm32.hpp"
+
+// USART1 RX and SPI1 RX both have DMA2 stream 2; the alternatives resolve it
+using SharedAlternatives = DmaAllocation<DmaRequest::Spi1Rx, DmaRequest::Usart1Rx,
+                                         DmaRequest::Usart6Rx, DmaRequest::Adc1>;
+static_assert(SharedAlternatives::route<DmaRequest::Spi1Rx>() == DmaRoute{2, 0, 3});
+static_assert(SharedAlternatives::route<DmaRequest::Usart1Rx>() == DmaRoute{2, 2, 4});
+static_assert(SharedAlternatives::route<DmaRequest::Usart6Rx>() == DmaRoute{2, 1, 5});
+static_assert(SharedAlternatives::route<DmaRequest::Adc1>() == DmaRoute{2, 4, 0});
+
+// TIM3 CH1 and TIM5 CH2 only have DMA1 stream 4
+static_assert(!isPlanValid(planDma(std::array{DmaRequest::Tim3Ch1, DmaRequest::Tim5Ch2})));
+static_assert(isPlanValid(planDma(std::array{DmaRequest::Usart2Tx, DmaRequest::Usart2Rx})));
+
+namespace
+{
+struct Events
+{
+    int complete{0};
+    int half{0};
+    int error{0};
+};
+
+void countEvent(void* t_events, DmaEvent t_event)
+{
+    auto& events = *static_cast<Events*>(t_events);
+    switch (t_event)
+    {
+        case DmaEvent::Complete:
+            ++events.complete;
+            break;
+        case DmaEvent::HalfComplete:
+            ++events.half;
+            break;
+        case DmaEvent::Error:
+            ++events.error;
+            break;
+    }
+}
+} // namespace
+
+TEST_GROUP(DmaPlan){};
+
+TEST(DmaPlan, BacktracksToTheSecondOption)
+{
+    // Usart3Tx prefers stream 3, which Spi2Rx needs
+    const auto plan = planDma(std::array{DmaRequest::Usart3Tx, DmaRequest::Spi2Rx,
+                                         DmaRequest::Uart4Rx});
+
+    CHECK_TRUE(isPlanValid(plan));
+    CHECK_EQUAL(4, static_cast<int>(plan[0].stream));
+    CHECK_EQUAL(7, static_cast<int>(plan[0].channel));
+    CHECK_EQUAL(3, static_cast<int>(plan[1].stream));
+}
+
+TEST(DmaPlan, MemoryToMemoryUsesDma2Only)
+{
+    const DmaRoutes routes = dmaRoutes(DmaRequest::MemToMem);
+
+    CHECK_EQUAL(8U, routes.count);
+    for (std::size_t i = 0; i < routes.count; ++i)
+    {
+        CHECK_EQUAL(2, static_cast<int>(routes.options[i].controller));
+    }
+}
+
+TEST(DmaPlan, RunsOutOfStreams)
+{
+    std::array<DmaRequest, 9> copies{};
+    copies.fill(DmaRequest::MemToMem);
+
+    CHECK_FALSE(isPlanValid(planDma(copies)));
+}
+
+TEST_GROUP(DmaTransfer){};
+
+TEST(DmaTransfer, WidthFollowsItemType)
+{
+    std::uint16_t samples[4]{};
+    volatile std::uint32_t dataRegister = 0;
+
+    const DmaTransfer transfer =
+        DmaTransfer::fromPeripheral(&dataRegister, samples, 4, nullptr, nullptr);
+
+    CHECK(transfer.width == DmaWidth::Bits16);
+    CHECK_EQUAL(8U, transfer.bytes());
+    CHECK_FALSE(transfer.circular);
+    CHECK_TRUE(transfer.repeating().withHalfComplete().circular);
+}
+
+TEST_GROUP(DmaChannelHost){};
+
+TEST(DmaChannelHost, MemoryToPeripheralSendsEveryItem)
+{
+    DmaChannelHost dma;
+    Events         events;
+    const char     text[] = "hello";
+    volatile char  dataRegister{};
+
+    CHECK_TRUE(dma.start(DmaTransfer::toPeripheral(&dataRegister, text, 5, &countEvent, &events)));
+
+    CHECK_EQUAL(std::string("hello"), std::string(dma.written().begin(), dma.written().end()));
+    CHECK_EQUAL('o', dataRegister);
+    CHECK_EQUAL(1, events.complete);
+    CHECK_FALSE(dma.isBusy());
+}
+
+TEST(DmaChannelHost, MemoryToMemoryCopies)
+{
+    DmaChannelHost dma;
+    const std::uint32_t source[3] = {1, 2, 3};
+    std::uint32_t       destination[3]{};
+
+    CHECK_TRUE(dma.start(DmaTransfer::memoryToMemory(source, destination, 3, nullptr, nullptr)));
+    CHECK_EQUAL(3U, destination[2]);
+    CHECK_FALSE(dma.start(DmaTransfer::memoryToMemory(source, destination, 3, nullptr, nullptr)
+                              .repeating()));
+}
+
+TEST(DmaChannelHost, CircularReportsHalvesAndStaysBusy)
+{
+    DmaChannelHost dma;
+    Events         events;
+    std::uint8_t   buffer[8]{};
+    volatile std::uint8_t dataRegister = 0x5A;
+
+    CHECK_TRUE(dma.start(DmaTransfer::fromPeripheral(&dataRegister, buffer, 8, &countEvent, &events)
+                             .repeating()
+                             .withHalfComplete()));
+    dma.nextPass();
+
+    CHECK_EQUAL(2, events.complete);
+    CHECK_EQUAL(2, events.half);
+    CHECK_EQUAL(0x5A, static_cast<int>(buffer[7]));
+    CHECK_TRUE(dma.isBusy());
+    CHECK_FALSE(dma.start(DmaTransfer::fromPeripheral(&dataRegister, buffer, 8, nullptr, nullptr)));
+
+    dma.stop();
+    CHECK_FALSE(dma.isBusy());
+}
+
+TEST(DmaChannelHost, DoubleBufferAlternates)
+{
+    DmaChannelHost dma;
+    std::uint16_t  first[2]{};
+    std::uint16_t  second[2]{};
+    volatile std::uint16_t dataRegister = 7;
+
+    CHECK_TRUE(dma.start(DmaTransfer::doubleBuffer(&dataRegister, first, second, 2, nullptr,
+                                                   nullptr)));
+    CHECK_EQUAL(1, static_cast<int>(dma.activeBuffer())); // first is full, second is being filled
+    CHECK_EQUAL(7, static_cast<int>(first[1]));
+    CHECK_EQUAL(0, static_cast<int>(second[1]));
+
+    dataRegister = 9;
+    dma.nextPass();
+    CHECK_EQUAL(0, static_cast<int>(dma.activeBuffer()));
+    CHECK_EQUAL(9, static_cast<int>(second[1]));
+}
+
+namespace
+{
+// Completion starts the next chunk from the callback, as ConsoleTx does
+struct Chunker
+{
+    DmaChannelHost* dma;
+    const char*     text;
+    std::size_t     left;
+    volatile char   dataRegister{};
+
+    void next()
+    {
+        const std::size_t size = (left < 3) ? left : 3;
+        if (size != 0)
+        {
+            const char* chunk = text;
+            text += size;
+            left -= size;
+            dma->start(DmaTransfer::toPeripheral(&dataRegister, chunk,
+                                                 static_cast<std::uint16_t>(size), &done, this));
+        }
+    }
+
+    static void done(void* t_self, DmaEvent) { static_cast<Chunker*>(t_self)->next(); }
+};
+} // namespace
+
+TEST(DmaChannelHost, CallbackCanStartTheNextTransfer)
+{
+    DmaChannelHost dma;
+    Chunker        chunker{&dma, "chained dma", 11};
+
+    chunker.next();
+
+    CHECK_EQUAL(std::string("chained dma"),
+                std::string(dma.written().begin(), dma.written().end()));
+    CHECK_EQUAL(4U, dma.starts());
+}
@@ -0,0 +1,76 @@
+#include <cstdint>
+#include <string>
+#include "CppUTest/TestHarness.h"
+#include "dma_host.hpp"
+#include "dma_tx_queue.hpp"
+
+namespace
+{
+struct HostPort
+{
+    static volatile void* dataRegister() { return &data; }
+
+    static inline volatile char data{};
+};
+
+using TestQueue = DmaTxQueue<DmaChannelHost, HostPort, 16>;
+
+std::string sent(const DmaChannelHost& t_dma)
+{
+    return std::string(t_dma.written().begin(), t_dma.written().end());
+}
+
+void write(TestQueue& t_queue, const char* t_text)
+{
+    t_queue.push(std::span<const char>(t_text, std::char_traits<char>::length(t_text)));
+    t_queue.startTransmit();
+}
+
+// A circular transfer keeps the channel busy, so every start() is refused
+void occupy(DmaChannelHost& t_dma)
+{
+    static char buffer[4];
+    DmaTransfer transfer =
+        DmaTransfer::fromPeripheral(&HostPort::data, buffer, 4, nullptr, nullptr);
+    transfer.circular = true;
+    CHECK_TRUE(t_dma.start(transfer));
+}
+} // namespace
+
+TEST_GROUP(DmaTxQueue)
+{
+    DmaChannelHost dma;
+    TestQueue      queue{dma};
+};
+
+TEST(DmaTxQueue, ChunksFollowEachOtherAcrossTheWrap)
+{
+    write(queue, "0123456789");
+    write(queue, "abcdefghij"); // Wraps the 16 byte ring
+
+    CHECK_EQUAL(std::string("0123456789abcdefghij"), sent(dma));
+    CHECK_TRUE(queue.empty());
+    CHECK_EQUAL(0U, queue.dropped());
+    CHECK_EQUAL(0U, queue.dmaErrors());
+}
+
+TEST(DmaTxQueue, RefusedStartDropsTheChunkAndCountsIt)
+{
+    occupy(dma);
+    const std::size_t starts = dma.starts();
+
+    write(queue, "lost");
+
+    CHECK_TRUE(queue.empty()); // Nothing stranded: a writer waiting for space can go on
+    CHECK_EQUAL(4U, queue.dropped());
+    CHECK_EQUAL(1U, queue.dmaErrors());
+    CHECK_EQUAL(starts, dma.starts());
+
+    // The next chunk goes out once the channel is free again
+    dma.stop();
+    write(queue, "ok");
+
+    CHECK_EQUAL(std::string("ok"), sent(dma));
+    CHECK_EQUAL(4U, queue.dropped());
+    CHECK_EQUAL(1U, queue.dmaErrors());
+}
@@ -0,0 +1,173 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "CppUTest/TestHarness.h"
+#include "ed25519_verify.hpp"
+#include "hmac_sha256.hpp"
+#include "sha256.hpp"
+#include "sha512.hpp"
+
+namespace
+{
+template <std::size_t N>
+std::array<std::uint8_t, N> fromHex(std::string_view t_hex)
+{
+    auto nibble = [](char c) -> std::uint8_t
+    { return (c <= '9') ? (c - '0') : static_cast<std::uint8_t>((c | 0x20) - 'a' + 10); };
+
+    std::array<std::uint8_t, N> out{};
+    for (std::size_t i = 0; (i < N) && (2 * i + 1 < t_hex.size()); ++i)
+    {
+        out[i] = static_cast<std::uint8_t>((nibble(t_hex[2 * i]) << 4) | nibble(t_hex[2 * i + 1]));
+    }
+    return out;
+}
+
+std::span<const std::uint8_t> asBytes(std::string_view t_text)
+{
+    return {reinterpret_cast<const std::uint8_t*>(t_text.data()), t_text.size()};
+}
+
+// RFC 8032, section 7.1, TEST 1..3
+struct Vector
+{
+    std::string_view publicKey;
+    std::string_view message;
+    std::string_view signature;
+};
+
+// clang-format off
+constexpr Vector RFC8032[] = {
+    {"d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a", "",
+     "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b"},
+    {"3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c", "72",
+     "92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00"},
+    {"fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025", "af82",
+     "6291d657deec24024827e69c3abe01a30ce548a284743a445e3680d7db5ac3ac18ff9b538d16f290ae67f760984dc6594a7c15e9716ed28dc027beceea1ec40a"},
+};
+// clang-format on
+
+bool verifyVector(const Vector& t_vector, std::array<std::uint8_t, 64> t_signature)
+{
+    const auto publicKey = fromHex<32>(t_vector.publicKey);
+    const auto message   = fromHex<2>(t_vector.message);
+
+    return Integrity::Ed25519Verifier::verify(
+        t_signature, std::span(message.data(), t_vector.message.size() / 2), publicKey);
+}
+
+} // namespace
+
+TEST_GROUP(Sha2){};
+
+TEST(Sha2, Sha256KnownAnswers)
+{
+    auto expected = fromHex<32>("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    auto digest   = Integrity::Sha256::compute(asBytes("abc"));
+    MEMCMP_EQUAL(expected.data(), digest.data(), digest.size());
+
+    expected = fromHex<32>("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    digest   = Integrity::Sha256::compute(
+        asBytes("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"));
+    MEMCMP_EQUAL(expected.data(), digest.data(), digest.size());
+}
+
+TEST(Sha2, Sha512KnownAnswers)
+{
+    auto expected = fromHex<64>("ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+                                "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+    auto digest   = Integrity::Sha512::compute(asBytes("abc"));
+    MEMCMP_EQUAL(expected.data(), digest.data(), digest.size());
+
+    expected = fromHex<64>("8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018"
+                           "501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909");
+    digest   = Integrity::Sha512::compute(
+        asBytes("abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopq"
+                  "klmnopqrlmnopqrsmnopqrstnopqrstu"));
+    MEMCMP_EQUAL(expected.data(), digest.data(), digest.size());
+}
+
+TEST(Sha2, IncrementalUpdateMatchesOneShot)
+{
+    const std::string_view text = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+    Integrity::Sha256 sha;
+    sha.update(asBytes(text.substr(0, 7)));
+    sha.update(asBytes(text.substr(7)));
+
+    auto digest   = sha.finish();
+    auto expected = Integrity::Sha256::compute(asBytes(text));
+    MEMCMP_EQUAL(expected.data(), digest.data(), digest.size());
+}
+
+// RFC 4231, test cases 2 and 6 (key longer than a block)
+TEST(Sha2, HmacSha256KnownAnswers)
+{
+    Integrity::HmacSha256 mac(asBytes("Jefe"));
+    mac.update(asBytes("what do ya want "));
+    mac.update(asBytes("for nothing?"));
+
+    auto expected = fromHex<32>("5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+    auto digest   = mac.finish();
+    MEMCMP_EQUAL(expected.data(), digest.data(), digest.size());
+
+    std::array<std::uint8_t, 131> longKey;
+    longKey.fill(0xAA);
+    Integrity::HmacSha256 longMac(longKey);
+    longMac.update(asBytes("Test Using Larger Than Block-Size Key - Hash Key First"));
+
+    expected = fromHex<32>("60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54");
+    digest   = longMac.finish();
+    MEMCMP_EQUAL(expected.data(), digest.data(), digest.size());
+}
+
+TEST_GROUP(Ed25519){};
+
+TEST(Ed25519, AcceptsRfc8032Vectors)
+{
+    for (const auto& vector : RFC8032)
+    {
+        CHECK_TRUE(verifyVector(vector, fromHex<64>(vector.signature)));
+    }
+}
+
+TEST(Ed25519, RejectsFlippedSignatureBit)
+{
+    for (const auto& vector : RFC8032)
+    {
+        auto signature = fromHex<64>(vector.signature);
+        signature[5] ^= 0x01; // R
+        CHECK_FALSE(verifyVector(vector, signature));
+
+        signature = fromHex<64>(vector.signature);
+        signature[40] ^= 0x01; // S
+        CHECK_FALSE(verifyVector(vector, signature));
+    }
+}
+
+TEST(Ed25519, RejectsWrongMessage)
+{
+    const auto publicKey = fromHex<32>(RFC8032[1].publicKey);
+    const auto signature = fromHex<64>(RFC8032[1].signature);
+    const std::array<std::uint8_t, 1> message{0x73};
+
+    CHECK_FALSE(Integrity::Ed25519Verifier::verify(signature, message, publicKey));
+}
+
+TEST(Ed25519, RejectsNonCanonicalScalar)
+{
+    // S + L verifies mathematically but is malleable and must be rejected
+    auto signature = fromHex<64>(RFC8032[0].signature);
+    const auto order =
+        fromHex<32>("edd3f55c1a631258d69cf7a2def9de1400000000000000000000000000000010");
+
+    unsigned carry = 0;
+    for (std::size_t i = 0; i < 32; ++i)
+    {
+        const unsigned sum = signature[32 + i] + order[i] + carry;
+        signature[32 + i]  = static_cast<std::uint8_t>(sum);
+        carry              = sum >> 8;
+    }
+    CHECK_FALSE(verifyVector(RFC8032[0], signature));
+}
@@ -0,0 +1,187 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "CppUTest/TestHarness.h"
+#include "erased_region_tracker.hpp"
+
+namespace
+{
+constexpr std::size_t MARKER_SIZE     = FlashLayout::CONFIG_ERASED_MARKER_SIZE;
+constexpr std::size_t ROW_WORDS       = MARKER_SIZE / 2 / sizeof(std::uint32_t);
+constexpr std::size_t REGION_SIZE     = 1024;
+constexpr std::size_t METADATA_OFFSET = REGION_SIZE - 64;
+
+constexpr std::uint32_t MARKER_ERASED = 0x45525344; // 'ERSD'
+
+// RAM-backed flash: programming can only clear bits
+class FakeFlash : public IFlashWriter
+{
+  public:
+    FakeFlash() { memory.fill(0xFF); }
+
+    void eraseSector(std::uint8_t) override { memory.fill(0xFF); }
+
+    void writeWord(std::uintptr_t t_address, std::uint32_t t_data) override
+    {
+        if (writesLeft == 0)
+        {
+            return; // Simulated reset: the write never happens
+        }
+        --writesLeft;
+        ++writes;
+
+        std::uint32_t current;
+        std::memcpy(&current, reinterpret_cast<void*>(t_address), sizeof(current));
+        current &= t_data;
+        std::memcpy(reinterpret_cast<void*>(t_address), &current, sizeof(current));
+    }
+
+    void writeImage(std::uintptr_t, std::uintptr_t, std::size_t) override {}
+
+    std::uintptr_t base() { return reinterpret_cast<std::uintptr_t>(memory.data()); }
+
+    alignas(4) std::array<std::uint8_t, MARKER_SIZE + 2 * REGION_SIZE> memory;
+    std::size_t writes{0};
+    std::size_t writesLeft{static_cast<std::size_t>(-1)};
+};
+
+struct NoLock
+{
+    NoLock() {} // Single-threaded test, nothing to mask
+};
+
+using TestTracker = ErasedRegionTracker<NoLock>;
+
+ErasedRegionTable regions(FakeFlash& t_flash)
+{
+    const std::uintptr_t boot = t_flash.base() + MARKER_SIZE;
+    const std::uintptr_t app  = boot + REGION_SIZE;
+
+    return {{{boot, REGION_SIZE, boot + METADATA_OFFSET},
+             {app, REGION_SIZE, app + METADATA_OFFSET}}};
+}
+
+std::uint8_t* regionBytes(FakeFlash& t_flash, UpdateRegion t_region)
+{
+    return t_flash.memory.data() + MARKER_SIZE + static_cast<std::size_t>(t_region) * REGION_SIZE;
+}
+
+std::uint32_t marker(FakeFlash& t_flash, UpdateRegion t_region, std::size_t t_index)
+{
+    std::uint32_t value;
+    std::memcpy(&value,
+                t_flash.memory.data() +
+                    (static_cast<std::size_t>(t_region) * ROW_WORDS + t_index) * sizeof(value),
+                sizeof(value));
+    return value;
+}
+
+// Programs a word without going through the tracker, like a debugger or an update tool
+void poke(std::uint8_t* t_address, std::uint32_t t_value)
+{
+    std::memcpy(t_address, &t_value, sizeof(t_value));
+}
+
+} // namespace
+
+TEST_GROUP(ErasedRegionTracker)
+{
+    FakeFlash   flash;
+    TestTracker tracker{&flash, flash.base(), regions(flash)};
+};
+
+TEST(ErasedRegionTracker, ScanOfBlankRegionRecordsMarkerOnce)
+{
+    CHECK_TRUE(tracker.isErased(UpdateRegion::NewApp));
+    LONGS_EQUAL(MARKER_ERASED, marker(flash, UpdateRegion::NewApp, 0));
+    LONGS_EQUAL(0xFFFFFFFF, marker(flash, UpdateRegion::NewBootloader2, 0));
+
+    const std::size_t writes = flash.writes;
+    CHECK_TRUE(tracker.isErased(UpdateRegion::NewApp));
+    CHECK_EQUAL(writes, flash.writes);
+    LONGS_EQUAL(0xFFFFFFFF, marker(flash, UpdateRegion::NewApp, 1));
+}
+
+TEST(ErasedRegionTracker, InvalidatedMarkerForcesFullScan)
+{
+    tracker.markErased(UpdateRegion::NewApp);
+    tracker.invalidate(UpdateRegion::NewApp);
+    LONGS_EQUAL(0x00000000, marker(flash, UpdateRegion::NewApp, 0));
+
+    // Data away from the spot-checked words is only found by the full scan
+    poke(regionBytes(flash, UpdateRegion::NewApp) + REGION_SIZE / 2, 0x12345678);
+    CHECK_FALSE(tracker.isErased(UpdateRegion::NewApp));
+    LONGS_EQUAL(0xFFFFFFFF, marker(flash, UpdateRegion::NewApp, 1));
+
+    // Erased again: the next scan appends a fresh marker after the revoked one
+    std::memset(regionBytes(flash, UpdateRegion::NewApp), 0xFF, REGION_SIZE);
+    CHECK_TRUE(tracker.isErased(UpdateRegion::NewApp));
+    LONGS_EQUAL(MARKER_ERASED, marker(flash, UpdateRegion::NewApp, 1));
+}
+
+TEST(ErasedRegionTracker, TornMarkerIsNeitherTrustedNorReused)
+{
+    // Reset mid-program: only some of the bits of 'ERSD' were cleared
+    poke(flash.memory.data(), MARKER_ERASED | 0x00F0000F);
+    poke(regionBytes(flash, UpdateRegion::NewBootloader2) + REGION_SIZE / 2, 0x12345678);
+
+    CHECK_FALSE(tracker.isErased(UpdateRegion::NewBootloader2));
+    LONGS_EQUAL(MARKER_ERASED | 0x00F0000F, marker(flash, UpdateRegion::NewBootloader2, 0));
+    LONGS_EQUAL(0xFFFFFFFF, marker(flash, UpdateRegion::NewBootloader2, 1));
+
+    std::memset(regionBytes(flash, UpdateRegion::NewBootloader2), 0xFF, REGION_SIZE);
+    CHECK_TRUE(tracker.isErased(UpdateRegion::NewBootloader2));
+    LONGS_EQUAL(MARKER_ERASED, marker(flash, UpdateRegion::NewBootloader2, 1));
+}
+
+TEST(ErasedRegionTracker, LostMarkerWriteCostsOneRescan)
+{
+    flash.writesLeft = 0; // Reset before the marker is programmed
+    CHECK_TRUE(tracker.isErased(UpdateRegion::NewApp));
+    LONGS_EQUAL(0xFFFFFFFF, marker(flash, UpdateRegion::NewApp, 0));
+
+    flash.writesLeft = static_cast<std::size_t>(-1);
+    CHECK_TRUE(tracker.isErased(UpdateRegion::NewApp));
+    LONGS_EQUAL(MARKER_ERASED, marker(flash, UpdateRegion::NewApp, 0));
+}
+
+TEST(ErasedRegionTracker, StaleMarkerOnWrittenImageIsRevoked)
+{
+    tracker.markErased(UpdateRegion::NewApp);
+
+    // Image programmed behind the tracker's back
+    poke(regionBytes(flash, UpdateRegion::NewApp), 0x20020000);
+    CHECK_FALSE(tracker.isErased(UpdateRegion::NewApp));
+    LONGS_EQUAL(0x00000000, marker(flash, UpdateRegion::NewApp, 0));
+
+    // Revoked for good: the first word alone no longer decides
+    std::memset(regionBytes(flash, UpdateRegion::NewApp), 0xFF, sizeof(std::uint32_t));
+    poke(regionBytes(flash, UpdateRegion::NewApp) + REGION_SIZE / 2, 0x12345678);
+    CHECK_FALSE(tracker.isErased(UpdateRegion::NewApp));
+}
+
+TEST(ErasedRegionTracker, StaleMarkerOnWrittenMetadataIsRevoked)
+{
+    tracker.markErased(UpdateRegion::NewBootloader2);
+
+    poke(regionBytes(flash, UpdateRegion::NewBootloader2) + METADATA_OFFSET, 0x4D455441);
+    CHECK_FALSE(tracker.isErased(UpdateRegion::NewBootloader2));
+    LONGS_EQUAL(0x00000000, marker(flash, UpdateRegion::NewBootloader2, 0));
+}
+
+TEST(ErasedRegionTracker, FullRowFallsBackToScanning)
+{
+    for (std::size_t i = 0; i < ROW_WORDS; ++i)
+    {
+        tracker.markErased(UpdateRegion::NewApp);
+        tracker.invalidate(UpdateRegion::NewApp);
+    }
+    LONGS_EQUAL(0x00000000, marker(flash, UpdateRegion::NewApp, ROW_WORDS - 1));
+
+    const std::size_t writes = flash.writes;
+    CHECK_TRUE(tracker.isErased(UpdateRegion::NewApp));
+    CHECK_EQUAL(writes, flash.writes); // Nothing spills into the next row
+
+    poke(regionBytes(flash, UpdateRegion::NewApp) + REGION_SIZE / 2, 0x12345678);
+    CHECK_FALSE(tracker.isErased(UpdateRegion::NewApp));
+}
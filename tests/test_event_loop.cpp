@@ -0,0 +1,225 @@
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "CppUTest/TestHarness.h"
+#include "event_loop.hpp"
+#include "timebase_host.hpp"
+
+namespace
+{
+enum class TestEvent : std::uint8_t
+{
+    High,
+    Middle,
+    Low,
+    Count
+};
+
+// Stands in for WFI: the "interrupt" that ends the sleep is onWake
+struct IdleFake
+{
+    static void sleep(const std::atomic<std::uint32_t>& t_pending)
+    {
+        ++calls;
+        if ((t_pending.load() == 0) && (onWake != nullptr))
+        {
+            onWake();
+        }
+    }
+
+    static inline int calls{0};
+    static inline void (*onWake)(){nullptr};
+};
+
+// A task-blocking policy: post() kicks it through wake()
+struct IdleWakeable
+{
+    static void sleep(const std::atomic<std::uint32_t>&) {}
+    static void wake() { ++wakes; }
+
+    static inline int wakes{0};
+};
+
+using TestLoop = EventLoop<TestEvent, IdleFake>;
+
+ManualTimebase*         fakeClock;
+TestLoop*               loop;
+std::vector<TestEvent>* order;
+
+void record(void* t_event)
+{
+    order->push_back(*static_cast<TestEvent*>(t_event));
+}
+
+TestEvent high{TestEvent::High};
+TestEvent middle{TestEvent::Middle};
+TestEvent low{TestEvent::Low};
+} // namespace
+
+TEST_GROUP(EventLoop)
+{
+    ManualTimebase         timebase;
+    TestLoop               eventLoop{timebase};
+    std::vector<TestEvent> dispatched;
+
+    void setup() override
+    {
+        fakeClock        = &timebase;
+        loop             = &eventLoop;
+        order            = &dispatched;
+        IdleFake::calls  = 0;
+        IdleFake::onWake = nullptr;
+
+        eventLoop.subscribe(TestEvent::High, &record, &high);
+        eventLoop.subscribe(TestEvent::Middle, &record, &middle);
+        eventLoop.subscribe(TestEvent::Low, &record, &low);
+    }
+};
+
+TEST(EventLoop, NothingPendingDispatchesNothing)
+{
+    CHECK_FALSE(eventLoop.dispatchOne());
+    CHECK_TRUE(dispatched.empty());
+}
+
+TEST(EventLoop, DispatchesInPriorityOrder)
+{
+    eventLoop.post(TestEvent::Low);
+    eventLoop.post(TestEvent::High);
+    eventLoop.post(TestEvent::Middle);
+
+    eventLoop.runOnce();
+
+    CHECK_EQUAL(3u, dispatched.size());
+    CHECK(dispatched[0] == TestEvent::High);
+    CHECK(dispatched[1] == TestEvent::Middle);
+    CHECK(dispatched[2] == TestEvent::Low);
+}
+
+TEST(EventLoop, RepeatedPostsCoalesce)
+{
+    eventLoop.post(TestEvent::Middle);
+    eventLoop.post(TestEvent::Middle);
+
+    eventLoop.runOnce();
+
+    CHECK_EQUAL(1u, dispatched.size());
+    CHECK_FALSE(eventLoop.isPending(TestEvent::Middle));
+}
+
+TEST(EventLoop, HigherEventPostedByHandlerOvertakesPendingLowerOne)
+{
+    eventLoop.subscribe(
+        TestEvent::Middle,
+        [](void*)
+        {
+            order->push_back(TestEvent::Middle);
+            loop->post(TestEvent::High);
+        });
+
+    eventLoop.post(TestEvent::Middle);
+    eventLoop.post(TestEvent::Low);
+    eventLoop.runOnce();
+
+    CHECK_EQUAL(3u, dispatched.size());
+    CHECK(dispatched[1] == TestEvent::High);
+    CHECK(dispatched[2] == TestEvent::Low);
+}
+
+TEST(EventLoop, SleepsOnlyAfterEverythingIsDispatched)
+{
+    eventLoop.post(TestEvent::Low);
+    eventLoop.runOnce();
+
+    CHECK_EQUAL(1, IdleFake::calls);
+    CHECK_EQUAL(1u, eventLoop.sleeps());
+    CHECK_EQUAL(1u, dispatched.size());
+}
+
+TEST(EventLoop, IdleHookRunsBeforeTheSleep)
+{
+    eventLoop.setIdleHook([](void*) { order->push_back(TestEvent::Count); });
+    IdleFake::onWake = []() { CHECK_EQUAL(1u, order->size()); };
+
+    eventLoop.runOnce();
+
+    CHECK_EQUAL(1, IdleFake::calls);
+    CHECK_EQUAL(1u, dispatched.size());
+    CHECK(dispatched[0] == TestEvent::Count);
+}
+
+TEST(EventLoop, SleepTimeIsAccounted)
+{
+    IdleFake::onWake = []()
+    {
+        fakeClock->cycles += 500000; // 5 ms asleep, then an interrupt posts
+        loop->post(TestEvent::High);
+    };
+
+    eventLoop.runOnce();
+
+    CHECK_EQUAL(5000u, eventLoop.sleptUs());
+    CHECK_TRUE(eventLoop.isPending(TestEvent::High));
+}
+
+TEST(EventLoop, LatencyIsMeasuredFromTheFirstPost)
+{
+    timebase.cycles = 1000;
+    eventLoop.post(TestEvent::Middle);
+    timebase.cycles = 1300;
+    eventLoop.post(TestEvent::Middle); // Coalesced, keeps the first stamp
+    timebase.cycles = 1400;
+
+    CHECK_TRUE(eventLoop.dispatchOne());
+
+    const EventStats& stats = eventLoop.stats(TestEvent::Middle);
+    CHECK_EQUAL(1u, stats.dispatched);
+    CHECK_EQUAL(400u, stats.latencyMax);
+    CHECK_EQUAL(400u, stats.latencyTotal);
+}
+
+TEST(EventLoop, RunTimeAndMaximumLatencyAreKept)
+{
+    eventLoop.subscribe(TestEvent::Low, [](void*) { fakeClock->cycles += 250; });
+
+    eventLoop.post(TestEvent::Low);
+    timebase.cycles += 50;
+    eventLoop.dispatchOne();
+    eventLoop.post(TestEvent::Low);
+    timebase.cycles += 20;
+    eventLoop.dispatchOne();
+
+    const EventStats& stats = eventLoop.stats(TestEvent::Low);
+    CHECK_EQUAL(2u, stats.dispatched);
+    CHECK_EQUAL(50u, stats.latencyMax);
+    CHECK_EQUAL(70u, stats.latencyTotal);
+    CHECK_EQUAL(250u, stats.runMax);
+}
+
+TEST(EventLoop, ResetStatsStartsANewPeriod)
+{
+    eventLoop.post(TestEvent::High);
+    eventLoop.runOnce();
+    timebase.cycles = 100000;
+
+    eventLoop.resetStats();
+
+    CHECK_EQUAL(0u, eventLoop.stats(TestEvent::High).dispatched);
+    CHECK_EQUAL(0u, eventLoop.sleeps());
+    CHECK_EQUAL(0u, eventLoop.statsPeriodUs());
+}
+
+TEST(EventLoop, WakeIsCalledWhenTheFirstEventBecomesPending)
+{
+    EventLoop<TestEvent, IdleWakeable> taskLoop{timebase};
+    IdleWakeable::wakes = 0;
+
+    taskLoop.post(TestEvent::Low);
+    taskLoop.post(TestEvent::High);
+    taskLoop.post(TestEvent::Low);
+    CHECK_EQUAL(1, IdleWakeable::wakes);
+
+    taskLoop.runOnce();
+    taskLoop.post(TestEvent::Middle);
+    CHECK_EQUAL(2, IdleWakeable::wakes);
+}
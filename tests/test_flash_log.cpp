@@ -0,0 +1,393 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "CppUTest/TestHarness.h"
+#include "crash_record.hpp"
+#include "event_log.hpp"
+#include "flash_log.hpp"
+
+namespace
+{
+constexpr std::size_t  SECTOR_SIZE = 16 * 1024;
+constexpr std::uint8_t SECTOR      = 2;
+
+// RAM-backed flash: programming can only clear bits, erase sets the whole sector to 0xFF
+class FakeFlash : public IFlashWriter
+{
+  public:
+    FakeFlash() { memory.fill(0xFF); }
+
+    void eraseSector(std::uint8_t t_sector) override
+    {
+        if (t_sector == SECTOR)
+        {
+            memory.fill(0xFF);
+            ++erases;
+        }
+    }
+
+    void writeWord(std::uintptr_t t_address, std::uint32_t t_data) override
+    {
+        if (writesLeft == 0)
+        {
+            return; // Simulated reset: the write never happens
+        }
+        --writesLeft;
+
+        std::uint32_t current;
+        std::memcpy(&current, reinterpret_cast<void*>(t_address), sizeof(current));
+        current &= t_data;
+        std::memcpy(reinterpret_cast<void*>(t_address), &current, sizeof(current));
+    }
+
+    void writeImage(std::uintptr_t, std::uintptr_t, std::size_t) override {}
+
+    std::uintptr_t base() { return reinterpret_cast<std::uintptr_t>(memory.data()); }
+
+    alignas(4) std::array<std::uint8_t, SECTOR_SIZE> memory;
+    std::size_t erases{0};
+    std::size_t writesLeft{static_cast<std::size_t>(-1)};
+};
+
+std::vector<std::uint32_t> collect(const Log::FlashLog& t_log)
+{
+    std::vector<std::uint32_t> values;
+    t_log.forEach(
+        [&](std::uint8_t t_type, std::span<const std::uint8_t> t_payload)
+        {
+            std::uint32_t value = 0;
+            std::memcpy(&value, t_payload.data(), sizeof(value));
+            values.push_back((static_cast<std::uint32_t>(t_type) << 24) | value);
+        });
+    return values;
+}
+
+bool appendValue(Log::FlashLog& t_log, std::uint8_t t_type, std::uint32_t t_value)
+{
+    std::array<std::uint8_t, 4> payload;
+    std::memcpy(payload.data(), &t_value, sizeof(t_value));
+    return t_log.append(t_type, payload);
+}
+
+std::uint32_t fakeTime = 0;
+
+std::uint32_t fakeClock()
+{
+    return fakeTime;
+}
+
+struct NoLock
+{
+    NoLock() {} // Single-threaded test, nothing to mask
+};
+
+using TestEventLog = Log::EventLog<8, NoLock>;
+
+std::vector<Log::Event> collectEvents(const Log::FlashLog& t_log)
+{
+    std::vector<Log::Event> events;
+    t_log.forEach(
+        [&](std::uint8_t t_type, std::span<const std::uint8_t> t_payload)
+        {
+            if (t_type != static_cast<std::uint8_t>(Log::RecordType::Event))
+            {
+                return;
+            }
+            for (std::size_t i = 0; i + sizeof(Log::Event) <= t_payload.size(); i += sizeof(Log::Event))
+            {
+                Log::Event event;
+                std::memcpy(&event, t_payload.data() + i, sizeof(event));
+                events.push_back(event);
+            }
+        });
+    return events;
+}
+
+// Snapshot as FaultCapture_Save leaves it for the next boot
+Log::CrashRecord makeCrash()
+{
+    Log::CrashRecord record{};
+    record.magic     = Log::CRASH_MAGIC;
+    record.exception = 3; // HardFault
+    record.r0        = 0x10000000;
+    record.r1        = 0x11111111;
+    record.r2        = 0x22222222;
+    record.r3        = 0x33333333;
+    record.r12       = 0xCCCCCCCC;
+    record.lr        = 0x08021235;
+    record.pc        = 0x08021AF2;
+    record.xpsr      = 0x61000000;
+    record.excReturn = 0xFFFFFFFD;
+    record.sp        = 0x2001FF80;
+    record.cfsr      = 0x00000400;
+    record.hfsr      = 0x40000000;
+    record.uptimeMs  = 123456;
+
+    record.stackWords = 2;
+    record.stack[0]   = 0xDEADBEEF;
+    record.stack[1]   = 0x0800C0DE;
+
+    record.check = Log::crashRecordCheck(record);
+    return record;
+}
+
+} // namespace
+
+TEST_GROUP(FlashLog)
+{
+    FakeFlash flash;
+};
+
+TEST(FlashLog, RecordsSurviveRemount)
+{
+    Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    log.mount();
+
+    CHECK_TRUE(appendValue(log, 1, 100));
+    CHECK_TRUE(appendValue(log, 2, 200));
+
+    Log::FlashLog again(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    again.mount();
+    CHECK_TRUE(appendValue(again, 3, 300));
+
+    const auto values = collect(again);
+    LONGS_EQUAL(3, values.size());
+    LONGS_EQUAL((1u << 24) | 100, values[0]);
+    LONGS_EQUAL((3u << 24) | 300, values[2]);
+    LONGS_EQUAL(0, flash.erases);
+}
+
+TEST(FlashLog, WrapsByEraseAndKeepsCounting)
+{
+    Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    log.mount();
+
+    std::array<std::uint8_t, 500> payload{};
+    for (std::size_t i = 0; i < 2 * log.pageCount() + 1; ++i)
+    {
+        CHECK_TRUE(log.append(7, payload));
+    }
+
+    LONGS_EQUAL(1, flash.erases);
+    LONGS_EQUAL(log.pageCount(), log.pageSequence(0));
+
+    Log::FlashLog again(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    again.mount();
+
+    std::size_t count = 0;
+    again.forEach([&](std::uint8_t, std::span<const std::uint8_t>) { ++count; });
+    LONGS_EQUAL(1, count);
+}
+
+TEST(FlashLog, TornRecordIsSkipped)
+{
+    Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    log.mount();
+    CHECK_TRUE(appendValue(log, 1, 100));
+
+    // Reset after the payload word, before the header commit
+    flash.writesLeft = 1;
+    appendValue(log, 2, 200);
+    flash.writesLeft = static_cast<std::size_t>(-1);
+
+    Log::FlashLog again(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    again.mount();
+    CHECK_TRUE(appendValue(again, 3, 300));
+
+    const auto values = collect(again);
+    LONGS_EQUAL(2, values.size());
+    LONGS_EQUAL((1u << 24) | 100, values[0]);
+    LONGS_EQUAL((3u << 24) | 300, values[1]);
+}
+
+TEST(FlashLog, FailedHeaderWriteClosesThePage)
+{
+    Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    log.mount();
+    CHECK_TRUE(appendValue(log, 1, 100));
+
+    // The header write fails without a reset: the same log keeps appending
+    flash.writesLeft = 1;
+    CHECK_FALSE(appendValue(log, 2, 200));
+    flash.writesLeft = static_cast<std::size_t>(-1);
+
+    CHECK_TRUE(appendValue(log, 3, 300));
+    CHECK_TRUE(log.pageSequence(1) > log.pageSequence(0));
+
+    const auto values = collect(log);
+    LONGS_EQUAL(2, values.size());
+    LONGS_EQUAL((1u << 24) | 100, values[0]);
+    LONGS_EQUAL((3u << 24) | 300, values[1]);
+}
+
+TEST_GROUP(EventLog)
+{
+    FakeFlash flash;
+
+    void setup() override { fakeTime = 0; }
+};
+
+TEST(EventLog, EventsStayInRamUntilDue)
+{
+    Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    log.mount();
+    TestEventLog events(log, fakeClock);
+
+    flash.writesLeft = 0; // Any flash access before the flush would be lost
+    fakeTime         = 10;
+    CHECK_TRUE(events.record(1, 0xAA));
+    CHECK_TRUE(events.flushIfDue(fakeTime + 1));
+    LONGS_EQUAL(1, events.pending());
+
+    flash.writesLeft = static_cast<std::size_t>(-1);
+    CHECK_TRUE(events.flushIfDue(fakeTime + TestEventLog::FLUSH_INTERVAL_MS));
+    LONGS_EQUAL(0, events.pending());
+
+    const auto stored = collectEvents(log);
+    LONGS_EQUAL(1, stored.size());
+    LONGS_EQUAL(10, stored[0].timestampMs);
+    LONGS_EQUAL(1, stored[0].id);
+    LONGS_EQUAL(0xAA, stored[0].data);
+}
+
+TEST(EventLog, BatchIsOneRecordAndOverflowLeavesSequenceGap)
+{
+    Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    log.mount();
+    TestEventLog events(log, fakeClock);
+
+    for (std::uint16_t id = 0; id < 10; ++id)
+    {
+        events.record(id);
+    }
+    LONGS_EQUAL(2, events.dropped());
+    CHECK_TRUE(events.flushIfDue(0));
+    CHECK_TRUE(events.record(42));
+    CHECK_TRUE(events.flush());
+
+    std::size_t records = 0;
+    log.forEach([&](std::uint8_t, std::span<const std::uint8_t>) { ++records; });
+    LONGS_EQUAL(2, records);
+
+    const auto stored = collectEvents(log);
+    LONGS_EQUAL(9, stored.size());
+    LONGS_EQUAL(7, stored[7].sequence);
+    LONGS_EQUAL(10, stored[8].sequence);
+    LONGS_EQUAL(42, stored[8].id);
+}
+
+TEST(EventLog, FailedCommitKeepsEventsStaged)
+{
+    Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    log.mount();
+    TestEventLog events(log, fakeClock);
+
+    events.record(1);
+    flash.writesLeft = 0;
+    CHECK_FALSE(events.flush());
+    LONGS_EQUAL(1, events.pending());
+
+    flash.writesLeft = static_cast<std::size_t>(-1);
+    flash.memory.fill(0xFF);
+    log.mount();
+    CHECK_TRUE(events.flush());
+    LONGS_EQUAL(1, collectEvents(log).size());
+}
+
+TEST_GROUP(CrashRecord)
+{
+    FakeFlash flash;
+
+    void setup() override { fakeTime = 0; }
+};
+
+TEST(CrashRecord, CapturedSnapshotDecodesAfterReboot)
+{
+    constexpr std::uint16_t BOOT           = 1; // AppEvent::Boot
+    constexpr std::uint16_t CRASH_RECORDED = 2; // AppEvent::CrashRecorded
+
+    {
+        Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+        log.mount();
+        CHECK_TRUE(appendValue(log, 7, 1)); // History of an earlier boot
+    }
+
+    // ErrorLogInit() of the boot after the fault
+    const Log::CrashRecord captured = makeCrash();
+    {
+        Log::FlashLog log(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+        log.mount();
+        TestEventLog events(log, fakeClock);
+
+        events.record(BOOT);
+        CHECK_TRUE(log.append(static_cast<std::uint8_t>(Log::RecordType::Crash),
+                              Log::crashRecordPayload(captured)));
+        events.record(CRASH_RECORDED, captured.pc);
+        CHECK_TRUE(events.flush());
+    }
+
+    Log::FlashLog reader(&flash, flash.base(), SECTOR_SIZE, SECTOR);
+    reader.mount();
+
+    std::vector<std::uint8_t> types;
+    Log::CrashRecord          decoded{};
+    bool                      valid = false;
+    reader.forEach(
+        [&](std::uint8_t t_type, std::span<const std::uint8_t> t_payload)
+        {
+            types.push_back(t_type);
+            if (t_type == static_cast<std::uint8_t>(Log::RecordType::Crash))
+            {
+                valid = Log::decodeCrashRecord(t_payload, decoded);
+            }
+        });
+
+    LONGS_EQUAL(3, types.size());
+    LONGS_EQUAL(static_cast<std::uint8_t>(Log::RecordType::Crash), types[1]);
+    LONGS_EQUAL(static_cast<std::uint8_t>(Log::RecordType::Event), types[2]);
+    LONGS_EQUAL(0, reader.pageSequence(0));
+
+    CHECK_TRUE(valid);
+    LONGS_EQUAL(3, decoded.exception);
+    LONGS_EQUAL(captured.r0, decoded.r0);
+    LONGS_EQUAL(captured.r1, decoded.r1);
+    LONGS_EQUAL(captured.r2, decoded.r2);
+    LONGS_EQUAL(captured.r3, decoded.r3);
+    LONGS_EQUAL(captured.r12, decoded.r12);
+    LONGS_EQUAL(captured.lr, decoded.lr);
+    LONGS_EQUAL(captured.pc, decoded.pc);
+    LONGS_EQUAL(captured.xpsr, decoded.xpsr);
+    LONGS_EQUAL(captured.excReturn, decoded.excReturn);
+    LONGS_EQUAL(captured.sp, decoded.sp);
+    LONGS_EQUAL(captured.cfsr, decoded.cfsr);
+    LONGS_EQUAL(captured.hfsr, decoded.hfsr);
+    LONGS_EQUAL(captured.uptimeMs, decoded.uptimeMs);
+    LONGS_EQUAL(2, decoded.stackWords);
+    LONGS_EQUAL(0xDEADBEEF, decoded.stack[0]);
+    LONGS_EQUAL(0x0800C0DE, decoded.stack[1]);
+
+    // The per-boot event counter restarts and ties the crash to the boot that logged it
+    const auto stored = collectEvents(reader);
+    LONGS_EQUAL(2, stored.size());
+    LONGS_EQUAL(BOOT, stored[0].id);
+    LONGS_EQUAL(0, stored[0].sequence);
+    LONGS_EQUAL(CRASH_RECORDED, stored[1].id);
+    LONGS_EQUAL(1, stored[1].sequence);
+    LONGS_EQUAL(captured.pc, stored[1].data);
+}
+
+TEST(CrashRecord, DamagedPayloadIsNotDecoded)
+{
+    const Log::CrashRecord captured = makeCrash();
+
+    std::array<std::uint8_t, sizeof(Log::CrashRecord)> payload;
+    std::memcpy(payload.data(), &captured, sizeof(captured));
+
+    Log::CrashRecord decoded{};
+    CHECK_TRUE(Log::decodeCrashRecord(payload, decoded));
+    CHECK_FALSE(Log::decodeCrashRecord(std::span(payload).first(payload.size() - 4), decoded));
+
+    payload[offsetof(Log::CrashRecord, pc)] ^= 0x01;
+    CHECK_FALSE(Log::decodeCrashRecord(payload, decoded));
+}
@@ -0,0 +1,106 @@
+#include <cstdint>
+#include <string>
+#include "CppUTest/TestHarness.h"
+#include "fmt_log.hpp"
+
+namespace
+{
+std::string output;
+
+template <typename... Args>
+std::string formatted(Fmt::FormatString<std::type_identity_t<Args>...> t_format,
+                      const Args&... t_args)
+{
+    char buffer[96];
+    Fmt::format(buffer, sizeof(buffer), t_format, t_args...);
+    return buffer;
+}
+
+int evaluated = 0;
+
+int sideEffect()
+{
+    return ++evaluated;
+}
+
+LOG_MODULE(QuietLog, Warn);
+LOG_MODULE(VerboseLog, Debug);
+} // namespace
+
+// The App maps this to the console TX ring
+void Fmt::write(const char* t_data, std::size_t t_size)
+{
+    output.append(t_data, t_size);
+}
+
+TEST_GROUP(FmtLog)
+{
+    void setup() override
+    {
+        output.clear();
+        evaluated = 0;
+    }
+};
+
+TEST(FmtLog, Integers)
+{
+    STRCMP_EQUAL("0 -7 42 4294967295", formatted("{} {} {} {}", 0, -7, 42u, UINT32_MAX).c_str());
+    STRCMP_EQUAL("-2147483648", formatted("{}", INT32_MIN).c_str());
+    STRCMP_EQUAL("18446744073709551615", formatted("{}", UINT64_MAX).c_str());
+    STRCMP_EQUAL("  7|007|-07", formatted("{3}|{03}|{03}", 7, 7, -7).c_str());
+    STRCMP_EQUAL("0x0800C000 ff", formatted("0x{08X} {x}", 0x0800C000u, 255).c_str());
+    STRCMP_EQUAL("5", formatted("{}", std::uint8_t{5}).c_str());
+}
+
+TEST(FmtLog, FixedPointFloats)
+{
+    STRCMP_EQUAL("23.46", formatted("{}", 23.456f).c_str());
+    STRCMP_EQUAL(" 23.46", formatted("{6.2}", 23.456f).c_str());
+    STRCMP_EQUAL("-1.0 0.001 3", formatted("{.1} {.3} {.0}", -1.0f, 0.0005f, 2.6f).c_str());
+    STRCMP_EQUAL("1.00", formatted("{}", 0.999f).c_str()); // Rounding carries into the integer
+    STRCMP_EQUAL("-0.50", formatted("{}", -0.5f).c_str());
+}
+
+TEST(FmtLog, TextCharsAndEscapes)
+{
+    const char* none = nullptr;
+    STRCMP_EQUAL("ab|  ok|(null)|{x}", formatted("{}{}|{4}|{}|{{x}", 'a', 'b', "ok", none).c_str());
+    STRCMP_EQUAL("true", formatted("{}", true ? "true" : "false").c_str());
+}
+
+TEST(FmtLog, FormatTruncatesAndTerminates)
+{
+    char buffer[8];
+    const std::size_t length = Fmt::format(buffer, sizeof(buffer), "value={}", 123456);
+
+    LONGS_EQUAL(7, length);
+    STRCMP_EQUAL("value=1", buffer);
+}
+
+TEST(FmtLog, FormatIntoZeroSizedBufferWritesNothing)
+{
+    char buffer[4] = {'a', 'b', 'c', 'd'};
+
+    LONGS_EQUAL(0, Fmt::format(buffer, 0, "value={}", 123456));
+    LONGS_EQUAL(0, Fmt::format(nullptr, 0, "value={}", 123456));
+    MEMCMP_EQUAL("abcd", buffer, sizeof(buffer));
+}
+
+TEST(FmtLog, PrintFlushesLongLinesInPieces)
+{
+    const std::string text(150, 'x');
+    Fmt::print("{}|{}\n", text.c_str(), 9);
+
+    STRCMP_EQUAL((text + "|9\n").c_str(), output.c_str());
+}
+
+TEST(FmtLog, DisabledLevelsDoNotEvaluateArguments)
+{
+    LOG_INFO(QuietLog, "{}", sideEffect());
+    LOG_DEBUG(QuietLog, "{}", sideEffect());
+    LOG_WARN(QuietLog, "w{}\n", sideEffect());
+    LOG_DEBUG(VerboseLog, "d{}\n", sideEffect());
+
+    LONGS_EQUAL(2, evaluated);
+    STRCMP_EQUAL("w1\nd2\n", output.c_str());
+}
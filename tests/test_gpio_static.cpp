@@ -0,0 +1,209 @@
+#include <cstdint>
+#include "CppUTest/TestHarness.h"
+#include "gpio_host.hpp"
+
+using Green = HostPin<PinId::LD_GRE>;
+using Blue  = HostPin<PinId::LD_BLU>;
+
+// Port and mask come straight from gpioPinConfigs
+static_assert(Green::PORT == PortD);
+static_assert(Green::MASK == (1U << 12));
+static_assert(HostPin<PinId::BUTTON>::PORT == PortA);
+static_assert(HostPin<PinId::BUTTON>::MASK == 1U);
+
+TEST_GROUP(StaticPin)
+{
+    HostGpioPort& portD = *HostGpioPorts::port(PortD);
+
+    void setup() override { HostGpioPorts::clear(); }
+};
+
+TEST(StaticPin, SetAndResetAreOneWriteEach)
+{
+    Green::set();
+    CHECK_EQUAL(1U << 12, portD.odr);
+
+    Green::reset();
+    CHECK_EQUAL(0U, portD.odr);
+    CHECK_EQUAL(2, portD.writes);
+    CHECK_EQUAL(0, portD.reads);
+}
+
+TEST(StaticPin, ToggleReadsOnceWritesOnceAndLeavesOtherPins)
+{
+    Blue::set();
+    portD.writes = 0;
+
+    Green::toggle();
+    CHECK_EQUAL((1U << 15) | (1U << 12), portD.odr);
+    Green::toggle();
+    CHECK_EQUAL(1U << 15, portD.odr);
+
+    CHECK_EQUAL(2, portD.reads);
+    CHECK_EQUAL(2, portD.writes);
+}
+
+TEST(StaticPin, ReadSeesTheInputLevel)
+{
+    HostGpioPort& portA = *HostGpioPorts::port(PortA);
+    portA.inputMask     = HostPin<PinId::BUTTON>::MASK;
+
+    CHECK_FALSE(HostPin<PinId::BUTTON>::read());
+    portA.inputs = 1U;
+    CHECK_TRUE(HostPin<PinId::BUTTON>::read());
+}
+
+TEST(StaticPin, WriteSelectsSetOrReset)
+{
+    Green::write(true);
+    CHECK_TRUE(Green::read());
+    Green::write(false);
+    CHECK_FALSE(Green::read());
+}
+
+using Leds  = HostPinGroup<PinId::LD_GRE, PinId::LD_ORA, PinId::LD_RED, PinId::LD_BLU>;
+using Mixed = HostPinGroup<PinId::LD_RED, PinId::BUTTON, PinId::LD_GRE>; // Ports D, A, D
+
+static_assert(Leds::WRITES == 1);
+static_assert(Mixed::WRITES == 2);
+
+TEST_GROUP(PinGroup)
+{
+    HostGpioPort& portA = *HostGpioPorts::port(PortA);
+    HostGpioPort& portD = *HostGpioPorts::port(PortD);
+
+    void setup() override { HostGpioPorts::clear(); }
+};
+
+TEST(PinGroup, OnePortTakesOneWriteForAllPins)
+{
+    Leds::set();
+    CHECK_EQUAL(0xF000U, portD.odr);
+    CHECK_EQUAL(1, portD.writes);
+
+    Leds::reset();
+    CHECK_EQUAL(0U, portD.odr);
+    CHECK_EQUAL(2, portD.writes);
+    CHECK_EQUAL(0, portD.reads);
+}
+
+TEST(PinGroup, WriteSetsAndResetsInTheSameWrite)
+{
+    portD.odr = (1U << 13) | (1U << 3); // Orange on, and a pin outside the group
+
+    Leds::write(0b1001); // Green and blue on, orange and red off
+
+    CHECK_EQUAL((1U << 12) | (1U << 15) | (1U << 3), portD.odr);
+    CHECK_EQUAL(1, portD.writes);
+}
+
+TEST(PinGroup, EachPortIsWrittenOnce)
+{
+    Mixed::write(0b111);
+
+    CHECK_EQUAL((1U << 14) | (1U << 12), portD.odr);
+    CHECK_EQUAL(1U, portA.odr);
+    CHECK_EQUAL(1, portD.writes);
+    CHECK_EQUAL(1, portA.writes);
+
+    Mixed::toggle();
+    CHECK_EQUAL(0U, portD.odr);
+    CHECK_EQUAL(0U, portA.odr);
+    CHECK_EQUAL(2, portD.writes);
+    CHECK_EQUAL(1, portD.reads);
+}
+
+TEST(PinGroup, ReadPacksLevelsInListOrder)
+{
+    portA.inputMask = 1U;
+    portA.inputs    = 1U;
+    portD.odr       = 1U << 12;
+
+    CHECK_EQUAL(0b110U, Mixed::read());
+    CHECK_EQUAL(1, portA.reads);
+    CHECK_EQUAL(1, portD.reads);
+}
+
+namespace
+{
+constexpr PinConfig pin(PinId t_id, PinConfig::PortStm32 t_port, std::uint16_t t_number,
+                        PinConfig::Mode t_mode, PinConfig::InterruptExti t_exti = ExtiNone)
+{
+    return {t_id, t_port, t_number, t_mode, PullNone, PushPull, Low, t_exti, Rising, 0, 6};
+}
+
+constexpr std::array<PinConfig, 2> SAME_PIN = {
+    {pin(PinId::LD_GRE, PortD, 12, Output), pin(PinId::LD_ORA, PortD, 12, Output)}};
+constexpr std::array<PinConfig, 2> SAME_LINE = {
+    {pin(PinId::BUTTON, PortA, 0, Input, ExtiIT), pin(PinId::LD_GRE, PortB, 0, Input, ExtiIT)}};
+constexpr std::array<PinConfig, 2> SAME_NUMBER_ONE_EXTI = {
+    {pin(PinId::BUTTON, PortA, 0, Input, ExtiIT), pin(PinId::LD_GRE, PortB, 0, Output)}};
+
+// MCO1 on PA8 is AF0, USART1 TX on PA9 is AF7
+constexpr std::array<PinConfig, 2> AF0_AND_AF7 = {
+    {{PinId::LD_GRE, PortA, 8, Alternate, PullNone, PushPull, Low, ExtiNone, Rising, 0, 6},
+     {PinId::LD_ORA, PortA, 9, Alternate, PullNone, PushPull, Low, ExtiNone, Rising, 7, 6}}};
+} // namespace
+
+// The checks gpioImage is built behind
+static_assert(!gpioPinsDistinct(SAME_PIN));
+static_assert(!gpioExtiLinesDistinct(SAME_LINE));
+static_assert(gpioExtiLinesDistinct(SAME_NUMBER_ONE_EXTI));
+
+TEST_GROUP(GpioImage){};
+
+TEST(GpioImage, PortRegistersHoldOnlyTheConfiguredFields)
+{
+    const GpioPortImage& portD = gpioImage.ports[PortD];
+
+    CHECK_EQUAL(0xF000U, portD.pins);
+    CHECK_EQUAL(0xFF000000U, portD.wide);
+    CHECK_EQUAL(0x55000000U, portD.moder); // Outputs
+    CHECK_EQUAL(0U, portD.ospeedr);
+    CHECK_EQUAL(0U, portD.afrMask[0] | portD.afrMask[1]);
+
+    const GpioPortImage& portA = gpioImage.ports[PortA];
+    CHECK_EQUAL(0x00A0U, portA.moder);       // PA2, PA3 alternate, PA0 input
+    CHECK_EQUAL(0x00F0U, portA.ospeedr);     // Very high speed on the UART pins
+    CHECK_EQUAL(0x0002U, portA.pupdr);       // Pull-down on the button
+    CHECK_EQUAL(0x7700U, portA.afr[0]);      // AF7, USART2
+    CHECK_EQUAL(0xFF00U, portA.afrMask[0]);
+}
+
+TEST(GpioImage, ClocksAndExtiRoutingCoverTheUsedPortsAndLines)
+{
+    CHECK_EQUAL((1U << PortA) | (1U << PortD), gpioImage.clocks);
+    CHECK_EQUAL(0U, gpioImage.ports[PortB].pins);
+
+    const GpioExtiImage& exti = gpioImage.exti;
+    CHECK_EQUAL(1U, exti.lines); // The button on line 0
+    CHECK_EQUAL(1U, exti.imr);
+    CHECK_EQUAL(0U, exti.emr);
+    CHECK_EQUAL(1U, exti.rtsr);
+    CHECK_EQUAL(0U, exti.ftsr);
+    CHECK_EQUAL(0xFU, exti.exticrMask[0]);
+    CHECK_EQUAL(std::uint32_t{PortA}, exti.exticr[0]);
+    CHECK_EQUAL(IrqPriority::BUTTON, exti.priority[0]);
+}
+
+TEST(GpioImage, ExtiRoutingFollowsThePort)
+{
+    constexpr std::array<PinConfig, 1> PE6 = {{pin(PinId::BUTTON, PortE, 6, Input, ExtiEVT)}};
+    constexpr GpioImage image = makeGpioImage(PE6);
+
+    CHECK_EQUAL(1U << 6, image.exti.lines);
+    CHECK_EQUAL(0U, image.exti.imr);
+    CHECK_EQUAL(1U << 6, image.exti.emr);
+    CHECK_EQUAL(std::uint32_t{PortE} << 8, image.exti.exticr[1]); // EXTICR2, field 2
+    CHECK_EQUAL(0xFU << 8, image.exti.exticrMask[1]);
+}
+
+TEST(GpioImage, AlternateFunctionZeroStillOwnsItsAfrField)
+{
+    constexpr GpioImage  image = makeGpioImage(AF0_AND_AF7);
+    const GpioPortImage& portA = image.ports[PortA];
+
+    CHECK_EQUAL(0x00U, portA.afrMask[0]);
+    CHECK_EQUAL(0xFFU, portA.afrMask[1]); // Both nibbles, so a stale AF on PA8 is cleared
+    CHECK_EQUAL(0x70U, portA.afr[1]);
+}
@@ -0,0 +1,178 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include "CppUTest/TestHarness.h"
+#include "pil_os.hpp"
+
+namespace
+{
+using Ms = std::chrono::milliseconds;
+
+Os::StackWord unusedStack[64]; // The host port runs tasks on thread stacks
+
+struct PingPong
+{
+    Os::Semaphore ping;
+    Os::Semaphore pong;
+    int           rounds{0};
+};
+
+void answer(void* t_pair)
+{
+    auto& pair = *static_cast<PingPong*>(t_pair);
+    for (int i = 0; i < pair.rounds; ++i)
+    {
+        pair.ping.take();
+        pair.pong.give();
+    }
+}
+
+struct Producer
+{
+    Os::Queue<int, 4>* queue;
+    int                count;
+};
+
+void produce(void* t_producer)
+{
+    auto& producer = *static_cast<Producer*>(t_producer);
+    for (int i = 0; i < producer.count; ++i)
+    {
+        producer.queue->send(i);
+    }
+}
+
+void countTick(void* t_count)
+{
+    static_cast<std::atomic<int>*>(t_count)->fetch_add(1);
+}
+
+void listTask(const Os::Task& t_task, void* t_found)
+{
+    if (std::strcmp(t_task.name(), "listed") == 0)
+    {
+        *static_cast<bool*>(t_found) = true;
+    }
+}
+
+void idle(void*) {}
+} // namespace
+
+TEST_GROUP(OsPosix)
+{
+    void setup() override
+    {
+        Os::run(); // Releases tasks as they start
+        Os::resetKernelStats();
+    }
+};
+
+TEST(OsPosix, TakeTimesOutWithoutAGive)
+{
+    Os::Semaphore semaphore;
+
+    const auto start = std::chrono::steady_clock::now();
+    CHECK_FALSE(semaphore.take(20));
+    CHECK(std::chrono::steady_clock::now() - start >= Ms(20));
+    CHECK_FALSE(semaphore.tryTake());
+}
+
+TEST(OsPosix, CountsAreKeptUpToTheMaximum)
+{
+    Os::Semaphore semaphore(0, 2);
+    semaphore.give();
+    semaphore.give();
+    semaphore.give();
+
+    CHECK_EQUAL(2u, semaphore.count());
+    CHECK_TRUE(semaphore.tryTake());
+    CHECK_TRUE(semaphore.take(0));
+    CHECK_FALSE(semaphore.tryTake());
+}
+
+TEST(OsPosix, GiveWakesABlockedTaskAndTheLatencyIsMeasured)
+{
+    PingPong pair;
+    pair.rounds = 100;
+    Os::Task task("answer", &answer, &pair, 3, unusedStack);
+    CHECK_TRUE(task.start());
+    CHECK_FALSE(task.start());
+
+    for (int i = 0; i < pair.rounds; ++i)
+    {
+        pair.ping.give();
+        CHECK_TRUE(pair.pong.take(1000));
+    }
+    Os::Port::join(task);
+
+    CHECK_TRUE(task.state() == Os::TaskState::Finished);
+    const Os::KernelStats stats = Os::kernelStats();
+    CHECK(stats.wakeups > 0);
+    CHECK(stats.wakeMax > 0);
+    CHECK(stats.wakeTotal / stats.wakeups <= stats.wakeMax);
+}
+
+TEST(OsPosix, QueueKeepsOrderAndBlocksTheProducerWhenFull)
+{
+    Os::Queue<int, 4> queue;
+    Producer          producer{&queue, 50};
+    Os::Task          task("producer", &produce, &producer, 2, unusedStack);
+    task.start();
+
+    for (int expected = 0; expected < producer.count; ++expected)
+    {
+        int item = -1;
+        CHECK_TRUE(queue.receive(item, 1000));
+        CHECK_EQUAL(expected, item);
+        CHECK(queue.size() <= 4);
+    }
+    Os::Port::join(task);
+
+    int item = 0;
+    CHECK_FALSE(queue.tryReceive(item));
+    CHECK_TRUE(queue.trySend(1));
+}
+
+TEST(OsPosix, TimerFiresPeriodicallyUntilStopped)
+{
+    std::atomic<int> count{0};
+    Os::Timer        timer(&countTick, &count);
+
+    timer.start(5, 5);
+    CHECK_TRUE(timer.isActive());
+    Os::sleepMs(60);
+    timer.stop();
+    const int fired = count.load();
+
+    CHECK(fired >= 3);
+    Os::sleepMs(20);
+    CHECK_EQUAL(fired, count.load());
+}
+
+TEST(OsPosix, OneShotTimerFiresOnce)
+{
+    std::atomic<int> count{0};
+    Os::Timer        timer(&countTick, &count);
+
+    timer.start(5);
+    Os::sleepMs(40);
+    CHECK_EQUAL(1, count.load());
+    CHECK_FALSE(timer.isActive());
+}
+
+TEST(OsPosix, StartedTasksAreListedAndBadPrioritiesRefused)
+{
+    Os::Task listed("listed", &idle, nullptr, 1, unusedStack);
+    Os::Task idleLevel("bad", &idle, nullptr, 0, unusedStack);
+    Os::Task tooHigh("bad", &idle, nullptr, Os::PRIORITIES, unusedStack);
+
+    CHECK_FALSE(idleLevel.start());
+    CHECK_FALSE(tooHigh.start());
+    CHECK_TRUE(listed.start());
+
+    bool found = false;
+    Os::forEachTask(&listTask, &found);
+    CHECK_TRUE(found);
+    Os::Port::join(listed);
+}
@@ -0,0 +1,135 @@
+#include <array>
+#include <cstdint>
+#include "CppUTest/TestHarness.h"
+#include "patterns.hpp"
+
+namespace
+{
+class CountingObserver : public Observer
+{
+  public:
+    void notify(uint32_t t_mask) const override
+    {
+        ++calls;
+        lastMask = t_mask;
+    }
+
+    mutable int      calls{0};
+    mutable uint32_t lastMask{0};
+};
+// Re-subscribes itself from inside the notification, as thread code could while an ISR
+// notification is calling it
+class ResubscribingObserver : public Observer
+{
+  public:
+    void notify(uint32_t t_mask) const override
+    {
+        ++calls;
+        subject->unregisterObserver(const_cast<ResubscribingObserver*>(this));
+        subject->registerObserver(const_cast<ResubscribingObserver*>(this), t_mask);
+    }
+
+    Subject*    subject{nullptr};
+    mutable int calls{0};
+};
+} // namespace
+
+TEST_GROUP(Subject){};
+
+TEST(Subject, NotifiesOnlySubscribedObservers)
+{
+    Subject          subject;
+    CountingObserver line0;
+    CountingObserver line3;
+    CountingObserver all;
+
+    CHECK_TRUE(subject.registerObserver(&line0, 1u << 0));
+    CHECK_TRUE(subject.registerObserver(&line3, 1u << 3));
+    CHECK_TRUE(subject.registerObserver(&all));
+    CHECK_FALSE(subject.registerObserver(&all)); // Already linked
+
+    subject.notifyObservers(1u << 3);
+    LONGS_EQUAL(0, line0.calls);
+    LONGS_EQUAL(1, line3.calls);
+    LONGS_EQUAL(1, all.calls);
+    LONGS_EQUAL(1u << 3, line3.lastMask);
+}
+
+TEST(Subject, UnregisterRelinksAndNarrowsSubscription)
+{
+    Subject          subject;
+    CountingObserver first;
+    CountingObserver middle;
+    CountingObserver last;
+
+    subject.registerObserver(&first, 0x1);
+    subject.registerObserver(&middle, 0x2);
+    subject.registerObserver(&last, 0x1);
+
+    subject.unregisterObserver(&middle);
+    subject.notifyObservers(0x3);
+    LONGS_EQUAL(1, first.calls);
+    LONGS_EQUAL(0, middle.calls);
+    LONGS_EQUAL(1, last.calls);
+
+    // Re-registering after removal is allowed
+    CHECK_TRUE(subject.registerObserver(&middle, 0x2));
+    subject.notifyObservers(0x2);
+    LONGS_EQUAL(1, middle.calls);
+}
+
+TEST(Subject, ReregistrationDuringNotificationReachesTheRest)
+{
+    Subject               subject;
+    ResubscribingObserver first;
+    CountingObserver      second;
+    CountingObserver      third;
+    first.subject = &subject;
+
+    subject.registerObserver(&first, 0x1);
+    subject.registerObserver(&second, 0x1);
+    subject.registerObserver(&third, 0x1);
+
+    subject.notifyObservers(0x1);
+    LONGS_EQUAL(1, first.calls);
+    LONGS_EQUAL(1, second.calls);
+    LONGS_EQUAL(1, third.calls);
+
+    subject.notifyObservers(0x1);
+    LONGS_EQUAL(2, first.calls);
+    LONGS_EQUAL(2, third.calls);
+}
+
+TEST(Subject, EachBitReachesOnlyItsSubscribers)
+{
+    Subject                                              subject;
+    std::array<CountingObserver, Subject::MAX_OBSERVERS> lines;
+
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+        subject.registerObserver(&lines[i], 1u << (4 * i));
+    }
+
+    subject.notifyObservers((1u << 8) | (1u << 20) | (1u << 21));
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+        LONGS_EQUAL(((i == 2) || (i == 5)) ? 1 : 0, lines[i].calls);
+    }
+    LONGS_EQUAL((1u << 8) | (1u << 20) | (1u << 21), lines[5].lastMask);
+}
+
+TEST(Subject, CapacityIsFixed)
+{
+    Subject                                                subject;
+    std::array<CountingObserver, Subject::MAX_OBSERVERS + 1> observers;
+
+    for (std::size_t i = 0; i < Subject::MAX_OBSERVERS; ++i)
+    {
+        CHECK_TRUE(subject.registerObserver(&observers[i]));
+    }
+    CHECK_FALSE(subject.registerObserver(&observers.back()));
+
+    subject.notifyObservers(0x1);
+    LONGS_EQUAL(1, observers.front().calls);
+    LONGS_EQUAL(0, observers.back().calls);
+}
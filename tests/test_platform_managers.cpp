@@ -0,0 +1,113 @@
+#include <cstdint>
+#include <string>
+#include "CppUTest/TestHarness.h"
+#include "pil_adc.hpp"
+#include "pil_clock_config.hpp"
+#include "pil_uart.hpp"
+#include "pil_watchdog.hpp"
+
+namespace
+{
+// The fakes record into statics, as a register would, so the tests see every call
+struct FakeWatchdog
+{
+    void start(std::uint32_t t_timeoutMs) { timeoutMs = t_timeoutMs; }
+    void feed() { ++feeds; }
+
+    static inline std::uint32_t timeoutMs{0};
+    static inline int           feeds{0};
+};
+
+struct FakeAdc
+{
+    void  init() {}
+    float readTemperature() { return 36.5f; }
+};
+
+struct FakeClock
+{
+    void configure(void (*t_handler)()) { handler = t_handler; }
+
+    static inline void (*handler)(){nullptr};
+};
+
+class FakeUart final : public IConsoleUart
+{
+  public:
+    void init(UartId t_id, uint32_t) override { id = t_id; }
+    bool read(char&) override { return false; }
+    void write(char t_c) override { sent += t_c; }
+    void write(const char* t_str) { sent += t_str; }
+
+    static inline UartId      id{UartId::Uart1};
+    static inline std::string sent;
+};
+
+struct FakeTraits
+{
+    using Watchdog = FakeWatchdog;
+    using Adc      = FakeAdc;
+    using Clock    = FakeClock;
+    using Uart     = FakeUart;
+};
+
+static_assert(WatchdogDriver<FakeWatchdog>);
+static_assert(!AdcDriver<FakeWatchdog>);
+static_assert(!UartDriver<FakeAdc>); // A UART driver must also be an IConsoleUart
+
+void clockError() {}
+} // namespace
+
+TEST_GROUP(PlatformManagers)
+{
+    void setup() override
+    {
+        FakeWatchdog::timeoutMs = 0;
+        FakeWatchdog::feeds     = 0;
+        FakeClock::handler      = nullptr;
+        FakeUart::sent.clear();
+    }
+};
+
+TEST(PlatformManagers, WatchdogStartsWithTheTimeoutAndFeedsOnce)
+{
+    PlatformWatchdog<FakeTraits> watchdog;
+    watchdog.initialize(1000);
+    CHECK_EQUAL(1000u, FakeWatchdog::timeoutMs);
+    CHECK_EQUAL(1, FakeWatchdog::feeds);
+
+    watchdog.feed();
+    CHECK_EQUAL(2, FakeWatchdog::feeds);
+}
+
+TEST(PlatformManagers, AdcReadsZeroUntilInitialized)
+{
+    PlatformAdc<FakeTraits> adc;
+    CHECK_EQUAL(0.0f, adc.readTemperature());
+
+    adc.initialize();
+    CHECK_EQUAL(36.5f, adc.readTemperature());
+}
+
+TEST(PlatformManagers, ClockPassesTheErrorHandler)
+{
+    PlatformClock<FakeTraits> clock;
+    clock.initialize(&clockError);
+
+    CHECK_TRUE(FakeClock::handler == &clockError);
+}
+
+TEST(PlatformManagers, UartDropsWritesUntilInitialized)
+{
+    PlatformUart<FakeTraits> uart;
+    POINTERS_EQUAL(nullptr, uart.getUart());
+    uart.write("lost");
+
+    uart.initialize(UartId::Uart2, 115200);
+    uart.write("ok");
+    uart.write('!');
+    uart.getUart()->write('?'); // The IConsoleUart view reaches the same driver
+
+    CHECK_TRUE(FakeUart::id == UartId::Uart2);
+    STRCMP_EQUAL("ok!?", FakeUart::sent.c_str());
+}
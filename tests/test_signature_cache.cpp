@@ -0,0 +1,196 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "CppUTest/TestHarness.h"
+#include "firmware_metadata.hpp"
+#include "sha256.hpp"
+#include "signature_cache.hpp"
+
+namespace
+{
+constexpr std::size_t CACHE_SIZE = 256;
+constexpr std::size_t ENTRY_SIZE = 4 + 32; // Magic + SHA-256 key
+
+// RAM-backed flash: programming can only clear bits
+class FakeFlash : public IFlashWriter
+{
+  public:
+    FakeFlash() { memory.fill(0xFF); }
+
+    void eraseSector(std::uint8_t) override { memory.fill(0xFF); }
+
+    void writeWord(std::uintptr_t t_address, std::uint32_t t_data) override
+    {
+        if (writesLeft == 0)
+        {
+            return; // Simulated reset: the write never happens
+        }
+        --writesLeft;
+
+        std::uint32_t current;
+        std::memcpy(&current, reinterpret_cast<void*>(t_address), sizeof(current));
+        current &= t_data;
+        std::memcpy(reinterpret_cast<void*>(t_address), &current, sizeof(current));
+    }
+
+    void writeImage(std::uintptr_t, std::uintptr_t, std::size_t) override {}
+
+    std::uintptr_t base() { return reinterpret_cast<std::uintptr_t>(memory.data()); }
+
+    alignas(4) std::array<std::uint8_t, CACHE_SIZE> memory;
+    std::size_t writesLeft{static_cast<std::size_t>(-1)};
+};
+
+struct NoLock
+{
+    NoLock() {} // Single-threaded test, nothing to mask
+};
+
+using TestCache = SignatureCache<NoLock>;
+
+struct Image
+{
+    Firmware::Metadata    metadata;
+    Firmware::Certificate cert;
+
+    std::uintptr_t metadataAddr() const { return reinterpret_cast<std::uintptr_t>(&metadata); }
+    std::uintptr_t certAddr() const { return reinterpret_cast<std::uintptr_t>(&cert); }
+};
+
+Image makeImage()
+{
+    Image image{};
+    image.metadata.magic        = Firmware::METADATA_MAGIC;
+    image.metadata.version      = 0x010203;
+    image.metadata.firmwareSize = 4096;
+    image.metadata.firmwareCRC  = 0xC0FFEE11;
+    for (std::size_t i = 0; i < sizeof(image.metadata.firmwareHash); ++i)
+    {
+        image.metadata.firmwareHash[i] = static_cast<std::uint8_t>(i);
+    }
+
+    image.cert.magic     = Firmware::CERTIFICATE_MAGIC;
+    image.cert.algorithm = Firmware::SIGNATURE_ALG_ED25519;
+    for (std::size_t i = 0; i < sizeof(image.cert.signature); ++i)
+    {
+        image.cert.signature[i] = static_cast<std::uint8_t>(0x80 + i);
+    }
+    return image;
+}
+
+Firmware::DeviceSecret makeSecret(std::uint8_t t_seed)
+{
+    Firmware::DeviceSecret secret{};
+    secret.magic = Firmware::DEVICE_SECRET_MAGIC;
+    for (std::size_t i = 0; i < sizeof(secret.key); ++i)
+    {
+        secret.key[i] = static_cast<std::uint8_t>(t_seed + 7 * i);
+    }
+    return secret;
+}
+
+std::uintptr_t address(const Firmware::DeviceSecret& t_secret)
+{
+    return reinterpret_cast<std::uintptr_t>(&t_secret);
+}
+
+} // namespace
+
+TEST_GROUP(SignatureCache)
+{
+    FakeFlash              flash;
+    Firmware::DeviceSecret secret{makeSecret(0x11)};
+};
+
+TEST(SignatureCache, StoredImageHits)
+{
+    TestCache cache(&flash, flash.base(), CACHE_SIZE, address(secret));
+    const Image image = makeImage();
+
+    CHECK_FALSE(cache.contains(image.metadataAddr(), image.certAddr()));
+    cache.store(image.metadataAddr(), image.certAddr());
+    CHECK_TRUE(cache.contains(image.metadataAddr(), image.certAddr()));
+}
+
+TEST(SignatureCache, TamperedImageWithSameCrcAndSignatureWordMisses)
+{
+    TestCache cache(&flash, flash.base(), CACHE_SIZE, address(secret));
+    const Image image = makeImage();
+    cache.store(image.metadataAddr(), image.certAddr());
+
+    // Forged metadata for other firmware: same version, CRC and first signature word
+    Image forged = makeImage();
+    forged.metadata.firmwareHash[0] ^= 0x01;
+    CHECK_FALSE(cache.contains(forged.metadataAddr(), forged.certAddr()));
+
+    // Original metadata, signature differing only past its first word
+    forged = makeImage();
+    forged.cert.signature[63] ^= 0x01;
+    CHECK_FALSE(cache.contains(forged.metadataAddr(), forged.certAddr()));
+}
+
+TEST(SignatureCache, TornEntryIsNeitherMatchedNorReused)
+{
+    TestCache   cache(&flash, flash.base(), CACHE_SIZE, address(secret));
+    const Image image = makeImage();
+
+    flash.writesLeft = 3; // Reset before the magic is programmed
+    cache.store(image.metadataAddr(), image.certAddr());
+    CHECK_FALSE(cache.contains(image.metadataAddr(), image.certAddr()));
+
+    flash.writesLeft = static_cast<std::size_t>(-1);
+    cache.store(image.metadataAddr(), image.certAddr());
+    CHECK_TRUE(cache.contains(image.metadataAddr(), image.certAddr()));
+
+    // Slot 0 keeps its torn words, the entry went to slot 1
+    std::uint32_t magic0;
+    std::uint32_t magic1;
+    std::memcpy(&magic0, flash.memory.data(), sizeof(magic0));
+    std::memcpy(&magic1, flash.memory.data() + ENTRY_SIZE, sizeof(magic1));
+    LONGS_EQUAL(0xFFFFFFFF, magic0);
+    LONGS_EQUAL(0x53494756, magic1);
+}
+
+TEST(SignatureCache, EntryWithoutTheDeviceSecretMisses)
+{
+    TestCache   cache(&flash, flash.base(), CACHE_SIZE, address(secret));
+    const Image image = makeImage();
+
+    // Planted by code that can program sector 3: a plain SHA-256 of the public inputs
+    Integrity::Sha256 sha;
+    sha.update(std::span(reinterpret_cast<const std::uint8_t*>(&image.metadata),
+                         sizeof(image.metadata)));
+    sha.update(std::span(reinterpret_cast<const std::uint8_t*>(&image.cert), sizeof(image.cert)));
+    const Integrity::Sha256::Digest digest = sha.finish();
+
+    std::uint32_t key[8];
+    std::memcpy(key, digest.data(), sizeof(key));
+    for (std::size_t w = 0; w < 8; ++w)
+    {
+        flash.writeWord(flash.base() + 4 + w * 4, key[w]);
+    }
+    flash.writeWord(flash.base(), 0x53494756);
+    CHECK_FALSE(cache.contains(image.metadataAddr(), image.certAddr()));
+
+    // An entry made on another device does not carry over either
+    const Firmware::DeviceSecret other = makeSecret(0x22);
+    TestCache(&flash, flash.base(), CACHE_SIZE, address(other))
+        .store(image.metadataAddr(), image.certAddr());
+    CHECK_FALSE(cache.contains(image.metadataAddr(), image.certAddr()));
+}
+
+TEST(SignatureCache, UnprovisionedDeviceNeverCaches)
+{
+    Firmware::DeviceSecret blank;
+    std::memset(&blank, 0xFF, sizeof(blank));
+    TestCache   cache(&flash, flash.base(), CACHE_SIZE, address(blank));
+    const Image image = makeImage();
+
+    cache.store(image.metadataAddr(), image.certAddr());
+    CHECK_FALSE(cache.contains(image.metadataAddr(), image.certAddr()));
+
+    for (std::uint8_t byte : flash.memory)
+    {
+        LONGS_EQUAL(0xFF, byte);
+    }
+}
@@ -0,0 +1,205 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "CppUTest/TestHarness.h"
+#include "soft_irq.hpp"
+#include "timebase_host.hpp"
+
+namespace
+{
+enum class TestIrq : std::uint8_t
+{
+    Urgent,
+    Slow,
+    Other,
+    Count
+};
+
+// Stands in for PendSV: counts the pends, the test drains by hand
+struct PendFake
+{
+    static void pend() { ++pends; }
+
+    static inline std::atomic<int> pends{0};
+};
+
+using TestSoftIrq = SoftIrq<TestIrq, PendFake, 2, 4>;
+
+struct Run
+{
+    TestIrq       source;
+    std::uint32_t data;
+};
+
+ManualTimebase*   fakeClock;
+std::vector<Run>* runs;
+
+void record(void* t_source, std::uint32_t t_data)
+{
+    runs->push_back({*static_cast<TestIrq*>(t_source), t_data});
+}
+
+TestIrq urgent{TestIrq::Urgent};
+TestIrq slow{TestIrq::Slow};
+TestIrq other{TestIrq::Other};
+} // namespace
+
+TEST_GROUP(SoftIrq)
+{
+    ManualTimebase   timebase;
+    TestSoftIrq      softIrq{timebase};
+    std::vector<Run> ran;
+
+    void setup() override
+    {
+        fakeClock       = &timebase;
+        runs            = &ran;
+        PendFake::pends = 0;
+
+        softIrq.subscribe(TestIrq::Urgent, &record, &urgent, 0);
+        softIrq.subscribe(TestIrq::Slow, &record, &slow, 1);
+        softIrq.subscribe(TestIrq::Other, &record, &other, 1);
+    }
+};
+
+TEST(SoftIrq, PostOnlyQueuesAndPends)
+{
+    CHECK_TRUE(softIrq.post(TestIrq::Slow, 7));
+
+    CHECK_EQUAL(1, PendFake::pends.load());
+    CHECK_EQUAL(1u, softIrq.queued(1));
+    CHECK_TRUE(ran.empty());
+
+    softIrq.drain();
+    CHECK_EQUAL(1u, ran.size());
+    CHECK_EQUAL(7u, ran[0].data);
+    CHECK_EQUAL(0u, softIrq.queued(1));
+}
+
+TEST(SoftIrq, UrgentLevelRunsFirstAndEachLevelInOrder)
+{
+    softIrq.post(TestIrq::Slow, 1);
+    softIrq.post(TestIrq::Other, 2);
+    softIrq.post(TestIrq::Urgent, 3);
+    softIrq.post(TestIrq::Slow, 4);
+
+    softIrq.drain();
+
+    CHECK_EQUAL(4u, ran.size());
+    CHECK_EQUAL(3u, ran[0].data);
+    CHECK_EQUAL(1u, ran[1].data);
+    CHECK_EQUAL(2u, ran[2].data);
+    CHECK_EQUAL(4u, ran[3].data);
+}
+
+TEST(SoftIrq, UrgentItemPostedByAHandlerOvertakesQueuedOnes)
+{
+    static TestSoftIrq* self;
+    self = &softIrq;
+
+    // As if an interrupt had fired during the first bottom half
+    softIrq.subscribe(TestIrq::Slow,
+                      [](void*, std::uint32_t t_data)
+                      {
+                          runs->push_back({TestIrq::Slow, t_data});
+                          self->post(TestIrq::Urgent, 9);
+                      },
+                      nullptr, 1);
+    softIrq.post(TestIrq::Slow, 1);
+    softIrq.post(TestIrq::Other, 2);
+
+    softIrq.drain();
+
+    CHECK_EQUAL(3u, ran.size());
+    CHECK_EQUAL(1u, ran[0].data);
+    CHECK_EQUAL(9u, ran[1].data);
+    CHECK_EQUAL(2u, ran[2].data);
+}
+
+TEST(SoftIrq, FullLevelDropsAndCounts)
+{
+    for (std::uint32_t i = 0; i < 4; ++i)
+    {
+        CHECK_TRUE(softIrq.post(TestIrq::Slow, i));
+    }
+    CHECK_FALSE(softIrq.post(TestIrq::Other, 4));
+    CHECK_TRUE(softIrq.post(TestIrq::Urgent, 5)); // Its own level still has room
+
+    CHECK_EQUAL(1u, softIrq.stats(TestIrq::Other).dropped);
+    CHECK_EQUAL(4u, softIrq.peak(1));
+
+    softIrq.drain();
+    CHECK_EQUAL(5u, ran.size());
+    CHECK_TRUE(softIrq.post(TestIrq::Other, 6));
+}
+
+TEST(SoftIrq, RunTimesGoToLog2Buckets)
+{
+    // Each run takes as many cycles as its data says
+    softIrq.subscribe(
+        TestIrq::Slow, [](void*, std::uint32_t t_cycles) { fakeClock->cycles += t_cycles; },
+        nullptr, 1);
+
+    softIrq.post(TestIrq::Slow, 0);
+    softIrq.post(TestIrq::Slow, 5);     // 4..7
+    softIrq.post(TestIrq::Slow, 7);     // 4..7
+    softIrq.post(TestIrq::Slow, 40000); // Beyond the last bucket
+    softIrq.drain();
+
+    const SoftIrqStats stats = softIrq.stats(TestIrq::Slow);
+    CHECK_EQUAL(4u, stats.runs);
+    CHECK_EQUAL(40000u, stats.runMax);
+    CHECK_EQUAL(1u, stats.histogram[0]);
+    CHECK_EQUAL(2u, stats.histogram[3]);
+    CHECK_EQUAL(1u, stats.histogram[SOFT_IRQ_BUCKETS - 1]);
+
+    softIrq.resetStats();
+    CHECK_EQUAL(0u, softIrq.stats(TestIrq::Slow).runs);
+}
+
+TEST(SoftIrq, ConcurrentProducersLoseNothing)
+{
+    constexpr std::uint32_t PER_PRODUCER = 20000;
+
+    SoftIrq<TestIrq, PendFake, 1, 64> shared{timebase};
+    std::vector<std::uint32_t>        seen(4 * PER_PRODUCER, 0);
+    std::atomic<int>                  done{0};
+
+    static std::vector<std::uint32_t>* marks;
+    marks = &seen;
+    shared.subscribe(TestIrq::Slow, [](void*, std::uint32_t t_data) { (*marks)[t_data]++; },
+                     nullptr, 0);
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0; p < 4; ++p)
+    {
+        producers.emplace_back(
+            [&shared, &done, p]
+            {
+                for (std::uint32_t i = 0; i < PER_PRODUCER; ++i)
+                {
+                    while (!shared.post(TestIrq::Slow, p * PER_PRODUCER + i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                done++;
+            });
+    }
+
+    while (done.load() < 4)
+    {
+        shared.drain();
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    shared.drain();
+
+    for (const std::uint32_t count : seen)
+    {
+        CHECK_EQUAL(1u, count);
+    }
+}
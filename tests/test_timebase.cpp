@@ -0,0 +1,148 @@
+#include <cstdint>
+#include <thread>
+#include "CppUTest/TestHarness.h"
+#include "pil_timebase.hpp"
+#include "timebase_host.hpp"
+
+TEST_GROUP(TimebaseMath){};
+
+TEST(TimebaseMath, ExtendJoinsOverflowsAndCounter)
+{
+    CHECK_EQUAL(0x0000000312345678ULL, TimebaseMath::extend(3, 0x12345678, false));
+}
+
+TEST(TimebaseMath, ExtendCountsPendingWrapForLowValues)
+{
+    // Counter wrapped, overflow interrupt not run yet
+    CHECK_EQUAL(0x0000000400000005ULL, TimebaseMath::extend(3, 5, true));
+}
+
+TEST(TimebaseMath, ExtendIgnoresPendingWrapForHighValues)
+{
+    // Counter read just before the wrap, flag set by the time it was sampled
+    CHECK_EQUAL(0x00000003FFFFFFFEULL, TimebaseMath::extend(3, 0xFFFFFFFE, true));
+}
+
+TEST(TimebaseMath, ExtendCarriesOverflowCounterWrap)
+{
+    CHECK_EQUAL(0x0000000000000001ULL, TimebaseMath::extend(0xFFFFFFFF, 1, true));
+}
+
+TEST(TimebaseMath, CyclesTakeLowBitsFromCycleCounter)
+{
+    const std::uint64_t us     = 30000000000ULL; // ~8.3 h, far beyond one CYCCNT period
+    const std::uint64_t exact  = us * 168 + 100;
+    const auto          cycles = static_cast<std::uint32_t>(exact);
+
+    CHECK_EQUAL(exact, TimebaseMath::cyclesFromUs(us, 168, cycles));
+}
+
+TEST(TimebaseMath, CyclesReadBeforeMicrosecondsStayBehind)
+{
+    const std::uint64_t us     = 1000000;
+    const std::uint64_t exact  = us * 168 - 40; // CYCCNT sampled a few cycles earlier
+    const auto          cycles = static_cast<std::uint32_t>(exact);
+
+    CHECK_EQUAL(exact, TimebaseMath::cyclesFromUs(us, 168, cycles));
+}
+
+TEST(TimebaseMath, CyclesAcrossCycleCounterWrap)
+{
+    const std::uint64_t exact  = 0x100000000ULL + 10;
+    const std::uint64_t us     = exact / 168;
+    const auto          cycles = static_cast<std::uint32_t>(exact);
+
+    CHECK_EQUAL(exact, TimebaseMath::cyclesFromUs(us, 168, cycles));
+}
+
+TEST_GROUP(Deadline){};
+
+TEST(Deadline, ExpiresAtTimeout)
+{
+    ManualTimebase clock(168);
+    clock.setUs(1000);
+    const Deadline deadline(clock, 500);
+
+    CHECK_FALSE(deadline.expired());
+    CHECK_EQUAL(500U, deadline.remainingUs());
+
+    clock.setUs(1499);
+    CHECK_FALSE(deadline.expired());
+    CHECK_EQUAL(1U, deadline.remainingUs());
+
+    clock.setUs(1500);
+    CHECK_TRUE(deadline.expired());
+    CHECK_EQUAL(0U, deadline.remainingUs());
+}
+
+TEST(Deadline, DefaultIsExpired)
+{
+    ManualTimebase clock(168);
+    const Deadline deadline(clock);
+
+    CHECK_TRUE(deadline.expired());
+}
+
+TEST(Deadline, RestartCountsFromNow)
+{
+    ManualTimebase clock(168);
+    Deadline       deadline(clock, 100);
+
+    clock.setUs(90);
+    deadline.restart(100);
+    clock.setUs(150);
+    CHECK_FALSE(deadline.expired());
+    clock.setUs(190);
+    CHECK_TRUE(deadline.expired());
+}
+
+TEST(Deadline, AdvanceKeepsPeriodWithoutDrift)
+{
+    ManualTimebase clock(168);
+    Deadline       deadline(clock, 100);
+
+    clock.setUs(130); // Serviced late
+    CHECK_TRUE(deadline.expired());
+    deadline.advance(100);
+
+    clock.setUs(199);
+    CHECK_FALSE(deadline.expired());
+    clock.setUs(200);
+    CHECK_TRUE(deadline.expired());
+}
+
+TEST(Deadline, AdvanceSkipsMissedPeriods)
+{
+    ManualTimebase clock(168);
+    Deadline       deadline(clock, 100);
+
+    clock.setUs(1050);
+    deadline.advance(100);
+
+    CHECK_FALSE(deadline.expired());
+    CHECK_EQUAL(100U, deadline.remainingUs());
+}
+
+TEST_GROUP(TimebaseHost){};
+
+TEST(TimebaseHost, CountsMonotonicallyInBothUnits)
+{
+    const TimebaseHost timebase;
+
+    const std::uint64_t us     = timebase.nowUs();
+    const std::uint64_t cycles = timebase.nowCycles();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    CHECK(timebase.nowUs() >= us + 2000);
+    CHECK(timebase.nowCycles() >= cycles + 2000 * timebase.cyclesPerUs());
+}
+
+TEST(TimebaseHost, DeadlineExpiresOnRealClock)
+{
+    const TimebaseHost timebase;
+    const Deadline     deadline(timebase, 1000);
+
+    CHECK_FALSE(deadline.expired());
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    CHECK_TRUE(deadline.expired());
+}
@@ -0,0 +1,138 @@
+#include <cstdint>
+#include "CppUTest/TestHarness.h"
+#include "pil_timer.hpp"
+#include "timer_fake.hpp"
+#include "timer_stm32.hpp"
+
+// Computed for the App clock profile (TIM3 on 84 MHz), as the App uses it
+constexpr TimerPeriod HEARTBEAT = TimerMath::fromMicroseconds(84000000, 500000, 0xFFFF);
+static_assert(HEARTBEAT.valid);
+static_assert(HEARTBEAT.reload <= 0xFFFF);
+static_assert(Timer_STM32::clockHz(TimerId::Tim3) == 84000000);
+static_assert(!Timer_STM32::period(TimerId::Tim3, 60000000).valid);
+static_assert(Timer_STM32::period(TimerId::Tim5, 60000000).valid);
+
+namespace
+{
+void countCall(void* t_counter)
+{
+    ++*static_cast<int*>(t_counter);
+}
+} // namespace
+
+TEST_GROUP(TimerMath){};
+
+TEST(TimerMath, ExactPeriodUsesPrescalerOne)
+{
+    const TimerPeriod period = TimerMath::fromMicroseconds(84000000, 500, 0xFFFF);
+
+    CHECK_TRUE(period.valid);
+    CHECK_EQUAL(0U, period.prescaler);
+    CHECK_EQUAL(41999U, period.reload);
+}
+
+TEST(TimerMath, LongPeriodOn16BitTimerKeepsFinestTick)
+{
+    CHECK_EQUAL(640U, HEARTBEAT.prescaler);
+    CHECK_EQUAL(65522U, HEARTBEAT.reload);
+
+    // Within 10 ppm of 500 ms
+    const std::uint64_t ns = TimerMath::periodNs(84000000, HEARTBEAT);
+    CHECK(ns > 499995000ULL);
+    CHECK(ns < 500005000ULL);
+}
+
+TEST(TimerMath, ThirtyTwoBitTimerNeedsNoPrescaler)
+{
+    const TimerPeriod period = TimerMath::fromMicroseconds(84000000, 10000000, 0xFFFFFFFF);
+
+    CHECK_TRUE(period.valid);
+    CHECK_EQUAL(0U, period.prescaler);
+    CHECK_EQUAL(839999999U, period.reload);
+}
+
+TEST(TimerMath, OutOfRangePeriodsAreInvalid)
+{
+    CHECK_FALSE(TimerMath::fromMicroseconds(84000000, 0, 0xFFFF).valid);
+    CHECK_FALSE(TimerMath::fromMicroseconds(84000000, 60000000, 0xFFFF).valid);
+    CHECK_FALSE(TimerMath::fromFrequency(84000000, 0, 0xFFFF).valid);
+}
+
+TEST(TimerMath, FrequencyMatchesPeriod)
+{
+    const TimerPeriod pwm = TimerMath::fromFrequency(16000000, 1000, 0xFFFF);
+
+    CHECK_EQUAL(0U, pwm.prescaler);
+    CHECK_EQUAL(15999U, pwm.reload);
+}
+
+TEST_GROUP(TimerFake){};
+
+TEST(TimerFake, PeriodicFiresOncePerPeriod)
+{
+    TimerFake timer;
+    int       calls = 0;
+
+    CHECK_TRUE(timer.startPeriodic({9, 99, true}, &countCall, &calls)); // 1000 clock ticks
+
+    timer.elapse(999);
+    CHECK_EQUAL(0, calls);
+    timer.elapse(1);
+    CHECK_EQUAL(1, calls);
+    timer.elapse(3500);
+    CHECK_EQUAL(4, calls);
+    CHECK_TRUE(timer.isRunning());
+
+    timer.stop();
+    timer.elapse(5000);
+    CHECK_EQUAL(4, calls);
+}
+
+TEST(TimerFake, OneShotFiresOnce)
+{
+    TimerFake timer;
+    int       calls = 0;
+
+    CHECK_TRUE(timer.startOneShot({0, 499, true}, &countCall, &calls));
+    timer.elapse(10000);
+
+    CHECK_EQUAL(1, calls);
+    CHECK_FALSE(timer.isRunning());
+}
+
+TEST(TimerFake, RejectsReloadBeyondCounterWidth)
+{
+    TimerFake timer(0xFFFF);
+
+    CHECK_FALSE(timer.startPeriodic({0, 0x10000, true}, nullptr, nullptr));
+    CHECK_FALSE(timer.startPeriodic({}, nullptr, nullptr));
+    CHECK_FALSE(timer.isRunning());
+}
+
+TEST(TimerFake, PwmDutyNeedsRunningPwm)
+{
+    TimerFake timer;
+
+    CHECK_FALSE(timer.setDuty(TimerChannel::Ch2, 10));
+    CHECK_TRUE(timer.startPwm(TimerMath::fromFrequency(84000000, 20000, 0xFFFF)));
+    CHECK_TRUE(timer.setDuty(TimerChannel::Ch2, 2100));
+    CHECK_EQUAL(2100U, timer.duty(TimerChannel::Ch2));
+}
+
+TEST(TimerFake, CaptureCompletesWhenBufferIsFull)
+{
+    TimerFake     timer;
+    std::uint32_t edges[3]{};
+    int           calls = 0;
+
+    CHECK_TRUE(timer.startCapture({83, 0, true}, TimerChannel::Ch1, CaptureEdge::Rising, edges, 3,
+                                  &countCall, &calls));
+    timer.capture(100);
+    timer.capture(1100);
+    CHECK_EQUAL(0, calls);
+    timer.capture(2100);
+
+    CHECK_EQUAL(1, calls);
+    CHECK_EQUAL(1000U, edges[1] - edges[0]);
+    CHECK_FALSE(timer.isRunning());
+}
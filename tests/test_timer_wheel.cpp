@@ -0,0 +1,227 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "CppUTest/TestHarness.h"
+#include "timer_wheel.hpp"
+
+namespace
+{
+using Wheel = TimerWheel<4>;
+
+struct Probe
+{
+    Wheel*        wheel{nullptr};
+    int           fired{0};
+    std::uint32_t firedAt{0};
+    bool          late{false}; // Fired at a wheel time other than its expiry
+    std::uint32_t expected{0};
+};
+
+void onFire(void* t_probe)
+{
+    Probe& probe = *static_cast<Probe*>(t_probe);
+    probe.fired++;
+    probe.firedAt = probe.wheel->now();
+    probe.late    = probe.late || (probe.firedAt != probe.expected);
+}
+} // namespace
+
+TEST_GROUP(TimerWheel)
+{
+    Wheel     wheel;
+    SoftTimer timer;
+    Probe     probe{&wheel};
+};
+
+TEST(TimerWheel, FiresOnceAtItsExpiry)
+{
+    wheel.start(timer, 10, &onFire, &probe);
+
+    wheel.advanceTo(9);
+    CHECK_EQUAL(0, probe.fired);
+    CHECK_TRUE(timer.isActive());
+
+    CHECK_EQUAL(1u, wheel.advanceTo(50));
+    CHECK_EQUAL(1, probe.fired);
+    CHECK_EQUAL(10u, probe.firedAt);
+    CHECK_FALSE(timer.isActive());
+    CHECK_EQUAL(0u, wheel.active());
+}
+
+TEST(TimerWheel, ZeroDelayFiresOnTheNextTick)
+{
+    wheel.advanceTo(5);
+    wheel.start(timer, 0, &onFire, &probe);
+
+    wheel.advanceTo(6);
+    CHECK_EQUAL(1, probe.fired);
+    CHECK_EQUAL(6u, probe.firedAt);
+}
+
+TEST(TimerWheel, StopPreventsFiring)
+{
+    wheel.start(timer, 100, &onFire, &probe);
+    wheel.stop(timer);
+
+    wheel.advanceTo(1000);
+    CHECK_EQUAL(0, probe.fired);
+    CHECK_EQUAL(0u, wheel.active());
+    CHECK_EQUAL(Wheel::NO_EVENT, wheel.ticksToNextEvent());
+}
+
+TEST(TimerWheel, RestartMovesTheExpiry)
+{
+    wheel.start(timer, 100, &onFire, &probe);
+    wheel.start(timer, 20, &onFire, &probe);
+
+    CHECK_EQUAL(1u, wheel.active());
+    wheel.advanceTo(1000);
+    CHECK_EQUAL(1, probe.fired);
+    CHECK_EQUAL(20u, probe.firedAt);
+}
+
+TEST(TimerWheel, PeriodicKeepsItsPhaseWhenAdvancedLate)
+{
+    wheel.start(timer, 7, &onFire, &probe, 7);
+
+    CHECK_EQUAL(3u, wheel.advanceTo(22)); // 7, 14, 21 in one call
+    CHECK_EQUAL(21u, probe.firedAt);
+    CHECK_EQUAL(28u, timer.expires());
+    CHECK_TRUE(timer.isActive());
+}
+
+TEST(TimerWheel, DistantTimersCascadeToTheExactTick)
+{
+    const std::uint32_t delays[] = {64, 65, 4095, 4096, 100000, Wheel::RANGE - 1};
+
+    for (const std::uint32_t delay : delays)
+    {
+        Wheel     fresh(1234);
+        SoftTimer distant;
+        Probe     check{&fresh, 0, 0, false, 1234 + delay};
+
+        fresh.start(distant, delay, &onFire, &check);
+        fresh.advanceTo(1234 + delay - 1);
+        CHECK_EQUAL(0, check.fired);
+        fresh.advanceTo(1234 + delay);
+        CHECK_EQUAL(1, check.fired);
+        CHECK_FALSE(check.late);
+    }
+}
+
+TEST(TimerWheel, BeyondTheRangeParksAndStillFiresOnTime)
+{
+    const std::uint32_t delay = Wheel::RANGE * 3 + 17;
+    probe.expected            = delay;
+
+    wheel.start(timer, delay, &onFire, &probe);
+    wheel.advanceTo(delay - 1);
+    CHECK_EQUAL(0, probe.fired);
+    wheel.advanceTo(delay + 5);
+    CHECK_EQUAL(1, probe.fired);
+    CHECK_FALSE(probe.late);
+}
+
+TEST(TimerWheel, TicksToNextEventNeverOvershootsAnExpiry)
+{
+    wheel.start(timer, 5000, &onFire, &probe);
+    probe.expected = 5000;
+
+    // A tickless caller wakes only when told to
+    int wakeups = 0;
+    while (probe.fired == 0)
+    {
+        const std::uint32_t step = wheel.ticksToNextEvent();
+        CHECK(step <= 5000 - wheel.now());
+        wheel.advanceTo(wheel.now() + step);
+        wakeups++;
+    }
+    CHECK_FALSE(probe.late);
+    CHECK(wakeups <= 3); // One cascade per level at most, then the expiry
+}
+
+TEST(TimerWheel, WheelTimeWraps)
+{
+    Wheel     wrapping(0xFFFFFFF0U);
+    SoftTimer late;
+    Probe     check{&wrapping, 0, 0, false, 0x54};
+
+    wrapping.start(late, 100, &onFire, &check);
+    wrapping.advanceTo(0x53);
+    CHECK_EQUAL(0, check.fired);
+    wrapping.advanceTo(0x60);
+    CHECK_EQUAL(1, check.fired);
+    CHECK_FALSE(check.late);
+}
+
+namespace
+{
+SoftTimer other;
+Wheel*    current;
+int       otherFired;
+
+void stopOther(void*)
+{
+    current->stop(other);
+}
+
+void countOther(void*)
+{
+    otherFired++;
+}
+
+void restartSelf(void* t_timer)
+{
+    current->start(*static_cast<SoftTimer*>(t_timer), 3, &countOther, nullptr);
+}
+} // namespace
+
+TEST(TimerWheel, CallbackCanStopATimerDueOnTheSameTick)
+{
+    current    = &wheel;
+    otherFired = 0;
+    wheel.start(timer, 10, &stopOther, nullptr);
+    wheel.start(other, 10, &countOther, nullptr);
+
+    wheel.advanceTo(20);
+    CHECK_EQUAL(0, otherFired);
+    CHECK_EQUAL(0u, wheel.active());
+}
+
+TEST(TimerWheel, CallbackCanRestartItself)
+{
+    current    = &wheel;
+    otherFired = 0;
+    wheel.start(timer, 10, &restartSelf, &timer);
+
+    wheel.advanceTo(20);
+    CHECK_EQUAL(1, otherFired); // Restarted at 10 for 13 with the other callback
+}
+
+TEST(TimerWheel, ManyRandomTimersAllFireOnTime)
+{
+    constexpr std::size_t COUNT = 2000;
+
+    std::mt19937                                 random(42);
+    std::uniform_int_distribution<std::uint32_t> delay(1, 300000);
+    std::uniform_int_distribution<std::uint32_t> step(1, 5000);
+
+    std::vector<SoftTimer> timers(COUNT);
+    std::vector<Probe>     probes(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        probes[i] = Probe{&wheel, 0, 0, false, delay(random)};
+        wheel.startAt(timers[i], probes[i].expected, &onFire, &probes[i]);
+    }
+
+    while (wheel.active() != 0)
+    {
+        wheel.advanceTo(wheel.now() + step(random));
+    }
+
+    for (const Probe& each : probes)
+    {
+        CHECK_EQUAL(1, each.fired);
+        CHECK_FALSE(each.late);
+    }
+}
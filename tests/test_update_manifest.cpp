@@ -0,0 +1,92 @@
+#include <cstdint>
+#include "CppUTest/TestHarness.h"
+#include "flash_layout.hpp"
+#include "update_manifest.hpp"
+
+namespace
+{
+constexpr std::uint32_t BOOTSEC_MAX = FlashLayout::NEW_BOOTLOADER2_SIZE -
+                                      Firmware::COMPONENT_TRAILER_SIZE;
+constexpr std::uint32_t APP_MAX     = FlashLayout::NEW_APP_SIZE;
+
+// Recomputes the check word, so each test rejects for its own reason only
+Firmware::UpdateManifest seal(Firmware::UpdateManifest t_manifest)
+{
+    t_manifest.check = t_manifest.magic ^ t_manifest.formatVersion ^ t_manifest.componentMask ^
+                       t_manifest.bootSecSize ^ t_manifest.appSize ^ t_manifest.reserved[0] ^
+                       t_manifest.reserved[1];
+    return t_manifest;
+}
+
+Firmware::UpdateManifest makeManifest(std::uint32_t t_mask, std::uint32_t t_bootSecSize,
+                                      std::uint32_t t_appSize)
+{
+    Firmware::UpdateManifest manifest{};
+    manifest.magic         = Firmware::UPDATE_MANIFEST_MAGIC;
+    manifest.formatVersion = Firmware::UPDATE_MANIFEST_VERSION;
+    manifest.componentMask = t_mask;
+    manifest.bootSecSize   = t_bootSecSize;
+    manifest.appSize       = t_appSize;
+    return seal(manifest);
+}
+
+constexpr std::uint32_t BOTH = Firmware::COMPONENT_BOOTSEC | Firmware::COMPONENT_APP;
+
+} // namespace
+
+TEST_GROUP(UpdateManifest){};
+
+TEST(UpdateManifest, WellFormedPackagesAreAccepted)
+{
+    CHECK_TRUE(isManifestValid(makeManifest(BOTH, 48 * 1024, 200 * 1024)));
+    CHECK_TRUE(isManifestValid(makeManifest(Firmware::COMPONENT_APP, 0, APP_MAX)));
+    CHECK_TRUE(isManifestValid(makeManifest(Firmware::COMPONENT_BOOTSEC, BOOTSEC_MAX, 0)));
+}
+
+TEST(UpdateManifest, BadMagicVersionOrCheckIsRejected)
+{
+    Firmware::UpdateManifest manifest = makeManifest(BOTH, 1024, 1024);
+    manifest.magic                    = 0x4D445055; // 'UPDM' byte-swapped
+    CHECK_FALSE(isManifestValid(seal(manifest)));
+
+    manifest               = makeManifest(BOTH, 1024, 1024);
+    manifest.formatVersion = Firmware::UPDATE_MANIFEST_VERSION + 1;
+    CHECK_FALSE(isManifestValid(seal(manifest)));
+
+    // A flipped size bit the check word does not cover
+    manifest = makeManifest(BOTH, 1024, 1024);
+    manifest.appSize ^= 0x100;
+    CHECK_FALSE(isManifestValid(manifest));
+}
+
+TEST(UpdateManifest, MaskWithoutKnownComponentsIsRejected)
+{
+    CHECK_FALSE(isManifestValid(makeManifest(0, 1024, 1024)));
+    CHECK_FALSE(isManifestValid(makeManifest(1U << 2, 1024, 1024)));
+    CHECK_FALSE(isManifestValid(makeManifest(0x80000000, 1024, 1024)));
+
+    // A known bit does not excuse an unknown one
+    CHECK_FALSE(isManifestValid(makeManifest(Firmware::COMPONENT_APP | (1U << 2), 0, 1024)));
+}
+
+TEST(UpdateManifest, ComponentLargerThanItsSlotIsRejected)
+{
+    CHECK_FALSE(isManifestValid(makeManifest(Firmware::COMPONENT_APP, 0, APP_MAX + 1)));
+    CHECK_FALSE(isManifestValid(
+        makeManifest(Firmware::COMPONENT_BOOTSEC, FlashLayout::NEW_BOOTLOADER2_SIZE + 4, 0)));
+    CHECK_FALSE(isManifestValid(makeManifest(BOTH, 1024, 0xFFFFFFFF)));
+}
+
+TEST(UpdateManifest, FirmwareRunningIntoTheTrailerIsRejected)
+{
+    // Fits the slot, but the metadata and certificate trailer would overwrite its tail
+    CHECK_FALSE(isManifestValid(makeManifest(Firmware::COMPONENT_BOOTSEC, BOOTSEC_MAX + 4, 0)));
+    CHECK_FALSE(isManifestValid(
+        makeManifest(Firmware::COMPONENT_APP, 0, FlashLayout::NEW_APP_TOTAL_SIZE)));
+}
+
+TEST(UpdateManifest, ListedComponentWithoutFirmwareIsRejected)
+{
+    CHECK_FALSE(isManifestValid(makeManifest(Firmware::COMPONENT_BOOTSEC, 0, 1024)));
+    CHECK_FALSE(isManifestValid(makeManifest(BOTH, 1024, 0)));
+}
@@ -0,0 +1,63 @@
+/**
+ * @file      tests/timebase_host.hpp
+ * @author    it32bit
+ * @brief     ITimebase implementations for host builds.
+ *
+ * @details   TimebaseHost runs on std::chrono::steady_clock; its "cycles" are nanoseconds,
+ *            so cyclesPerUs() is 1000. ManualTimebase only moves when a test sets it.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef TIMEBASE_HOST_HPP
+#define TIMEBASE_HOST_HPP
+
+#include <chrono>
+#include "pil_timebase.hpp"
+
+class TimebaseHost : public ITimebase
+{
+  public:
+    std::uint64_t nowUs() const override
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed()).count());
+    }
+
+    std::uint64_t nowCycles() const override
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed()).count());
+    }
+
+    std::uint32_t cyclesPerUs() const override { return 1000; }
+
+  private:
+    std::chrono::steady_clock::duration elapsed() const
+    {
+        return std::chrono::steady_clock::now() - m_start;
+    }
+
+    std::chrono::steady_clock::time_point m_start{std::chrono::steady_clock::now()};
+};
+
+class ManualTimebase : public ITimebase
+{
+  public:
+    explicit ManualTimebase(std::uint32_t t_cyclesPerUs = 100) : m_cyclesPerUs(t_cyclesPerUs) {}
+
+    std::uint64_t nowUs() const override { return cycles / m_cyclesPerUs; }
+    std::uint64_t nowCycles() const override { return cycles; }
+    std::uint32_t cyclesPerUs() const override { return m_cyclesPerUs; }
+
+    void setUs(std::uint64_t t_us) { cycles = t_us * m_cyclesPerUs; }
+
+    std::uint64_t cycles{0};
+
+  private:
+    std::uint32_t m_cyclesPerUs;
+};
+
+#endif // TIMEBASE_HOST_HPP
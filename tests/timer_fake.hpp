@@ -0,0 +1,162 @@
+/**
+ * @file      tests/timer_fake.hpp
+ * @author    it32bit
+ * @brief     ITimer driven by hand, for deterministic tests of timer users.
+ *
+ * @details   elapse() advances the timer clock (before the prescaler) and runs the
+ *            callbacks that fall due, in order; capture() feeds one input edge.
+ *
+ * @version   1.0
+ * @date      2026-10-18
+ * @attention This file is part of the ha-ctrl project and is licensed under the MIT License.
+ *            (c) 2025 ha-ctrl project authors.
+ */
+#ifndef TIMER_FAKE_HPP
+#define TIMER_FAKE_HPP
+
+#include <array>
+#include "pil_timer.hpp"
+
+class TimerFake : public ITimer
+{
+  public:
+    explicit TimerFake(std::uint32_t t_maxReload = 0xFFFF) : m_maxReload(t_maxReload) {}
+
+    bool startPeriodic(const TimerPeriod& t_period, TimerCallback t_callback,
+                       void* t_context) override
+    {
+        return start(t_period, t_callback, t_context, Mode::Periodic);
+    }
+
+    bool startOneShot(const TimerPeriod& t_delay, TimerCallback t_callback,
+                      void* t_context) override
+    {
+        return start(t_delay, t_callback, t_context, Mode::OneShot);
+    }
+
+    bool startPwm(const TimerPeriod& t_period) override
+    {
+        m_duty.fill(0);
+        return start(t_period, nullptr, nullptr, Mode::Pwm);
+    }
+
+    bool setDuty(TimerChannel t_channel, std::uint32_t t_compare) override
+    {
+        if (m_mode != Mode::Pwm)
+        {
+            return false;
+        }
+        m_duty[static_cast<std::size_t>(t_channel)] = t_compare;
+        return true;
+    }
+
+    bool startCapture(const TimerPeriod& t_tick, TimerChannel, CaptureEdge, std::uint32_t* t_buffer,
+                      std::size_t t_count, TimerCallback t_callback, void* t_context) override
+    {
+        if ((t_buffer == nullptr) || (t_count == 0) ||
+            !start({t_tick.prescaler, m_maxReload, t_tick.valid}, t_callback, t_context,
+                   Mode::Capture))
+        {
+            return false;
+        }
+        m_buffer   = t_buffer;
+        m_count    = t_count;
+        m_captured = 0;
+        return true;
+    }
+
+    void stop() override { m_mode = Mode::Stopped; }
+    bool isRunning() const override { return m_mode != Mode::Stopped; }
+
+    /** @brief Advance by t_clockTicks of the timer input clock. */
+    void elapse(std::uint64_t t_clockTicks)
+    {
+        while ((m_mode == Mode::Periodic) || (m_mode == Mode::OneShot))
+        {
+            const std::uint64_t toUpdate = periodTicks() - m_phase;
+            if (t_clockTicks < toUpdate)
+            {
+                m_phase += t_clockTicks;
+                return;
+            }
+            t_clockTicks -= toUpdate;
+            m_phase = 0;
+            if (m_mode == Mode::OneShot)
+            {
+                m_mode = Mode::Stopped;
+            }
+            if (m_callback != nullptr)
+            {
+                m_callback(m_context);
+            }
+        }
+    }
+
+    /** @brief One edge on the capture input, latching t_counter. */
+    void capture(std::uint32_t t_counter)
+    {
+        if ((m_mode != Mode::Capture) || (m_captured >= m_count))
+        {
+            return;
+        }
+        m_buffer[m_captured++] = t_counter;
+        if (m_captured == m_count)
+        {
+            m_mode = Mode::Stopped;
+            if (m_callback != nullptr)
+            {
+                m_callback(m_context);
+            }
+        }
+    }
+
+    std::uint32_t duty(TimerChannel t_channel) const
+    {
+        return m_duty[static_cast<std::size_t>(t_channel)];
+    }
+
+    const TimerPeriod& period() const { return m_period; }
+
+  private:
+    enum class Mode
+    {
+        Stopped,
+        Periodic,
+        OneShot,
+        Pwm,
+        Capture
+    };
+
+    bool start(const TimerPeriod& t_period, TimerCallback t_callback, void* t_context,
+               Mode t_mode)
+    {
+        if (!t_period.valid || (t_period.reload > m_maxReload))
+        {
+            return false;
+        }
+        m_period   = t_period;
+        m_callback = t_callback;
+        m_context  = t_context;
+        m_mode     = t_mode;
+        m_phase    = 0;
+        return true;
+    }
+
+    std::uint64_t periodTicks() const
+    {
+        return (std::uint64_t{m_period.prescaler} + 1) * (std::uint64_t{m_period.reload} + 1);
+    }
+
+    std::uint32_t                m_maxReload;
+    TimerPeriod                  m_period{};
+    TimerCallback                m_callback{nullptr};
+    void*                        m_context{nullptr};
+    Mode                         m_mode{Mode::Stopped};
+    std::uint64_t                m_phase{0};
+    std::array<std::uint32_t, 4> m_duty{};
+    std::uint32_t*               m_buffer{nullptr};
+    std::size_t                  m_count{0};
+    std::size_t                  m_captured{0};
+};
+
+#endif // TIMER_FAKE_HPP